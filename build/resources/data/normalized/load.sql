@@ -0,0 +1,4 @@
+LOAD DATA LOCAL INFILE '/root/repo/build/resources/data/normalized/ProfessorTable.csv' INTO TABLE ProfessorTable FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '"' ESCAPED BY '' LINES TERMINATED BY '\n' IGNORE 1 LINES (Professor, ProfessorEmail);
+LOAD DATA LOCAL INFILE '/root/repo/build/resources/data/normalized/CourseTable.csv' INTO TABLE CourseTable FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '"' ESCAPED BY '' LINES TERMINATED BY '\n' IGNORE 1 LINES (Professor, CourseStart, CourseEnd, Course);
+LOAD DATA LOCAL INFILE '/root/repo/build/resources/data/normalized/StudentIDTable.csv' INTO TABLE StudentIDTable FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '"' ESCAPED BY '' LINES TERMINATED BY '\n' IGNORE 1 LINES (FirstName, LastName, StudentID);
+LOAD DATA LOCAL INFILE '/root/repo/build/resources/data/normalized/StudentIDCourseTable.csv' INTO TABLE StudentIDCourseTable FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '"' ESCAPED BY '' LINES TERMINATED BY '\n' IGNORE 1 LINES (StudentID, Course);
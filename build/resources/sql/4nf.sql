@@ -0,0 +1,5 @@
+CREATE TABLE IF NOT EXISTS EMP (
+    Ename VARCHAR(255) NOT NULL,
+    Pname VARCHAR(255) NOT NULL,
+    Dname VARCHAR(255) NOT NULL
+);
\ No newline at end of file
@@ -0,0 +1,5 @@
+CREATE TABLE IF NOT EXISTS SUPPLY (
+    Sname VARCHAR(255) NOT NULL,
+    Part_name VARCHAR(255) NOT NULL,
+    Proj_name VARCHAR(255) NOT NULL
+);
\ No newline at end of file
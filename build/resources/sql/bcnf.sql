@@ -0,0 +1,5 @@
+CREATE TABLE IF NOT EXISTS BCNF (
+    StudentID INT NOT NULL,
+    Course VARCHAR(255) NOT NULL,
+    Instructor VARCHAR(255) NOT NULL
+);
\ No newline at end of file
@@ -0,0 +1,10 @@
+CREATE TABLE IF NOT EXISTS TESTING (
+    StudentID INT NOT NULL,
+    FirstName VARCHAR(255) NOT NULL,
+    LastName VARCHAR(255) NOT NULL,
+    Course VARCHAR(255) NOT NULL,
+    Professor VARCHAR(255) NOT NULL,
+    ProfessorEmail VARCHAR(255) NOT NULL,
+    CourseStart VARCHAR(255) NOT NULL,
+    CourseEnd VARCHAR(255) NOT NULL
+);
\ No newline at end of file
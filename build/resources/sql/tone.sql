@@ -0,0 +1,6 @@
+CREATE TABLE IF NOT EXISTS TONE (
+    A INT NOT NULL,
+    B INT NOT NULL,
+    C INT NOT NULL,
+    D INT NOT NULL
+);
\ No newline at end of file
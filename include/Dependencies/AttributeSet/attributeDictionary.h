@@ -0,0 +1,160 @@
+/*! \file attributeDictionary.h
+    \brief Header file for creating an attribute dictionary.
+    \details Contains the function declarations for mapping row names to attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "aliases.h"
+#include "attributeSet.h"
+#include "Table/table.h"
+
+namespace normalizer::dependencies::attribute
+{
+    /*! \headerfile attributeDictionary.h
+        \brief Maps the row names of a table to dense attribute identifiers
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class AttributeDictionary
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        AttributeDictionary() {}
+
+        /*! \brief Creates a dictionary holding every row of \p sqlTable in order
+            \param[in] sqlTable The table whose rows become attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        AttributeDictionary(const table::Table &sqlTable);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~AttributeDictionary() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the dictionary
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the dictionary
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the identifier of a row name
+            \pre \p rowName must be in the dictionary
+            \param[in] rowName The row name to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The identifier of \p rowName
+        */
+        us getAttributeId(const std::string &rowName) const;
+
+        /*! \brief Gets the row name of an identifier
+            \param[in] attribute The identifier to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The row name of \p attribute
+        */
+        std::string getAttributeName(const us attribute) const;
+
+        /* Member Functions */
+
+        /*! \brief Adds a row name to the dictionary if it is not already in it
+            \param[in] rowName The row name to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The identifier of \p rowName
+        */
+        us addAttribute(const std::string &rowName);
+
+        /*! \brief Checks if a row name is in the dictionary
+            \param[in] rowName The row name to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p rowName is in the dictionary
+        */
+        bool containsAttribute(const std::string &rowName) const;
+
+        /*! \brief Creates an empty set sized to the dictionary
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet An empty set sized to the dictionary
+        */
+        AttributeSet createEmptySet() const;
+
+        /*! \brief Creates a set holding every attribute of the dictionary
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet A set holding every attribute of the dictionary
+        */
+        AttributeSet createFullSet() const;
+
+        /*! \brief Converts a list of row names into a set
+            \param[in] rowNames The row names to convert
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The set of the row names
+        */
+        AttributeSet toAttributeSet(const std::vector<std::string> &rowNames) const;
+
+        /*! \brief Converts the rows of a table into a set
+            \param[in] sqlTable The table whose rows are converted
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The set of the rows of \p sqlTable
+        */
+        AttributeSet getTableAttributes(const table::Table &sqlTable) const;
+
+        /*! \brief Converts a set into its row names
+            \param[in] attributes The set to convert
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The row names of the set
+        */
+        std::vector<std::string> toRowNames(const AttributeSet &attributes) const;
+
+        /*! \brief Converts a set into the dependency file syntax
+            \details A single attribute is written as row_name, and several as (row_name_one, row_name_two)
+            \param[in] attributes The set to convert
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The dependency file representation of the set
+        */
+        std::string toString(const AttributeSet &attributes) const;
+
+    private:
+        std::vector<std::string> attributeNames;          /*!< The row name of each identifier */
+        std::unordered_map<std::string, us> attributeIds; /*!< The identifier of each row name */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+/*! \file attributeSet.h
+    \brief Header file for creating a set of attributes.
+    \details Contains the function declarations for creating a bitset of attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+
+namespace normalizer::dependencies::attribute
+{
+    /*! \headerfile attributeSet.h
+        \brief A set of attribute identifiers stored as a bitset
+        \details Each attribute of a table is given an identifier by \ref normalizer::dependencies::attribute::AttributeDictionary "AttributeDictionary", which is the bit set in #words
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class AttributeSet
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        AttributeSet() : attributeCount(0) {}
+
+        /*! \brief Creates an empty set able to hold \p count attributes
+            \param[in] count The number of attributes in the universe of the set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        AttributeSet(const us count);
+
+        /*! \brief Copy constructor
+            \param[in] other The set to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        AttributeSet(const AttributeSet &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~AttributeSet() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the universe of the set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the universe of the set
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the words backing the set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ul> The words backing the set
+        */
+        const std::vector<ul> &getWords() const;
+
+        /*! \brief Gets the attribute identifiers in the set in ascending order
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<us> The attribute identifiers in the set
+        */
+        std::vector<us> getAttributes() const;
+
+        /* Member Functions */
+
+        /*! \brief Adds an attribute to the set
+            \param[in] attribute The attribute identifier to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addAttribute(const us attribute);
+
+        /*! \brief Removes an attribute from the set
+            \param[in] attribute The attribute identifier to remove
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void removeAttribute(const us attribute);
+
+        /*! \brief Checks if an attribute is in the set
+            \param[in] attribute The attribute identifier to look for
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p attribute is in the set
+        */
+        bool containsAttribute(const us attribute) const;
+
+        /*! \brief Counts the attributes in the set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the set
+        */
+        us count() const;
+
+        /*! \brief Checks if the set has no attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the set has no attributes
+        */
+        bool isEmpty() const;
+
+        /*! \brief Checks if every attribute of the set is also in \p other
+            \param[in] other The set to compare against
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the set is a subset of \p other
+        */
+        bool isSubsetOf(const AttributeSet &other) const;
+
+        /*! \brief Checks if the set shares any attribute with \p other
+            \param[in] other The set to compare against
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the two sets share an attribute
+        */
+        bool intersects(const AttributeSet &other) const;
+
+        /*! \brief Finds the smallest attribute in the set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The smallest attribute in the set, or #attributeCount if the set is empty
+        */
+        us findFirst() const;
+
+        /*! \brief Finds the smallest attribute in the set that is greater than \p attribute
+            \param[in] attribute The attribute to search after
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The next attribute in the set, or #attributeCount if there is none
+        */
+        us findNext(const us attribute) const;
+
+        /*! \brief Hashes the set for use in unordered containers
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The hash of the set
+        */
+        std::size_t hash() const;
+
+        /* Operator Overloads */
+
+        /*! \brief Copy assignment
+            \param[in] other The set to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The updated set
+        */
+        AttributeSet &operator=(const AttributeSet &other);
+
+        /*! \brief Adds every attribute of \p other to the set
+            \param[in] other The set to union with
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The updated set
+        */
+        AttributeSet &operator|=(const AttributeSet &other);
+
+        /*! \brief Keeps only the attributes also in \p other
+            \param[in] other The set to intersect with
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The updated set
+        */
+        AttributeSet &operator&=(const AttributeSet &other);
+
+        /*! \brief Removes every attribute of \p other from the set
+            \param[in] other The set to subtract
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The updated set
+        */
+        AttributeSet &operator-=(const AttributeSet &other);
+
+        /*! \brief Gets the union of two sets
+            \param[in] other The set to union with
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The union of the two sets
+        */
+        AttributeSet operator|(const AttributeSet &other) const;
+
+        /*! \brief Gets the intersection of two sets
+            \param[in] other The set to intersect with
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The intersection of the two sets
+        */
+        AttributeSet operator&(const AttributeSet &other) const;
+
+        /*! \brief Gets the difference of two sets
+            \param[in] other The set to subtract
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The attributes of the set that are not in \p other
+        */
+        AttributeSet operator-(const AttributeSet &other) const;
+
+        /*! \brief Checks to see if two sets hold the same attributes
+            \param[in] other The set to compare to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the two sets are equal
+        */
+        bool operator==(const AttributeSet &other) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Grows #words so that it can hold \p count attributes
+            \param[in] count The number of attributes to hold
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void reserveAttributes(const us count);
+
+        us attributeCount;     /*!< The number of attributes in the universe of the set */
+        std::vector<ul> words; /*!< The bits of the set, one bit per attribute */
+    };
+
+    /*! \headerfile attributeSet.h
+        \brief Hash functor so \ref normalizer::dependencies::attribute::AttributeSet "AttributeSet" can key unordered containers
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct AttributeSetHash
+    {
+        /*! \brief Hashes the set
+            \param[in] set The set to hash
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The hash of \p set
+        */
+        std::size_t operator()(const AttributeSet &set) const;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*! \file dependencyBasis.h
+    \brief Header file for computing dependency bases.
+    \details Contains the function declarations for computing the dependency basis of a set of attributes under functional and multi valued dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+
+namespace normalizer::dependencies::basis
+{
+    /*! \headerfile dependencyBasis.h
+        \brief Computes dependency bases with the algorithm of Beeri
+        \details The dependency basis of X is the partition of the attributes outside of X into blocks such that X ->> Y holds exactly when Y - X is a union of blocks. Starting from one block, every block that a dependency V ->> W splits, meaning the block misses V but holds only part of W, is replaced by its parts inside and outside of W. Each functional dependency V -> W splits like V ->> A for every A in W. Blocks are bitsets, so each split is a few word operations, and bases are cached by the attributes they were computed from.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyBasisCalculator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyBasisCalculator() : attributeCount(0) {}
+
+        /*! \brief Creates a calculator over \p inFunctionalDependencies and \p inMultivaluedDependencies
+            \param[in] inFunctionalDependencies The functional dependencies bases are computed under
+            \param[in] inMultivaluedDependencies The multi valued dependencies bases are computed under
+            \param[in] count The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyBasisCalculator(const std::vector<functional::FunctionalDependency> &inFunctionalDependencies, const std::vector<multivalued::MultivaluedDependency> &inMultivaluedDependencies, const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyBasisCalculator() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the schema
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the number of bases that have been computed
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The number of cached bases
+        */
+        std::size_t getCachedBasisCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Gets the dependency basis of \p attributes, computing it only if it is not already cached
+            \param[in] attributes The attributes to get the dependency basis of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The blocks of the basis, which partition the attributes outside of \p attributes
+        */
+        const std::vector<attribute::AttributeSet> &getBasis(const attribute::AttributeSet &attributes);
+
+        /*! \brief Computes the closure of \p attributes under both kinds of dependencies
+            \details A is in the closure of X if A is in X, or if {A} is a block of the basis of X and A is on the right but not the left hand side of some functional dependency
+            \param[in] attributes The attributes to compute the closure of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet Every attribute functionally determined by \p attributes
+        */
+        attribute::AttributeSet computeClosure(const attribute::AttributeSet &attributes);
+
+        /*! \brief Checks if the dependencies imply \p dependency
+            \param[in] dependency The multi valued dependency to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the right hand side of \p dependency, outside of its left hand side, is a union of blocks of the basis of its left hand side
+        */
+        bool implies(const multivalued::MultivaluedDependency &dependency);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Computes the dependency basis of \p attributes
+            \param[in] attributes The attributes to compute the dependency basis of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The blocks of the basis of \p attributes
+        */
+        std::vector<attribute::AttributeSet> computeBasis(const attribute::AttributeSet &attributes) const;
+
+        std::vector<multivalued::MultivaluedDependency> splitters;                                                          /*!< The multi valued dependencies, along with V ->> A for every functional dependency V -> W and A in W */
+        attribute::AttributeSet functionallyDetermined;                                                                     /*!< The attributes on the right but not the left hand side of some functional dependency */
+        std::unordered_map<attribute::AttributeSet, std::vector<attribute::AttributeSet>, attribute::AttributeSetHash> bases; /*!< The bases computed so far, keyed by the attributes they were computed from */
+        us attributeCount;                                                                                                  /*!< The number of attributes in the schema */
+    };
+}
@@ -0,0 +1,223 @@
+/*! \file chaseTableau.h
+    \brief Header file for creating a chase tableau.
+    \details Contains the function declarations for chasing a tableau of symbols with functional, multi valued and join dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+
+namespace normalizer::dependencies::chase
+{
+    /*! \headerfile chaseTableau.h
+        \brief Hash functor for a row of tableau symbols
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct SymbolRowHash
+    {
+        /*! \brief Hashes a row of symbols
+            \param[in] symbols The symbols to hash
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The hash of \p symbols
+        */
+        std::size_t operator()(const std::vector<ui> &symbols) const noexcept;
+    };
+
+    /*! \headerfile chaseTableau.h
+        \brief A tableau with one row per component of a decomposition and one column per attribute
+        \details Every cell holds an integer symbol, where 0 is the distinguished symbol of its column. Symbols of a column are equated through a union-find so no cell has to be rewritten, and rows that agree on a left hand side are found by hashing their symbols.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ChaseTableau
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates the starting tableau of a decomposition
+            \details Row i holds the distinguished symbol in the columns of \p components[i], and the symbol i + 1 everywhere else
+            \param[in] components The attributes of each table of the decomposition
+            \param[in] count The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ChaseTableau(const std::vector<attribute::AttributeSet> &components, const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ChaseTableau() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of rows in the tableau
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of rows in the tableau
+        */
+        ui getRowCount() const;
+
+        /*! \brief Gets the number of rounds the last call to #chase took
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of rounds the last call to #chase took
+        */
+        ui getRoundCount() const;
+
+        /*! \brief Checks if the last call to #chase left out rows because the tableau reached its row limit
+            \details A chase that was cut short and found no row of distinguished symbols proves nothing, since a left out row could have led to one
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If some implied row was not added to the tableau during the last call to #chase
+        */
+        bool isTruncated() const;
+
+        /* Member Functions */
+
+        /*! \brief Chases the tableau until no dependency changes it, or a row of distinguished symbols appears
+            \param[in] functionalDependencies The functional dependencies to chase with
+            \param[in] multivaluedDependencies The multi valued dependencies to chase with
+            \param[in] maxRows The tableau stops growing from multi valued dependencies once it has this many rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If a row of distinguished symbols was found
+        */
+        bool chase(const std::vector<functional::FunctionalDependency> &functionalDependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies, const ui maxRows);
+
+        /*! \brief Chases the tableau until no dependency changes it, or a row of distinguished symbols appears
+            \param[in] functionalDependencies The functional dependencies to chase with
+            \param[in] multivaluedDependencies The multi valued dependencies to chase with
+            \param[in] joinDependencies The join dependencies to chase with
+            \param[in] maxRows The tableau stops growing from multi valued and join dependencies once it has this many rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If a row of distinguished symbols was found
+        */
+        bool chase(const std::vector<functional::FunctionalDependency> &functionalDependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies, const std::vector<join::JoinDependency> &joinDependencies, const ui maxRows);
+
+        /*! \brief Equates the right hand side symbols of every pair of rows that agree on the left hand side
+            \param[in] dependency The functional dependency to apply
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If any symbols were equated
+        */
+        bool applyFunctionalDependency(const functional::FunctionalDependency &dependency);
+
+        /*! \brief Adds the swapped rows of every pair of rows that agree on the left hand side
+            \details For rows t1 and t2 that agree on X, adds the row that takes X and Y from t1 and every other attribute from t2
+            \param[in] dependency The multi valued dependency to apply
+            \param[in] maxRows The tableau stops growing once it has this many rows, and is marked as truncated if it leaves out a row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If any rows were added
+        */
+        bool applyMultivaluedDependency(const multivalued::MultivaluedDependency &dependency, const ui maxRows);
+
+        /*! \brief Adds every row of the join of the projections of the tableau onto the components of \p dependency
+            \details Only a join dependency over every column has a chase rule, so embedded join dependencies are skipped
+            \param[in] dependency The join dependency to apply
+            \param[in] maxRows The tableau stops growing once it has this many rows, and is marked as truncated if it leaves out a row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If any rows were added
+        */
+        bool applyJoinDependency(const join::JoinDependency &dependency, const ui maxRows);
+
+        /*! \brief Checks if some row holds only distinguished symbols
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If some row holds only distinguished symbols
+        */
+        bool hasDistinguishedRow();
+
+        /*! \brief Checks if a row holds only distinguished symbols in the columns of \p attributes
+            \param[in] row The row to check
+            \param[in] attributes The columns to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If every column of \p attributes is distinguished in \p row
+        */
+        bool isDistinguishedOn(const ui row, const attribute::AttributeSet &attributes);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds the representative symbol of a cell
+            \param[in] row The row of the cell
+            \param[in] column The column of the cell
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The representative symbol of the cell
+        */
+        ui findSymbol(const ui row, const us column);
+
+        /*! \brief Finds the representative of a symbol within a column, compressing the path to it
+            \param[in] column The column of the symbol
+            \param[in] symbol The symbol to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The representative of \p symbol
+        */
+        ui findRepresentative(const us column, ui symbol);
+
+        /*! \brief Equates two symbols of a column, keeping the smaller symbol so the distinguished symbol always wins
+            \param[in] column The column of the symbols
+            \param[in] first The first symbol
+            \param[in] second The second symbol
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the symbols were not already equal
+        */
+        bool equateSymbols(const us column, const ui first, const ui second);
+
+        /*! \brief Gets the representative symbols of a row on some columns
+            \param[in] row The row to read
+            \param[in] columns The columns to read
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The representative symbols of \p row on \p columns
+        */
+        std::vector<ui> getRowKey(const ui row, const std::vector<us> &columns);
+
+        std::vector<ui> cells;                      /*!< The symbols of the tableau, stored row after row */
+        std::vector<std::vector<ui>> symbolParents; /*!< The union-find parent of every symbol, per column */
+        ui rowCount;                                /*!< The number of rows in the tableau */
+        us attributeCount;                          /*!< The number of columns in the tableau */
+        ui roundCount;                              /*!< The number of rounds the last call to #chase took */
+        bool truncated;                             /*!< If the last call to #chase left out rows because the tableau reached its row limit */
+    };
+}
\ No newline at end of file
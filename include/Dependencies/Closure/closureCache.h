@@ -0,0 +1,204 @@
+/*! \file closureCache.h
+    \brief Header file for caching attribute closures.
+    \details Contains the function declarations for a closure cache that can be shared by every normalization pass and read from several threads
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCalculator.h"
+
+namespace normalizer::dependencies::closure
+{
+    /*! \headerfile closureCache.h
+        \brief One shard of a \ref normalizer::dependencies::closure::ClosureCache "ClosureCache", guarded by its own lock
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct ClosureCacheShard
+    {
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCacheShard() noexcept {}
+
+        /*! \brief The copy constructor
+            \param[in] other The shard to copy the closures of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCacheShard(const ClosureCacheShard &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ClosureCacheShard() {}
+
+        /*! \brief The copy assignment operator
+            \param[in] other The shard to copy the closures of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ClosureCacheShard The shard with the closures of \p other
+        */
+        ClosureCacheShard &operator=(const ClosureCacheShard &other);
+
+        mutable std::shared_mutex mutex;                                                                            /*!< Shared by readers, held alone by a writer */
+        std::unordered_map<attribute::AttributeSet, attribute::AttributeSet, attribute::AttributeSetHash> closures; /*!< The closures of this shard, keyed by the attributes they were computed from */
+    };
+
+    /*! \headerfile closureCache.h
+        \brief Caches the closures computed under one set of functional dependencies
+        \details The closures are split across shards by the hash of their attributes, so threads only wait on each other when they look up the same shard, and lookups that hit only take a shared lock. Closures are never removed, so a returned reference stays valid for the life of the cache, though adding or retracting a dependency may update the closure it refers to.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ClosureCache
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCache();
+
+        /*! \brief Creates a cache for the closures of \p inCalculator
+            \param[in] inCalculator The calculator that computes closures the cache does not have yet
+            \param[in] shardCount The number of shards to split the closures across
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCache(const ClosureCalculator &inCalculator, const us shardCount = CLOSURE_CACHE_SHARD_COUNT);
+
+        /*! \brief The copy constructor
+            \param[in] other The cache to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCache(const ClosureCache &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ClosureCache() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the calculator that computes closures the cache does not have yet
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ClosureCalculator The calculator of the cache
+        */
+        const ClosureCalculator &getCalculator() const;
+
+        /*! \brief Gets the number of lookups that found their closure in the cache
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of lookups that found their closure in the cache
+        */
+        ul getHitCount() const;
+
+        /*! \brief Gets the number of lookups that had to compute their closure
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of lookups that had to compute their closure
+        */
+        ul getMissCount() const;
+
+        /*! \brief Gets the number of closures in the cache
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The number of closures in the cache
+        */
+        std::size_t getSize() const;
+
+        /* Member Functions */
+
+        /*! \brief Gets the closure of \p attributes, computing it only if it is not already cached
+            \param[in] attributes The attributes to get the closure of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The closure of \p attributes
+        */
+        const attribute::AttributeSet &getClosure(const attribute::AttributeSet &attributes);
+
+        /*! \brief Checks if the dependencies imply \p lhs -> \p rhs
+            \param[in] lhs The determining attributes
+            \param[in] rhs The dependent attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p rhs is in the closure of \p lhs
+        */
+        bool implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs);
+
+        /*! \brief Adds a dependency, updating only the cached closures it extends
+            \details A cached closure only changes if it holds the left hand side of \p dependency but not all of its right hand side, and the new closure is then the closure of the old one. Must not be called while other threads are reading the cache.
+            \param[in] dependency The dependency to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of cached closures that were recomputed
+        */
+        ul addDependency(const functional::FunctionalDependency &dependency);
+
+        /*! \brief Retracts a dependency, recomputing only the cached closures it could have contributed to
+            \details A cached closure can only shrink if it holds the left hand side of \p dependency. Must not be called while other threads are reading the cache.
+            \param[in] dependency The dependency to retract, which does nothing if it is not one of the dependencies of the cache
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of cached closures that were recomputed
+        */
+        ul retractDependency(const functional::FunctionalDependency &dependency);
+
+        /* Operator Overloads */
+
+        /*! \brief The copy assignment operator
+            \param[in] other The cache to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ClosureCache The cache with the closures and statistics of \p other
+        */
+        ClosureCache &operator=(const ClosureCache &other);
+
+    private:
+        ClosureCalculator calculator;          /*!< Computes the closures the cache does not have yet */
+        std::vector<ClosureCacheShard> shards; /*!< The closures, split by the hash of their attributes */
+        std::atomic<ul> hitCount;              /*!< The number of lookups that found their closure in the cache */
+        std::atomic<ul> missCount;             /*!< The number of lookups that had to compute their closure */
+    };
+}
\ No newline at end of file
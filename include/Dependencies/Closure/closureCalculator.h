@@ -0,0 +1,141 @@
+/*! \file closureCalculator.h
+    \brief Header file for creating an attribute closure calculator.
+    \details Contains the function declarations for computing the closure of a set of attributes under a set of functional dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Store/dependencyStore.h"
+
+namespace normalizer::dependencies::closure
+{
+    /*! \headerfile closureCalculator.h
+        \brief Computes attribute closures in time linear to the size of the dependencies
+        \details Each dependency keeps a counter of the attributes on its left hand side that are not yet in the closure, and fires once that counter reaches zero
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ClosureCalculator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCalculator() : attributeCount(0) {}
+
+        /*! \brief Creates a calculator over \p inDependencies
+            \param[in] inDependencies The dependencies closures are computed under
+            \param[in] count The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureCalculator(const std::vector<functional::FunctionalDependency> &inDependencies, const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ClosureCalculator() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dependencies closures are computed under
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The dependencies closures are computed under
+        */
+        const std::vector<functional::FunctionalDependency> &getFunctionalDependencies() const;
+
+        /*! \brief Gets the number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the schema
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the flat store of the dependencies closures are computed under
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return DependencyStore The dependencies as arrays of attribute identifiers, indexed by left hand side attribute
+        */
+        const store::DependencyStore &getDependencyStore() const;
+
+        /* Member Functions */
+
+        /*! \brief Computes the closure of \p attributes
+            \param[in] attributes The attributes to compute the closure of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet Every attribute functionally determined by \p attributes
+        */
+        attribute::AttributeSet computeClosure(const attribute::AttributeSet &attributes) const;
+
+        /*! \brief Computes the closure of \p attributes using only some of the dependencies
+            \param[in] attributes The attributes to compute the closure of
+            \param[in] enabledDependencies Whether each dependency may be used, indexed the same as #functionalDependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet Every attribute determined by \p attributes under the enabled dependencies
+        */
+        attribute::AttributeSet computeClosure(const attribute::AttributeSet &attributes, const std::vector<bool> &enabledDependencies) const;
+
+        /*! \brief Checks if the dependencies imply \p lhs -> \p rhs
+            \param[in] lhs The determining attributes
+            \param[in] rhs The dependent attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p rhs is in the closure of \p lhs
+        */
+        bool implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs) const;
+
+        /*! \brief Checks if some of the dependencies imply \p lhs -> \p rhs, stopping as soon as every attribute of \p rhs is reached
+            \param[in] lhs The determining attributes
+            \param[in] rhs The dependent attributes
+            \param[in] enabledDependencies Whether each dependency may be used, indexed the same as #functionalDependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p rhs is in the closure of \p lhs under the enabled dependencies
+        */
+        bool implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs, const std::vector<bool> &enabledDependencies) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Computes the closure of \p attributes using only some of the dependencies, stopping once it holds all of \p target
+            \param[in] attributes The attributes to compute the closure of
+            \param[in] enabledDependencies Whether each dependency may be used, indexed the same as #functionalDependencies
+            \param[in] target The attributes that end the search once reached, where an empty set never ends it early
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The closure of \p attributes, or only part of it if \p target was reached first
+        */
+        attribute::AttributeSet computeClosure(const attribute::AttributeSet &attributes, const std::vector<bool> &enabledDependencies, const attribute::AttributeSet &target) const;
+
+        std::vector<functional::FunctionalDependency> functionalDependencies; /*!< The dependencies closures are computed under */
+        store::DependencyStore dependencyStore;                               /*!< The dependencies as arrays of attribute identifiers, indexed by left hand side attribute */
+        us attributeCount;                                                    /*!< The number of attributes in the schema */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*! \file closureMatrix.h
+    \brief Header file for the closures of every single attribute.
+    \details Contains the function declarations for a bit matrix holding the closure of each attribute of the schema, computed once with word parallel propagation
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/Store/dependencyStore.h"
+
+namespace normalizer::dependencies::closure
+{
+    /*! \headerfile closureMatrix.h
+        \brief Holds the closure of every single attribute as one row of a bit matrix
+        \details Row A starts as A and the right hand sides of the dependencies whose left hand side is A, or empty. The rows are then propagated like the algorithm of Warshall: for each attribute K, every row holding K takes the union of row K, one word at a time, which is O(n³ / 64) for n attributes. Dependencies with several attributes on the left are applied to every row holding their left hand side afterwards, and both steps repeat until no row changes. Every lookup afterwards is a bit test.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ClosureMatrix
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ClosureMatrix() : attributeCount(0), wordCount(0) {}
+
+        /*! \brief Computes the closure of every attribute under the dependencies of \p store
+            \param[in] store The dependencies the closures are computed under
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        explicit ClosureMatrix(const store::DependencyStore &store);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ClosureMatrix() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the schema
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the attributes whose closure holds every attribute of the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The attributes that are superkeys on their own
+        */
+        const attribute::AttributeSet &getSingleAttributeKeys() const;
+
+        /*! \brief Gets the attributes that are in the closure of some other attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The attributes that some other single attribute determines
+        */
+        const attribute::AttributeSet &getDeterminedAttributes() const;
+
+        /* Member Functions */
+
+        /*! \brief Gets the closure of one attribute
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet Every attribute that \p attributeId determines, including itself
+        */
+        attribute::AttributeSet getClosure(const us attributeId) const;
+
+        /*! \brief Checks if one attribute determines another
+            \param[in] determinant The identifier of the attribute on the left
+            \param[in] dependent The identifier of the attribute on the right
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p dependent is in the closure of \p determinant
+        */
+        bool determines(const us determinant, const us dependent) const;
+
+        /*! \brief Checks if one attribute is a superkey of the schema on its own
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the closure of \p attributeId holds every attribute
+        */
+        bool isSuperkey(const us attributeId) const;
+
+        /*! \brief Checks if some other attribute determines an attribute
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p attributeId is in the closure of an attribute other than itself
+        */
+        bool isDetermined(const us attributeId) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Adds an attribute to a row of #rows
+            \param[in] row The attribute whose row is changed
+            \param[in] attributeId The attribute to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addToRow(const us row, const us attributeId);
+
+        /*! \brief Closes #rows transitively, adding row K to every row that holds K one word at a time
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void propagate();
+
+        /*! \brief Applies the dependencies with several attributes on the left to every row holding their left hand side
+            \param[in] store The dependencies the closures are computed under
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If any row changed
+        */
+        bool applyCompositeDependencies(const store::DependencyStore &store);
+
+        std::vector<ul> rows;                         /*!< The closure of each attribute, #wordCount words per attribute */
+        attribute::AttributeSet singleAttributeKeys;  /*!< The attributes whose closure holds every attribute */
+        attribute::AttributeSet determinedAttributes; /*!< The attributes that are in the closure of some other attribute */
+        us attributeCount;                            /*!< The number of attributes in the schema */
+        std::size_t wordCount;                        /*!< The number of words in each row of #rows */
+    };
+}
@@ -0,0 +1,111 @@
+/*! \file dependencyComparator.h
+    \brief Header file for comparing two sets of functional dependencies.
+    \details Contains the function declarations for checking if two sets of functional dependencies over the same schema are equivalent and finding how they differ
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCalculator.h"
+
+namespace normalizer::dependencies::comparison
+{
+    /*! \headerfile dependencyComparator.h
+        \brief Compares an old and a new set of functional dependencies over the same schema by mutual implication
+        \details X -> Y of one set follows from the other set when Y is in the closure of X under the other set, so both sets are equivalent when every dependency of each follows from the other. Each closure stops as soon as it reaches the right hand side it is testing, so a dependency that still holds usually costs a few steps rather than a full closure. Only the attributes of a right hand side that do not follow are reported, which leaves out the parts that merely moved between dependencies.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyComparator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Compares \p inOldDependencies against \p inNewDependencies
+            \param[in] inOldDependencies The dependencies of the old version
+            \param[in] inNewDependencies The dependencies of the new version
+            \param[in] count The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyComparator(const std::vector<functional::FunctionalDependency> &inOldDependencies, const std::vector<functional::FunctionalDependency> &inNewDependencies, const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyComparator() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dependencies of the new version that the old version does not imply
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> Y for each new dependency X -> Z, where Y is the part of Z that does not follow from the old version
+        */
+        const std::vector<functional::FunctionalDependency> &getAddedDependencies() const;
+
+        /*! \brief Gets the dependencies of the old version that the new version does not imply
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> Y for each old dependency X -> Z, where Y is the part of Z that does not follow from the new version
+        */
+        const std::vector<functional::FunctionalDependency> &getRemovedDependencies() const;
+
+        /*! \brief Gets the dependencies of the new version that follow from its other dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The new dependencies that could be dropped one at a time without changing the new version
+        */
+        const std::vector<functional::FunctionalDependency> &getRedundantDependencies() const;
+
+        /* Member Functions */
+
+        /*! \brief Checks if both versions imply each other
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If no dependency was added or removed
+        */
+        bool isEquivalent() const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds the parts of \p dependencies that do not follow from the dependencies of \p calculator
+            \param[in] dependencies The dependencies to check
+            \param[in] calculator The calculator over the other version
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> Y for each X -> Z of \p dependencies with a non empty part Y of Z outside of the closure of X
+        */
+        static std::vector<functional::FunctionalDependency> findUnimplied(const std::vector<functional::FunctionalDependency> &dependencies, const closure::ClosureCalculator &calculator);
+
+        /*! \brief Finds the dependencies that follow from the rest of their own version
+            \param[in] calculator The calculator over the dependencies to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The dependencies whose right hand side is in the closure of their left hand side without them
+        */
+        static std::vector<functional::FunctionalDependency> findRedundant(const closure::ClosureCalculator &calculator);
+
+        std::vector<functional::FunctionalDependency> addedDependencies;     /*!< The parts of the new dependencies that do not follow from the old version */
+        std::vector<functional::FunctionalDependency> removedDependencies;   /*!< The parts of the old dependencies that do not follow from the new version */
+        std::vector<functional::FunctionalDependency> redundantDependencies; /*!< The new dependencies that follow from the rest of the new version */
+    };
+}
@@ -0,0 +1,63 @@
+/*! \file minimalCover.h
+    \brief Header file for computing a minimal cover.
+    \details Contains the function declarations for reducing a set of functional dependencies to a minimal cover
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCalculator.h"
+
+namespace normalizer::dependencies::cover
+{
+    /*! \headerfile minimalCover.h
+        \brief Reduces functional dependencies to an equivalent minimal cover
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class MinimalCover
+    {
+    public:
+        /* Static Functions */
+
+        /*! \brief Computes a minimal cover of \p functionalDependencies
+            \details Splits every right hand side into single attributes, removes extraneous left hand side attributes, drops redundant dependencies, and then merges the dependencies that share a left hand side
+            \param[in] functionalDependencies The dependencies to reduce
+            \param[in] attributeCount The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> A minimal cover of \p functionalDependencies
+        */
+        static std::vector<functional::FunctionalDependency> compute(const std::vector<functional::FunctionalDependency> &functionalDependencies, const us attributeCount);
+
+        /*! \brief Splits every dependency into dependencies with a single attribute on the right hand side
+            \details Trivial attributes, those on both sides of a dependency, are dropped
+            \param[in] functionalDependencies The dependencies to split
+            \param[in] attributeCount The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The split dependencies
+        */
+        static std::vector<functional::FunctionalDependency> splitDependents(const std::vector<functional::FunctionalDependency> &functionalDependencies, const us attributeCount);
+
+        /*! \brief Merges dependencies that share a left hand side, keeping the order each left hand side first appeared in
+            \param[in] functionalDependencies The dependencies to merge
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The merged dependencies
+        */
+        static std::vector<functional::FunctionalDependency> mergeDeterminants(const std::vector<functional::FunctionalDependency> &functionalDependencies);
+    };
+}
\ No newline at end of file
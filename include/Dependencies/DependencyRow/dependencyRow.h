@@ -54,7 +54,7 @@ namespace normalizer::dependencies::row
             \author Matthew Moore
             \return std::string The name of the dependency row
         */
-        std::string getRowName() const;
+        const std::string &getRowName() const;
 
         /*! \brief Gets the single valued functional dependencies
             \date 10/27/2023
@@ -62,7 +62,7 @@ namespace normalizer::dependencies::row
             \author Matthew Moore
             \return std::vector<std::string> The single valued functional dependencies
         */
-        std::vector<std::string> getSingleDependencies() const;
+        const std::vector<std::string> &getSingleDependencies() const;
 
         /*! \brief Gets the multi valued functional dependencies
             \date 10/27/2023
@@ -70,7 +70,7 @@ namespace normalizer::dependencies::row
             \author Matthew Moore
             \return std::vector<std::string> The multi valued functional dependencies
         */
-        std::vector<std::string> getMultiDependencies() const;
+        const std::vector<std::string> &getMultiDependencies() const;
 
         /* Member Functions */
 
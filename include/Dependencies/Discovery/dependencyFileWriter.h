@@ -0,0 +1,88 @@
+/*! \file dependencyFileWriter.h
+    \brief Header file for writing discovered dependencies as a dependency file.
+    \details Contains the function declarations for turning functional and multi valued dependencies into the syntax of the files in resources/dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile dependencyFileWriter.h
+        \brief Writes functional and multi valued dependencies in the syntax that \ref normalizer::interpreter::parser::Parser "Parser" reads
+        \details A dependency file only has a single row on the left hand side, so the dependencies with one row there are merged into one line per row and arrow, and the rest are kept aside to be reported instead. The primary key written is the smallest candidate key under every dependency, including the ones that could not be written.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyFileWriter
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Prepares \p dependencies to be written
+            \param[in] inDictionary The dictionary of the row names of the dependencies
+            \param[in] dependencies The dependencies to write
+            \param[in] multivaluedDependencies The multi valued dependencies to write, which all have one row on the left hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyFileWriter(const attribute::AttributeDictionary &inDictionary, const std::vector<functional::FunctionalDependency> &dependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies = {});
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyFileWriter() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the primary key written to the file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The smallest candidate key under the dependencies
+        */
+        const attribute::AttributeSet &getPrimaryKey() const;
+
+        /*! \brief Gets the dependencies that the syntax of a dependency file cannot hold
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The dependencies with an empty left hand side or more than one row on it
+        */
+        const std::vector<functional::FunctionalDependency> &getUnwrittenDependencies() const;
+
+        /* Member Functions */
+
+        /*! \brief Converts the dependencies into the text of a dependency file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string One line per row that determines other rows, then one per row that multi-determines other rows, followed by the KEY line
+        */
+        std::string toString() const;
+
+    private:
+        attribute::AttributeDictionary dictionary;                                      /*!< The dictionary of the row names of the dependencies */
+        std::vector<functional::FunctionalDependency> writtenDependencies;              /*!< The dependencies of each row that determines other rows, merged into one per row */
+        std::vector<functional::FunctionalDependency> unwrittenDependencies;            /*!< The dependencies with an empty left hand side or more than one row on it */
+        std::vector<multivalued::MultivaluedDependency> writtenMultivaluedDependencies; /*!< The multi valued dependencies of each row that multi-determines other rows, merged into one per row */
+        attribute::AttributeSet primaryKey;                                             /*!< The smallest candidate key under the dependencies */
+    };
+}
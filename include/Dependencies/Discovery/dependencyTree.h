@@ -0,0 +1,162 @@
+/*! \file dependencyTree.h
+    \brief Header file for a prefix tree of functional dependencies.
+    \details Contains the function declarations for storing candidate functional dependencies by their left hand sides, so the generalizations of a dependency can be found without scanning every dependency
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile dependencyTree.h
+        \brief A prefix tree of functional dependencies with single attribute right hand sides
+        \details Each node is a left hand side, reached from the root through its attributes in ascending order, and holds the right hand sides of its dependencies. Every node also holds the right hand sides of all the dependencies below it, so a search for the generalizations of X -> A only enters the children that are attributes of X and have A somewhere below them.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyTree
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyTree() : attributeCount(0) {}
+
+        /*! \brief Creates a tree with no dependencies
+            \param[in] count The number of attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyTree(const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyTree() {}
+
+        /* Member Functions */
+
+        /*! \brief Adds a dependency
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addDependency(const attribute::AttributeSet &determinant, const us dependent);
+
+        /*! \brief Removes a dependency
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void removeDependency(const attribute::AttributeSet &determinant, const us dependent);
+
+        /*! \brief Checks if the tree holds Y -> \p dependent for some Y that is a subset of \p determinant
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If a generalization of \p determinant -> \p dependent, or the dependency itself, is in the tree
+        */
+        bool containsGeneralization(const attribute::AttributeSet &determinant, const us dependent) const;
+
+        /*! \brief Removes every Y -> \p dependent where Y is a subset of \p determinant
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The left hand sides of the removed dependencies
+        */
+        std::vector<attribute::AttributeSet> removeGeneralizations(const attribute::AttributeSet &determinant, const us dependent);
+
+        /*! \brief Gets the dependencies whose left hand sides have a number of attributes
+            \param[in] level The number of attributes of the left hand sides
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::pair<AttributeSet, AttributeSet>> Each left hand side of \p level attributes with the right hand sides of its dependencies
+        */
+        std::vector<std::pair<attribute::AttributeSet, attribute::AttributeSet>> getLevel(const us level) const;
+
+        /*! \brief Gets the number of attributes of the largest left hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The depth of the tree
+        */
+        us getDepth() const;
+
+        /*! \brief Gets every dependency of the tree
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> One dependency per left hand side and attribute of its right hand side
+        */
+        std::vector<functional::FunctionalDependency> getDependencies() const;
+
+    private:
+        /*! \headerfile dependencyTree.h
+            \brief A left hand side of the tree
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        struct TreeNode
+        {
+            attribute::AttributeSet dependents;        /*!< The right hand sides of the dependencies of this left hand side */
+            attribute::AttributeSet subtreeDependents; /*!< The right hand sides of the dependencies of this node and every node below it, which may hold attributes that were since removed */
+            std::vector<std::pair<us, ui>> children;   /*!< The attribute and index of each child, in ascending order of attribute */
+        };
+
+        /* Member Functions */
+
+        /*! \brief Checks if the tree holds a generalization of \p determinant -> \p dependent at or below a node
+            \param[in] node The index of the node to search from
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If a generalization was found
+        */
+        bool containsGeneralization(const ui node, const attribute::AttributeSet &determinant, const us dependent) const;
+
+        /*! \brief Removes the generalizations of \p determinant -> \p dependent at or below a node
+            \param[in] node The index of the node to search from
+            \param[in] determinant The left hand side
+            \param[in] dependent The attribute of the right hand side
+            \param[in, out] path The left hand side of \p node
+            \param[in, out] removed The left hand sides of the removed dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void removeGeneralizations(const ui node, const attribute::AttributeSet &determinant, const us dependent, attribute::AttributeSet &path, std::vector<attribute::AttributeSet> &removed);
+
+        std::vector<TreeNode> nodes; /*!< The nodes of the tree, where the root is the first */
+        us attributeCount;           /*!< The number of attributes */
+    };
+}
@@ -0,0 +1,113 @@
+/*! \file externalDiscoverer.h
+    \brief Header file for discovering the functional dependencies of a CSV data file larger than memory.
+    \details Contains the function declarations for turning the minimal functional dependencies of a sample of the rows of a CSV data file into those of every row, one partition of the rows at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Discovery/dependencyTree.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Dependencies/Validation/externalDependencyValidator.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile externalDiscoverer.h
+        \brief Discovers the minimal functional dependencies of the rows of a CSV data file under a memory limit
+        \details Every dependency of the rows holds on any sample of them, so each minimal dependency of the rows has a generalization among the minimal dependencies of a sample. Those are checked level by level against every row by an \ref normalizer::dependencies::validation::ExternalDependencyValidator "ExternalDependencyValidator", and each one the rows break is replaced with the candidates one attribute larger, as \ref normalizer::dependencies::discovery::HybridDiscoverer "HybridDiscoverer" does after validating. ∅ -> A is checked by partitioning on A itself, since partitions by an empty key cannot be split. Each level reads the file once per left hand side, so a sample that misses many dependencies costs time rather than memory.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ExternalDiscoverer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a discoverer over the rows read by \p inPartitioner
+            \param[in] inPartitioner The partitioner of the rows of the CSV file, which must outlive the discoverer
+            \param[in] inDictionary The dictionary of the columns of the CSV file the dependencies are written over, which must outlive the discoverer
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ExternalDiscoverer(table::external::ExternalPartitioner &inPartitioner, const attribute::AttributeDictionary &inDictionary) : partitioner(inPartitioner), dictionary(inDictionary), validationCount(0), levelCount(0) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ExternalDiscoverer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of candidate dependencies validated by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of candidates checked against every row
+        */
+        ul getValidationCount() const;
+
+        /*! \brief Gets the number of levels validated by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of sizes of left hand sides that had candidates to check against every row
+        */
+        us getLevelCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Finds every minimal non trivial functional dependency that holds on the rows
+            \param[in] sampleDependencies The minimal exact dependencies of a sample of the rows
+            \throws std::invalid_argument If the CSV file has no column for an attribute of the dependencies
+            \throws std::filesystem::filesystem_error If the CSV file cannot be read or a partition cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> A for each single attribute A and smallest X that determines it, where an empty X means A is constant, ordered by the size of X, then X, then A
+        */
+        std::vector<functional::FunctionalDependency> discover(const std::vector<functional::FunctionalDependency> &sampleDependencies);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Checks if a column holds one value on every row
+            \param[in] column The column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If ∅ -> \p column holds on the rows
+        */
+        bool isConstant(const us column);
+
+        /*! \brief Replaces a failed candidate with the candidates one attribute larger that no remaining candidate generalizes
+            \param[in] determinant The left hand side of the failed candidate
+            \param[in] dependent The right hand side of the failed candidate
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void specialize(const attribute::AttributeSet &determinant, const us dependent);
+
+        table::external::ExternalPartitioner &partitioner; /*!< The partitioner of the rows of the CSV file */
+        const attribute::AttributeDictionary &dictionary;  /*!< The dictionary of the columns of the CSV file */
+        DependencyTree candidates;                         /*!< The candidate dependencies not yet disproved */
+        ul validationCount;                                /*!< The number of candidates validated by the last discovery */
+        us levelCount;                                     /*!< The number of levels validated by the last discovery */
+    };
+}
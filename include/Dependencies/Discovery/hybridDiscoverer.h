@@ -0,0 +1,169 @@
+/*! \file hybridDiscoverer.h
+    \brief Header file for discovering the functional dependencies of a wide table by sampling and validating.
+    \details Contains the function declarations for finding every minimal functional dependency of a table instance by alternating between comparing sampled pairs of rows and validating candidate dependencies against every row
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Discovery/strippedPartition.h"
+#include "Dependencies/Discovery/dependencyTree.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile hybridDiscoverer.h
+        \brief Discovers the minimal functional dependencies of a table instance in the style of HyFD
+        \details The attributes two rows agree on show that no subset of them determines any other attribute. Sampling compares rows that are close together in the groups of each column, widening the window of the column that keeps finding new agree sets, and stops once no column finds enough per comparison. Every agree set then removes the candidates it disproves from a \ref normalizer::dependencies::discovery::DependencyTree "DependencyTree" that starts from ∅ -> A, replacing each with the candidates one attribute larger. Validation then checks the candidates level by level against every row, splitting each level across threads. When too many candidates of a level fail, the rows that disproved them are compared and sampling resumes, since sampling is the cheaper way to remove wrong candidates. The lattice is never built, so the cost follows the number of dependencies rather than the number of columns.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class HybridDiscoverer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a discoverer over the rows of \p inInstance
+            \param[in] inInstance The rows of the table, which must outlive the discoverer
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        HybridDiscoverer(const table::instance::TableInstance &inInstance);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~HybridDiscoverer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dictionary of the column names of the table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeDictionary The identifier of each column, in the order of the columns
+        */
+        const attribute::AttributeDictionary &getAttributeDictionary() const;
+
+        /*! \brief Gets the number of pairs of rows compared by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of pairs of rows compared while sampling
+        */
+        ul getComparisonCount() const;
+
+        /*! \brief Gets the number of candidate dependencies validated by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of candidates checked against every row
+        */
+        ul getValidationCount() const;
+
+        /*! \brief Gets the number of times the last discovery went back from validating to sampling
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of levels after which too many candidates failed
+        */
+        us getSamplingRoundCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Finds every minimal non trivial functional dependency that holds on the rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> A for each single attribute A and smallest X that determines it, where an empty X means A is constant, ordered by the size of X, then X, then A
+        */
+        std::vector<functional::FunctionalDependency> discover();
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Compares rows within the groups of each column, widening the window of the column that finds the most new agree sets per comparison until none finds enough
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void sample();
+
+        /*! \brief Compares every pair of rows a window apart in the groups of a column
+            \param[in] column The column
+            \param[in] window The distance between the rows of each pair
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return double The number of new agree sets per comparison
+        */
+        double compareWindow(const us column, const ui window);
+
+        /*! \brief Compares two rows, keeping the attributes they agree on if they were not seen before
+            \param[in] first The first row
+            \param[in] second The second row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the agree set of the rows is new
+        */
+        bool compareRows(const ui first, const ui second);
+
+        /*! \brief Removes the candidates that the new agree sets disprove, replacing them with the candidates one attribute larger
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void induce();
+
+        /*! \brief Replaces a failed candidate with the candidates one attribute larger that no remaining candidate generalizes
+            \param[in] determinant The left hand side of the failed candidate
+            \param[in] dependent The right hand side of the failed candidate
+            \param[in] excluded The attributes not to add, which always include \p determinant and \p dependent
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void specialize(const attribute::AttributeSet &determinant, const us dependent, const attribute::AttributeSet &excluded);
+
+        /*! \brief Checks every candidate of a level against every row, replacing the ones that fail
+            \param[in] level The number of attributes of the left hand sides to check
+            \param[out] failedCount The number of candidates that failed
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::pair<ui, ui>> A pair of rows that disproved each failed candidate
+        */
+        std::vector<std::pair<ui, ui>> validateLevel(const us level, ul &failedCount);
+
+        const table::instance::TableInstance &instance;                                     /*!< The rows of the table */
+        attribute::AttributeDictionary dictionary;                                          /*!< The identifier of each column */
+        std::vector<StrippedPartition> partitions;                                          /*!< The partition of the rows on each column */
+        DependencyTree candidates;                                                          /*!< The candidate dependencies not yet disproved */
+        std::unordered_set<attribute::AttributeSet, attribute::AttributeSetHash> agreeSets; /*!< Every agree set seen so far */
+        std::vector<attribute::AttributeSet> newAgreeSets;                                  /*!< The agree sets not yet used to remove candidates */
+        std::vector<ui> windows;                                                            /*!< The last window compared in each column */
+        std::vector<double> efficiencies;                                                   /*!< The new agree sets per comparison of the last window of each column */
+        double efficiencyThreshold;                                                         /*!< The fewest new agree sets per comparison worth sampling for */
+        ul comparisonCount;                                                                 /*!< The number of pairs of rows compared by the last discovery */
+        ul validationCount;                                                                 /*!< The number of candidates validated by the last discovery */
+        us samplingRoundCount;                                                              /*!< The number of times the last discovery went back to sampling */
+    };
+}
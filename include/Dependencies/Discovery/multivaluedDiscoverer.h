@@ -0,0 +1,118 @@
+/*! \file multivaluedDiscoverer.h
+    \brief Header file for discovering the multi valued dependencies that hold on the rows of a table.
+    \details Contains the function declarations for finding the multi valued dependencies of a table instance that its functional dependencies do not already imply
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Closure/closureCalculator.h"
+#include "Dependencies/Discovery/strippedPartition.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile multivaluedDiscoverer.h
+        \brief Discovers the multi valued dependencies A ->> B of a table instance, where A and B are single columns
+        \details A ->> B holds when the rows of every group of A are the cross product of their values of B and their values of every other column Z, which is when the group has as many distinct rows as distinct values of B times distinct values of Z. Each row is given an identifier for its whole tuple, and one for its tuple without each column, so the three counts of a group are found with one pass over its rows. A column that is a superkey under the functional dependencies multi-determines everything, and A ->> B is implied when A -> B holds or when every other column is determined by A, so none of those are tested. The tests of the remaining pairs of columns are split across threads.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class MultivaluedDiscoverer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a discoverer over the rows of \p inInstance
+            \param[in] inInstance The rows of the table, which must outlive the discoverer
+            \param[in] inFunctionalDependencies The functional dependencies that hold on the rows, used to skip the implied multi valued dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        MultivaluedDiscoverer(const table::instance::TableInstance &inInstance, const std::vector<functional::FunctionalDependency> &inFunctionalDependencies);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~MultivaluedDiscoverer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dictionary of the column names of the table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeDictionary The identifier of each column, in the order of the columns
+        */
+        const attribute::AttributeDictionary &getAttributeDictionary() const;
+
+        /*! \brief Gets the number of candidates tested against the rows by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of candidates that the functional dependencies did not rule out
+        */
+        ul getTestCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Finds every multi valued dependency between single columns that holds on the rows and is not implied by the functional dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<MultivaluedDependency> A ->> B ordered by A, then B
+        */
+        std::vector<multivalued::MultivaluedDependency> discover();
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Combines two identifiers of each row into one
+            \param[in] first The first identifier of each row
+            \param[in] second The second identifier of each row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The identifier of each row, equal for rows whose identifiers are both equal
+        */
+        std::vector<ui> combineIdentifiers(const std::vector<ui> &first, const std::vector<ui> &second) const;
+
+        /*! \brief Checks if a column multi-determines \p dependent on the rows
+            \param[in] determinant The partition of the rows on the column of the left hand side
+            \param[in] dependent The column on the right hand side
+            \param[in, out] seenStamps Three scratch arrays of one entry per row, for the values of \p dependent, the tuples without it and the whole tuples
+            \param[in, out] stamp The last stamp written to \p seenStamps
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If every group of \p determinant is the cross product of its values of \p dependent and of the other columns
+        */
+        bool holds(const StrippedPartition &determinant, const us dependent, std::vector<std::vector<ui>> &seenStamps, ui &stamp) const;
+
+        const table::instance::TableInstance &instance;                       /*!< The rows of the table */
+        attribute::AttributeDictionary dictionary;                            /*!< The identifier of each column */
+        std::vector<functional::FunctionalDependency> functionalDependencies; /*!< The functional dependencies that hold on the rows */
+        std::vector<std::vector<ui>> rowsWithout;                             /*!< The identifier of each row's tuple without each column */
+        std::vector<ui> wholeRows;                                            /*!< The identifier of each row's whole tuple */
+        ul testCount;                                                         /*!< The number of candidates tested by the last discovery */
+    };
+}
@@ -0,0 +1,143 @@
+/*! \file strippedPartition.h
+    \brief Header file for the stripped partition of the rows of a table.
+    \details Contains the function declarations for grouping the rows of a table that agree on a set of attributes, leaving out the rows that agree with no other row
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "aliases.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile strippedPartition.h
+        \brief The groups of rows that agree on a set of attributes, without the groups of one row
+        \details A group of one row can never show two rows disagreeing, so dropping it loses nothing. X -> A holds when the partition of X has the same error count as the partition of X ∪ {A}, and the partition of X ∪ Y is the product of the partitions of X and Y, so each set of attributes only costs one pass over the rows of two smaller partitions. The groups are stored back to back in #rows.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class StrippedPartition
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        StrippedPartition() : classOffsets(1, 0), rowCount(0) {}
+
+        /*! \brief Creates the partition of the empty set, where every row agrees with every other
+            \param[in] count The number of rows of the table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        StrippedPartition(const ui count);
+
+        /*! \brief Creates the partition of a single column
+            \param[in] column The value identifier of the column in each row
+            \param[in] distinctCount The number of distinct values of the column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        StrippedPartition(const std::vector<ui> &column, const ui distinctCount);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~StrippedPartition() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of rows of the table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of rows of the table, including the ones in no group
+        */
+        ui getRowCount() const;
+
+        /*! \brief Gets the number of groups
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of groups of more than one row
+        */
+        ui getClassCount() const;
+
+        /*! \brief Gets the rows of every group
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The rows of each group, one group after the other
+        */
+        const std::vector<ui> &getRows() const;
+
+        /*! \brief Gets where each group starts in #rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The offset of each group in #rows, followed by the size of #rows
+        */
+        const std::vector<ui> &getClassOffsets() const;
+
+        /*! \brief Gets the number of rows that would have to be removed for the attributes to be a superkey
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The rows in groups minus the number of groups
+        */
+        ui getErrorCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Checks if no two rows agree on the attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the attributes are a superkey of the rows
+        */
+        bool isUnique() const;
+
+        /*! \brief Gets the partition of the union of the attributes of two partitions
+            \pre \p probeTable must hold #getRowCount entries that are all #NO_CLASS, and is left that way
+            \param[in] other The partition of the other attributes
+            \param[in, out] probeTable The group of each row of this partition while the product is built
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return StrippedPartition The partition where two rows agree when they agree in both partitions
+        */
+        StrippedPartition multiply(const StrippedPartition &other, std::vector<ui> &probeTable) const;
+
+        /*! \brief Gets the fewest rows to remove so that no group of this partition is split by a finer partition, which is the g3 error of X -> A in rows when this partition is on X and \p refined is on X ∪ {A}
+            \pre \p refined must be finer than this partition, and \p probeTable must hold #getRowCount entries that are all #NO_CLASS, and is left that way
+            \param[in] refined The partition on more attributes
+            \param[in, out] probeTable The group of each row of \p refined while the groups are counted
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The rows of each group outside its largest group of \p refined, summed over the groups
+        */
+        ui countViolations(const StrippedPartition &refined, std::vector<ui> &probeTable) const;
+
+        static constexpr ui NO_CLASS = std::numeric_limits<ui>::max(); /*!< The entry of #multiply's probe table for a row in no group */
+
+    private:
+        std::vector<ui> rows;         /*!< The rows of each group, one group after the other */
+        std::vector<ui> classOffsets; /*!< The offset of each group in #rows, followed by the size of #rows */
+        ui rowCount;                  /*!< The number of rows of the table */
+    };
+}
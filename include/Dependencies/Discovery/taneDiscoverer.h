@@ -0,0 +1,146 @@
+/*! \file taneDiscoverer.h
+    \brief Header file for discovering the functional dependencies that hold on the rows of a table.
+    \details Contains the function declarations for finding every minimal functional dependency of a table instance with a level by level search of its attribute sets
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Discovery/strippedPartition.h"
+#include "Dependencies/Discovery/dependencyTree.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /*! \headerfile taneDiscoverer.h
+        \brief Discovers the minimal functional dependencies of a table instance with the TANE algorithm
+        \details Level k of the search holds attribute sets of k attributes, each with its stripped partition and the right hand sides that could still make a minimal dependency with a subset of it, called C+. X - {A} -> A is tested only for A in C+(X), by comparing the error counts of the partitions of X - {A} and X. With an error threshold, a dependency that fails is scored by its g3 error, the fewest rows to remove for it to hold, counted from the same two partitions, and only A leaves C+ when it holds approximately. A set whose C+ is empty or which is a superkey is dropped, so none of its supersets are ever built. The partitions of a level are products of pairs of sets of the level below that share all but their last attribute. The products and tests of a level are split across threads, while the sets are kept in a fixed order so the dependencies found never depend on the thread count.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class TaneDiscoverer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a discoverer over the rows of \p inInstance
+            \param[in] inInstance The rows of the table, which must outlive the discoverer
+            \param[in] inMaxError The largest share of the rows that may be removed for a dependency to still count as holding, where 0 finds only exact dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TaneDiscoverer(const table::instance::TableInstance &inInstance, const double inMaxError = 0);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~TaneDiscoverer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dictionary of the column names of the table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeDictionary The identifier of each column, in the order of the columns
+        */
+        const attribute::AttributeDictionary &getAttributeDictionary() const;
+
+        /*! \brief Gets the number of levels searched by the last discovery
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The size of the largest attribute sets whose partitions were built
+        */
+        us getLevelCount() const;
+
+        /*! \brief Gets the number of rows that violate a dependency found by the last discovery
+            \param[in] dependency A dependency returned by #discover
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The fewest rows to remove for \p dependency to hold exactly, which is 0 for an exact dependency or one that was not found
+        */
+        ui getViolationCount(const functional::FunctionalDependency &dependency) const;
+
+        /* Member Functions */
+
+        /*! \brief Finds every minimal non trivial functional dependency that holds on the rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> X -> A for each single attribute A and smallest X that determines it, where an empty X means A is constant, ordered by the size of X, then X, then A
+        */
+        std::vector<functional::FunctionalDependency> discover();
+
+    private:
+        /*! \headerfile taneDiscoverer.h
+            \brief An attribute set of one level of the search
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        struct LatticeNode
+        {
+            attribute::AttributeSet attributes;                                 /*!< The attribute set */
+            StrippedPartition partition;                                        /*!< The partition of the rows on #attributes, dropped once the dependencies of the next level are tested */
+            ui errorCount;                                                      /*!< The error count of #partition */
+            attribute::AttributeSet rhsCandidates;                              /*!< C+ of #attributes, the right hand sides still possible for a minimal dependency with a subset of #attributes */
+            std::vector<std::pair<functional::FunctionalDependency, ui>> found; /*!< The dependencies found while computing #rhsCandidates, with the number of rows that violate each */
+        };
+
+        /* Member Functions */
+
+        /*! \brief Sets C+ of each node of a level and tests the dependencies it allows
+            \param[in, out] level The nodes of the current level
+            \param[in] previousLevel The nodes of the level below, after pruning
+            \param[in] previousIndex The index of each attribute set of \p previousLevel
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void computeDependencies(std::vector<LatticeNode> &level, const std::vector<LatticeNode> &previousLevel, const std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> &previousIndex) const;
+
+        /*! \brief Drops the nodes of a level with an empty C+ and the superkeys, finding the dependencies of each superkey first
+            \param[in, out] level The nodes of the current level
+            \param[in, out] dependencies The dependencies found so far, which the dependencies of the superkeys are added to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void prune(std::vector<LatticeNode> &level, DependencyTree &dependencies);
+
+        /*! \brief Builds the next level from the pairs of nodes that share all but their last attribute
+            \param[in] level The nodes of the current level, after pruning
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<LatticeNode> The nodes of the next level, with their partitions
+        */
+        std::vector<LatticeNode> generateNextLevel(const std::vector<LatticeNode> &level) const;
+
+        const table::instance::TableInstance &instance;                 /*!< The rows of the table */
+        attribute::AttributeDictionary dictionary;                      /*!< The identifier of each column */
+        double maxError;                                                /*!< The largest share of the rows that may violate a dependency found */
+        std::map<functional::FunctionalDependency, ui> violationCounts; /*!< The number of rows that violate each dependency found by the last discovery */
+        us levelCount;                                                  /*!< The number of levels searched by the last discovery */
+    };
+}
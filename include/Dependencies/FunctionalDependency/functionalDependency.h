@@ -0,0 +1,135 @@
+/*! \file functionalDependency.h
+    \brief Header file for creating a functional dependency.
+    \details Contains the function declarations for creating a functional dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+
+namespace normalizer::dependencies::functional
+{
+    /*! \headerfile functionalDependency.h
+        \brief A functional dependency X -> Y where X and Y are sets of attributes
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class FunctionalDependency
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        FunctionalDependency() {}
+
+        /*! \brief Creates the functional dependency \p lhs -> \p rhs
+            \param[in] lhs The attributes that determine \p rhs
+            \param[in] rhs The attributes determined by \p lhs
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        FunctionalDependency(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs);
+
+        /*! \brief Copy constructor
+            \param[in] other The functional dependency to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        FunctionalDependency(const FunctionalDependency &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~FunctionalDependency() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the attributes on the left hand side of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The determining attributes
+        */
+        const attribute::AttributeSet &getDeterminant() const;
+
+        /*! \brief Gets the attributes on the right hand side of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The dependent attributes
+        */
+        const attribute::AttributeSet &getDependent() const;
+
+        /* Member Functions */
+
+        /*! \brief Converts the dependency into the dependency file syntax
+            \param[in] dictionary The dictionary holding the row names of the attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The dependency written as it would be in a dependency file
+        */
+        std::string toString(const attribute::AttributeDictionary &dictionary) const;
+
+        /* Operator Overloads */
+
+        /*! \brief Copy assignment
+            \param[in] other The functional dependency to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return FunctionalDependency The updated functional dependency
+        */
+        FunctionalDependency &operator=(const FunctionalDependency &other);
+
+        /*! \brief Checks to see if two functional dependencies are equal
+            \param[in] other The functional dependency to compare to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the two functional dependencies are equal
+        */
+        bool operator==(const FunctionalDependency &other) const;
+
+        /*! \brief Orders functional dependencies by the size of their left hand side, then its attributes, then the attributes of their right hand side
+            \param[in] other The functional dependency to compare to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If this dependency comes before \p other
+        */
+        bool operator<(const FunctionalDependency &other) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Walks two attribute sets in ascending order until they differ
+            \param[in] first The first attribute set
+            \param[in] second The second attribute set
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::pair<us, us> The first attribute of each set that the other does not have at the same position, or the attribute count for a set that ran out
+        */
+        static std::pair<us, us> findFirstDifference(const attribute::AttributeSet &first, const attribute::AttributeSet &second);
+
+        attribute::AttributeSet determinant; /*!< The left hand side of the dependency */
+        attribute::AttributeSet dependent;   /*!< The right hand side of the dependency */
+    };
+}
\ No newline at end of file
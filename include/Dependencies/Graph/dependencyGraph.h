@@ -0,0 +1,128 @@
+/*! \file dependencyGraph.h
+    \brief Header file for the attribute graph of a set of functional dependencies.
+    \details Contains the function declarations for building a directed graph between attributes from functional dependencies and condensing it into groups of attributes that determine each other
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/Store/dependencyStore.h"
+
+namespace normalizer::dependencies::graph
+{
+    /*! \headerfile dependencyGraph.h
+        \brief Groups the attributes that determine each other
+        \details Every dependency A -> B with one attribute on the left gives an edge from A to each attribute of B, stored in compressed sparse row arrays. The strongly connected components of the graph, found with an iterative version of the algorithm of Tarjan, are groups of attributes that all determine each other, like A -> B with B -> A. Any one attribute of a group can stand in for the others, so a group can be treated as one attribute when searching for keys.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyGraph
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyGraph() : attributeCount(0) {}
+
+        /*! \brief Builds the graph of the dependencies of \p store and finds its components
+            \param[in] store The dependencies to build the graph from
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        explicit DependencyGraph(const store::DependencyStore &store);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyGraph() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the schema
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the strongly connected components of the graph
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The groups of attributes that determine each other, with every group after the groups it determines
+        */
+        const std::vector<attribute::AttributeSet> &getComponents() const;
+
+        /*! \brief Gets the attributes that an attribute has an edge to
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const us> The attributes that \p attributeId determines through one dependency
+        */
+        std::span<const us> getSuccessors(const us attributeId) const;
+
+        /* Member Functions */
+
+        /*! \brief Gets the index of the component of an attribute
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The index of the component of \p attributeId in #components
+        */
+        ui getComponentIndex(const us attributeId) const;
+
+        /*! \brief Gets the attributes that determine each other with an attribute
+            \param[in] attributeId The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The component of \p attributeId, which holds \p attributeId itself
+        */
+        const attribute::AttributeSet &getEquivalentAttributes(const us attributeId) const;
+
+        /*! \brief Checks if any attributes determine each other
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If some component holds more than one attribute
+        */
+        bool hasCycles() const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds #components and #componentIndexes with an iterative version of the algorithm of Tarjan
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void findComponents();
+
+        std::vector<ui> edgeOffsets;                     /*!< Where the edges of each attribute start in #edges, with one extra entry for the end */
+        std::vector<us> edges;                           /*!< The attributes each attribute determines on its own */
+        std::vector<attribute::AttributeSet> components; /*!< The groups of attributes that determine each other */
+        std::vector<ui> componentIndexes;                /*!< The index of the component of each attribute in #components */
+        us attributeCount;                               /*!< The number of attributes in the schema */
+    };
+}
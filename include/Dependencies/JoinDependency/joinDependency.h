@@ -0,0 +1,104 @@
+/*! \file joinDependency.h
+    \brief Header file for creating a join dependency.
+    \details Contains the function declarations for creating a join dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+
+namespace normalizer::dependencies::join
+{
+    /*! \headerfile joinDependency.h
+        \brief A join dependency *(R1, ..., Rn) stating that a relation over R1 ∪ ... ∪ Rn is the join of its projections onto each Ri
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class JoinDependency
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        JoinDependency() {}
+
+        /*! \brief Creates the join dependency *(\p inComponents)
+            \param[in] inComponents The attributes of each projection
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        JoinDependency(const std::vector<attribute::AttributeSet> &inComponents);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~JoinDependency() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the attributes of each projection
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The components of the dependency
+        */
+        const std::vector<attribute::AttributeSet> &getComponents() const;
+
+        /*! \brief Gets the attributes the dependency is over
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The union of the components
+        */
+        const attribute::AttributeSet &getAttributes() const;
+
+        /* Member Functions */
+
+        /*! \brief Checks if the dependency holds in every relation over its attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If some component holds every attribute of the dependency
+        */
+        bool isTrivial() const;
+
+        /*! \brief Converts the dependency into the dependency file syntax
+            \param[in] dictionary The dictionary holding the row names of the attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The dependency written as it would be in a dependency file
+        */
+        std::string toString(const attribute::AttributeDictionary &dictionary) const;
+
+        /* Operator Overloads */
+
+        /*! \brief Checks to see if two join dependencies are equal
+            \param[in] other The join dependency to compare to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the two join dependencies have the same components in the same order
+        */
+        bool operator==(const JoinDependency &other) const;
+
+    private:
+        std::vector<attribute::AttributeSet> components; /*!< The attributes of each projection */
+        attribute::AttributeSet attributes;              /*!< The union of #components */
+    };
+}
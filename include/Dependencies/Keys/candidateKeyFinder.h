@@ -0,0 +1,126 @@
+/*! \file candidateKeyFinder.h
+    \brief Header file for finding the candidate keys of a relation.
+    \details Contains the function declarations for enumerating the candidate keys of a relation from its functional dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Graph/dependencyGraph.h"
+
+namespace normalizer::dependencies::keys
+{
+    /*! \headerfile candidateKeyFinder.h
+        \brief Finds the candidate keys of a relation
+        \details Uses the algorithm of Lucchesi and Osborn, which takes time polynomial in the number of keys. Starting from one key, every key K and dependency X -> Y of the relation give the superkey X ∪ (K - Y), which is shrunk to a new key unless it already holds a known one. Closures come from a shared cache, so the same superkey tests are never repeated. Attributes of the relation that determine each other are condensed into one attribute first, since a key holds at most one of them and any of them can stand in for the rest, and the keys found are expanded back afterwards.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class CandidateKeyFinder
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a finder over the dependencies of \p inClosureCache
+            \param[in, out] inClosureCache The cache of closures under the dependencies of the whole schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        CandidateKeyFinder(closure::ClosureCache &inClosureCache);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~CandidateKeyFinder() {}
+
+        /* Member Functions */
+
+        /*! \brief Finds every candidate key of the whole schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of the whole schema
+        */
+        std::vector<attribute::AttributeSet> findCandidateKeys();
+
+        /*! \brief Finds every candidate key of a relation
+            \param[in] relation The attributes of the relation
+            \param[in] relationDependencies A cover of the dependencies that hold on \p relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of \p relation
+        */
+        std::vector<attribute::AttributeSet> findCandidateKeys(const attribute::AttributeSet &relation, const std::vector<functional::FunctionalDependency> &relationDependencies);
+
+        /*! \brief Finds every candidate key of the whole schema, starting from superkeys that are already known
+            \details Each superkey is shrunk into a candidate key first, so only the pairs of keys and dependencies that are not already covered by those keys are expanded. A change to the dependencies can reuse the keys from before it this way, as long as they are still superkeys.
+            \param[in] superkeys Superkeys of the whole schema, which may be empty
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of the whole schema
+        */
+        std::vector<attribute::AttributeSet> completeCandidateKeys(const std::vector<attribute::AttributeSet> &superkeys);
+
+        /*! \brief Checks if a set of attributes determines every attribute of a relation
+            \param[in] attributes The attributes to check
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p relation is in the closure of \p attributes
+        */
+        bool isSuperkey(const attribute::AttributeSet &attributes, const attribute::AttributeSet &relation);
+
+        /*! \brief Shrinks a superkey of a relation into a candidate key
+            \param[in] superkey A superkey of \p relation
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet A candidate key of \p relation that is a subset of \p superkey
+        */
+        attribute::AttributeSet minimizeSuperkey(const attribute::AttributeSet &superkey, const attribute::AttributeSet &relation);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds every candidate key of a relation with the algorithm of Lucchesi and Osborn
+            \param[in] relation The attributes of the relation
+            \param[in] relationDependencies A cover of the dependencies that hold on \p relation
+            \param[in] candidateKeys Some candidate keys of \p relation to start from, which must not be empty
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of \p relation
+        */
+        std::vector<attribute::AttributeSet> enumerateKeys(const attribute::AttributeSet &relation, const std::vector<functional::FunctionalDependency> &relationDependencies, std::vector<attribute::AttributeSet> candidateKeys);
+
+        /*! \brief Replaces every attribute of \p relation in \p attributes by the first attribute of \p relation that it determines each other with
+            \param[in] attributes The attributes to condense
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet \p attributes with one attribute in place of each group
+        */
+        attribute::AttributeSet condense(const attribute::AttributeSet &attributes, const attribute::AttributeSet &relation) const;
+
+        closure::ClosureCache &closureCache;    /*!< The shared cache of closures under the whole schema */
+        graph::DependencyGraph dependencyGraph; /*!< The groups of attributes that determine each other under the whole schema */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*! \file primeAttributeService.h
+    \brief Header file for answering prime attribute and superkey queries.
+    \details Contains the function declarations for finding the prime attributes of a schema and testing many attribute sets for being superkeys at once
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Store/dependencyStore.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+
+namespace normalizer::dependencies::keys
+{
+    /*! \headerfile primeAttributeService.h
+        \brief Finds the prime attributes of a schema and answers superkey queries in batches
+        \details An attribute is prime if it is in some candidate key, which is what 2NF and 3NF are defined over. Superkey queries are bit sliced: each attribute gets one word whose bits are the queries of a batch that reach it, so a dependency is applied to every query of the batch with a few word operations instead of one closure per query.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class PrimeAttributeService
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Finds the candidate keys and prime attributes of the whole schema of \p inClosureCache
+            \param[in, out] inClosureCache The cache of closures under the dependencies of the whole schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        PrimeAttributeService(closure::ClosureCache &inClosureCache);
+
+        /*! \brief Answers prime attribute and superkey queries from candidate keys that are already known
+            \param[in, out] inClosureCache The cache of closures under the dependencies of the whole schema
+            \param[in] inCandidateKeys Every candidate key of the whole schema under the dependencies of \p inClosureCache
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        PrimeAttributeService(closure::ClosureCache &inClosureCache, const std::vector<attribute::AttributeSet> &inCandidateKeys);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~PrimeAttributeService() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the candidate keys of the whole schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of the whole schema
+        */
+        const std::vector<attribute::AttributeSet> &getCandidateKeys() const;
+
+        /*! \brief Gets the attributes that are in some candidate key
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The prime attributes of the whole schema
+        */
+        const attribute::AttributeSet &getPrimeAttributes() const;
+
+        /* Member Functions */
+
+        /*! \brief Checks if an attribute is in some candidate key
+            \param[in] attributeId The attribute to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p attributeId is prime
+        */
+        bool isPrime(const us attributeId) const;
+
+        /*! \brief Checks which of \p queries are superkeys of the whole schema
+            \param[in] queries The attribute sets to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<bool> If each of \p queries is a superkey, in the same order
+        */
+        std::vector<bool> areSuperkeys(const std::vector<attribute::AttributeSet> &queries) const;
+
+        /*! \brief Checks which of \p queries determine every attribute of a relation
+            \param[in] queries The attribute sets to check
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<bool> If \p relation is in the closure of each of \p queries, in the same order
+        */
+        std::vector<bool> areSuperkeys(const std::vector<attribute::AttributeSet> &queries, const attribute::AttributeSet &relation) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds which queries of one batch determine every attribute of a relation
+            \param[in] queries The attribute sets to check
+            \param[in] first The index of the first query of the batch
+            \param[in] count The number of queries in the batch, at most #SUPERKEY_BATCH_SIZE
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul A word whose bit i is set if query \p first + i is a superkey of \p relation
+        */
+        ul findSuperkeyBatch(const std::vector<attribute::AttributeSet> &queries, const std::size_t first, const std::size_t count, const attribute::AttributeSet &relation) const;
+
+        const store::DependencyStore &dependencyStore;     /*!< The dependencies of the whole schema, as arrays of attribute identifiers */
+        std::vector<attribute::AttributeSet> candidateKeys; /*!< The candidate keys of the whole schema */
+        attribute::AttributeSet primeAttributes;            /*!< The union of #candidateKeys */
+        attribute::AttributeSet schema;                     /*!< Every attribute of the whole schema */
+    };
+}
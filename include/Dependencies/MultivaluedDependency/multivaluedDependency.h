@@ -0,0 +1,113 @@
+/*! \file multivaluedDependency.h
+    \brief Header file for creating a multi valued dependency.
+    \details Contains the function declarations for creating a multi valued dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+
+namespace normalizer::dependencies::multivalued
+{
+    /*! \headerfile multivaluedDependency.h
+        \brief A multi valued dependency X ->> Y where X and Y are sets of attributes
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class MultivaluedDependency
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        MultivaluedDependency() {}
+
+        /*! \brief Creates the multi valued dependency \p lhs ->> \p rhs
+            \param[in] lhs The attributes that multi-determine \p rhs
+            \param[in] rhs The attributes multi-determined by \p lhs
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        MultivaluedDependency(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs);
+
+        /*! \brief Copy constructor
+            \param[in] other The multi valued dependency to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        MultivaluedDependency(const MultivaluedDependency &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~MultivaluedDependency() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the attributes on the left hand side of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The determining attributes
+        */
+        const attribute::AttributeSet &getDeterminant() const;
+
+        /*! \brief Gets the attributes on the right hand side of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The dependent attributes
+        */
+        const attribute::AttributeSet &getDependent() const;
+
+        /* Member Functions */
+
+        /*! \brief Converts the dependency into the dependency file syntax
+            \param[in] dictionary The dictionary holding the row names of the attributes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The dependency written as it would be in a dependency file
+        */
+        std::string toString(const attribute::AttributeDictionary &dictionary) const;
+
+        /* Operator Overloads */
+
+        /*! \brief Copy assignment
+            \param[in] other The multi valued dependency to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return MultivaluedDependency The updated multi valued dependency
+        */
+        MultivaluedDependency &operator=(const MultivaluedDependency &other);
+
+        /*! \brief Checks to see if two multi valued dependencies are equal
+            \param[in] other The multi valued dependency to compare to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the two multi valued dependencies are equal
+        */
+        bool operator==(const MultivaluedDependency &other) const;
+
+    private:
+        attribute::AttributeSet determinant; /*!< The left hand side of the dependency */
+        attribute::AttributeSet dependent;   /*!< The right hand side of the dependency */
+    };
+}
\ No newline at end of file
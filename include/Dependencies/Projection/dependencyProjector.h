@@ -0,0 +1,93 @@
+/*! \file dependencyProjector.h
+    \brief Header file for projecting functional dependencies onto a sub-schema.
+    \details Contains the function declarations for finding the functional dependencies that hold on a subset of a table's rows
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Cover/minimalCover.h"
+
+namespace normalizer::dependencies::projection
+{
+    /*! \headerfile dependencyProjector.h
+        \brief Projects functional dependencies onto sub-schemas
+        \details Searches the left hand sides level by level, only over attributes that appear on the left hand side of some dependency, and skips any set that is a superset of a key of the sub-schema or holds an attribute implied by the rest of the set. Closures come from a shared \\ref normalizer::dependencies::closure::ClosureCache "ClosureCache", so projecting several tables of one decomposition, or one table from several passes, shares the work.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyProjector
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a projector over the dependencies of \p inClosureCache
+            \param[in, out] inClosureCache The cache of closures under the dependencies of the whole schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyProjector(closure::ClosureCache &inClosureCache);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyProjector() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of closures computed so far
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The number of closures in the shared cache
+        */
+        std::size_t getCachedClosureCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Projects the dependencies onto \p subSchema
+            \param[in] subSchema The attributes of the sub-schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> A minimal cover of the dependencies that hold on \p subSchema
+        */
+        std::vector<functional::FunctionalDependency> project(const attribute::AttributeSet &subSchema);
+
+        /*! \brief Gets the closure of \p attributes, computing it only if it is not already cached
+            \param[in] attributes The attributes to get the closure of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The closure of \p attributes under the whole schema
+        */
+        const attribute::AttributeSet &getClosure(const attribute::AttributeSet &attributes);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Checks if some attribute of \p attributes is implied by the others
+            \param[in] attributes The set to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If any attribute of \p attributes is in the closure of the rest of \p attributes
+        */
+        bool hasRedundantAttribute(const attribute::AttributeSet &attributes);
+
+        closure::ClosureCache &closureCache;           /*!< The shared cache of closures under the whole schema */
+        attribute::AttributeSet determinantAttributes; /*!< The attributes on the left hand side of at least one dependency */
+    };
+}
\ No newline at end of file
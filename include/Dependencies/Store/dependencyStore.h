@@ -0,0 +1,149 @@
+/*! \file dependencyStore.h
+    \brief Header file for creating a flat functional dependency store.
+    \details Contains the function declarations for storing functional dependencies in contiguous arrays of attribute identifiers, indexed by attribute
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+
+namespace normalizer::dependencies::store
+{
+    /*! \headerfile dependencyStore.h
+        \brief Stores functional dependencies in compressed sparse row arrays
+        \details The attributes of every left hand side are stored back to back in one array, with the start of each dependency's attributes in an offset array, and the same for every right hand side. Two indexes are stored the same way: the dependencies whose left hand side holds each attribute, and the dependencies that mention each attribute on either side. Every lookup is a view into one of these arrays, so nothing is allocated or copied.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyStore
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyStore();
+
+        /*! \brief Creates a store holding \p dependencies
+            \param[in] dependencies The functional dependencies to store
+            \param[in] count The number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyStore(const std::vector<functional::FunctionalDependency> &dependencies, const us count);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyStore() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of attributes in the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of attributes in the schema
+        */
+        us getAttributeCount() const;
+
+        /*! \brief Gets the number of dependencies in the store
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of dependencies in the store
+        */
+        ui getDependencyCount() const;
+
+        /*! \brief Gets the left hand side of a dependency
+            \param[in] index The index of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const us> The attributes on the left hand side of the dependency, in ascending order
+        */
+        std::span<const us> getDeterminant(const ui index) const;
+
+        /*! \brief Gets the right hand side of a dependency
+            \param[in] index The index of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const us> The attributes on the right hand side of the dependency, in ascending order
+        */
+        std::span<const us> getDependent(const ui index) const;
+
+        /*! \brief Gets the dependencies whose left hand side holds an attribute
+            \param[in] attributeId The attribute to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const ui> The indexes of the dependencies whose left hand side holds \p attributeId, in ascending order
+        */
+        std::span<const ui> getDependenciesWithDeterminant(const us attributeId) const;
+
+        /*! \brief Gets the dependencies that mention an attribute on either side
+            \param[in] attributeId The attribute to look up
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const ui> The indexes of the dependencies that mention \p attributeId, in ascending order
+        */
+        std::span<const ui> getDependenciesMentioning(const us attributeId) const;
+
+        /*! \brief Gets the dependencies with an empty left hand side
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::span<const ui> The indexes of the dependencies that hold in every closure, in ascending order
+        */
+        std::span<const ui> getDependenciesWithEmptyDeterminant() const;
+
+        /* Member Functions */
+
+        /*! \brief Converts a stored dependency back into a functional dependency
+            \param[in] index The index of the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return FunctionalDependency The dependency at \p index
+        */
+        functional::FunctionalDependency toFunctionalDependency(const ui index) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Builds #determinantIndex, #mentionIndex and #emptyDeterminantIndex from the stored dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void buildIndexes();
+
+        std::vector<ui> determinantOffsets;      /*!< Where the left hand side of each dependency starts in #determinantAttributes, with one extra entry for the end */
+        std::vector<us> determinantAttributes;   /*!< The left hand side attributes of every dependency */
+        std::vector<ui> dependentOffsets;        /*!< Where the right hand side of each dependency starts in #dependentAttributes, with one extra entry for the end */
+        std::vector<us> dependentAttributes;     /*!< The right hand side attributes of every dependency */
+        std::vector<ui> determinantIndexOffsets; /*!< Where the dependencies of each attribute start in #determinantIndex, with one extra entry for the end */
+        std::vector<ui> determinantIndex;        /*!< The dependencies whose left hand side holds each attribute */
+        std::vector<ui> mentionIndexOffsets;     /*!< Where the dependencies of each attribute start in #mentionIndex, with one extra entry for the end */
+        std::vector<ui> mentionIndex;            /*!< The dependencies that mention each attribute on either side */
+        std::vector<ui> emptyDeterminantIndex;   /*!< The dependencies with an empty left hand side */
+        us attributeCount;                       /*!< The number of attributes in the schema */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*! \file dependencyValidator.h
+    \brief Header file for checking declared functional dependencies against the rows of a table.
+    \details Contains the function declarations for finding the functional dependencies of a dependency file that the rows of a table break, with a pair of rows that shows it
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::dependencies::validation
+{
+    /*! \headerfile dependencyValidator.h
+        \brief A functional dependency that the rows of a table break
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct DependencyViolation
+    {
+        functional::FunctionalDependency dependency; /*!< The broken dependency */
+        ul groupCount;                               /*!< The number of groups of rows that agree on the determinant but not on the dependent */
+        ul firstRow;                                 /*!< The first row of the first such group */
+        ul secondRow;                                /*!< The first row of that group that disagrees with #firstRow on the dependent */
+        std::vector<std::string> firstValues;        /*!< The values of #firstRow on the determinant and dependent, in the order of their attributes */
+        std::vector<std::string> secondValues;       /*!< The values of #secondRow on the determinant and dependent, in the order of their attributes */
+    };
+
+    /*! \headerfile dependencyValidator.h
+        \brief Checks functional dependencies against the rows of a table
+        \details Each row is given the identifier of its group of rows on the determinant of a dependency, which for one column is the value identifier itself, and for more columns combines the identifiers one column at a time. The groups are numbered densely, so the first row of each group is found in an array rather than a hash table, and X -> Y is broken exactly when a row disagrees on Y with the first row of its group. Dependencies with the same determinant share its groups, and the determinants are split across threads.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyValidator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a validator over the rows of \p inInstance
+            \param[in] inInstance The rows of the table, which must outlive the validator
+            \param[in] dictionary The dictionary of the attributes the dependencies are written over
+            \throws std::invalid_argument If \p inInstance has no column for an attribute of \p dictionary
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyValidator(const table::instance::TableInstance &inInstance, const attribute::AttributeDictionary &dictionary);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyValidator() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the column of the rows that holds an attribute
+            \param[in] attribute The identifier of the attribute
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The index of the column of \p attribute in the rows
+        */
+        us getColumn(const us attribute) const;
+
+        /* Member Functions */
+
+        /*! \brief Finds the dependencies that the rows break
+            \param[in] dependencies The dependencies to check
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<DependencyViolation> Each broken dependency with a pair of rows that breaks it, in the order of \p dependencies
+        */
+        std::vector<DependencyViolation> validate(const std::vector<functional::FunctionalDependency> &dependencies) const;
+
+        /*! \brief Counts the groups of rows that agree on some attributes
+            \param[in] determinant The attributes to group the rows by
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of distinct values of the rows on \p determinant
+        */
+        ui countGroups(const attribute::AttributeSet &determinant) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Numbers the groups of rows that agree on some attributes
+            \param[in] determinant The attributes to group the rows by
+            \param[out] groupCount The number of groups
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The group of each row, numbered from 0 in the order the groups first appear
+        */
+        std::vector<ui> groupRows(const attribute::AttributeSet &determinant, ui &groupCount) const;
+
+        const table::instance::TableInstance &instance; /*!< The rows of the table */
+        std::vector<us> columns;                        /*!< The column of the rows of each attribute */
+    };
+}
@@ -0,0 +1,71 @@
+/*! \file externalDependencyValidator.h
+    \brief Header file for checking declared functional dependencies against the rows of a CSV data file larger than memory.
+    \details Contains the function declarations for finding the functional dependencies that the rows of a CSV data file break, one partition of the rows at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::dependencies::validation
+{
+    /*! \headerfile externalDependencyValidator.h
+        \brief Checks functional dependencies against the rows of a CSV data file under a memory limit
+        \details Two rows can only break X -> Y if they agree on X, so the rows are split into partitions by the hash of X, and each partition is checked on its own by a #DependencyValidator. Only the columns of X and of the dependents of X are read, and dependencies with the same determinant share its partitions. The groups that break a dependency are counted across the partitions, and the pair of rows reported is the one a check of every row at once would have found first.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ExternalDependencyValidator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a validator over the rows read by \p inPartitioner
+            \param[in] inPartitioner The partitioner of the rows of the CSV file, which must outlive the validator
+            \param[in] inDictionary The dictionary of the attributes the dependencies are written over, which must outlive the validator
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ExternalDependencyValidator(table::external::ExternalPartitioner &inPartitioner, const attribute::AttributeDictionary &inDictionary) : partitioner(inPartitioner), dictionary(inDictionary) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ExternalDependencyValidator() {}
+
+        /* Member Functions */
+
+        /*! \brief Finds the dependencies that the rows break
+            \param[in] dependencies The dependencies to check
+            \throws std::invalid_argument If the CSV file has no column for an attribute of the dependencies
+            \throws std::filesystem::filesystem_error If the CSV file cannot be read or a partition cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<DependencyViolation> Each broken dependency with a pair of rows that breaks it, in the order of \p dependencies
+        */
+        std::vector<DependencyViolation> validate(const std::vector<functional::FunctionalDependency> &dependencies) const;
+
+    private:
+        table::external::ExternalPartitioner &partitioner; /*!< The partitioner of the rows of the CSV file */
+        const attribute::AttributeDictionary &dictionary;  /*!< The dictionary of the attributes the dependencies are written over */
+    };
+}
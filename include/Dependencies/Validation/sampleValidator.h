@@ -0,0 +1,109 @@
+/*! \file sampleValidator.h
+    \brief Header file for checking functional dependencies against a uniform sample of the rows of a table.
+    \details Contains the function declarations for finding the functional dependencies that a sample of rows breaks, and bounding how often the rest of the rows could break the ones it does not
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::dependencies::validation
+{
+    /*! \headerfile sampleValidator.h
+        \brief A functional dependency checked on a sample of the rows of a table
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct DependencyEstimate
+    {
+        DependencyViolation violation; /*!< The dependency, with the number of groups of sampled rows that break it and a pair of them by their index in the table, where no groups means it holds on the sample */
+        ul repeatedRows;               /*!< The number of sampled rows that agree on the determinant with an earlier sampled row, each of which tests the dependency */
+        double brokenShareBound;       /*!< If it holds on the sample, the most, at #SAMPLE_CONFIDENCE, of the rows of the table agreeing on the determinant with an earlier row that break it, from 0 to 1 */
+        ul brokenPairBound;            /*!< If it is a key that holds on the sample, the most pairs of rows of the table, at #SAMPLE_CONFIDENCE, that break it, and 0 for any other dependency */
+    };
+
+    /*! \headerfile sampleValidator.h
+        \brief Checks functional dependencies against a uniform sample of the rows of a table
+        \details A dependency the sample breaks is broken for certain, and the pair of rows that shows it is reported by its index in the table. A dependency the sample does not break may still be broken by rows that were not sampled, so it is given two bounds that hold at #SAMPLE_CONFIDENCE. Each sampled row that agrees on the determinant with an earlier one is a trial that found no break, so after m such rows the share of breaking rows is under 1 - (1 - confidence)^(1/m), which is close to 3/m at 95%. A key is only broken by pairs of rows, and a sample of n of N rows holds each pair with probability q = n(n - 1) / (N(N - 1)), so fewer than ln(1 - confidence) / ln(1 - q) pairs break it. Both bounds treat the trials as independent, and both are 0 once the sample holds every row.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class SampleValidator
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a validator over a sample of the rows of a table
+            \param[in] inSample The sampled rows, which must outlive the validator
+            \param[in] inRowNumbers The index in the table of each sampled row
+            \param[in] inRowCount The number of rows of the table
+            \param[in] dictionary The dictionary of the attributes the dependencies are written over
+            \throws std::invalid_argument If \p inSample has no column for an attribute of \p dictionary
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        SampleValidator(const table::instance::TableInstance &inSample, const std::vector<ul> &inRowNumbers, const ul inRowCount, const attribute::AttributeDictionary &dictionary) : validator(inSample, dictionary), rowNumbers(inRowNumbers), sampleCount(inSample.getRowCount()), rowCount(inRowCount) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~SampleValidator() {}
+
+        /* Member Functions */
+
+        /*! \brief Checks dependencies against the sampled rows
+            \param[in] dependencies The dependencies to check
+            \param[in] keyCount The number of dependencies at the end of \p dependencies that each state a key, which are the only ones given a #DependencyEstimate::brokenPairBound
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<DependencyEstimate> The estimate of each dependency, in the order of \p dependencies
+        */
+        std::vector<DependencyEstimate> estimate(const std::vector<functional::FunctionalDependency> &dependencies, const std::size_t keyCount) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Bounds the share of the rows that break a dependency no sampled row breaks
+            \param[in] repeatedRows The number of sampled rows that test the dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return double The most, at #SAMPLE_CONFIDENCE, of the rows testing the dependency that break it, or 1 if no sampled row tests it
+        */
+        double boundBrokenShare(const ul repeatedRows) const;
+
+        /*! \brief Bounds the pairs of rows that break a dependency no pair of sampled rows breaks
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The most pairs of rows, at #SAMPLE_CONFIDENCE, that break the dependency
+        */
+        ul boundBrokenPairs() const;
+
+        DependencyValidator validator; /*!< The validator of the sampled rows */
+        std::vector<ul> rowNumbers;    /*!< The index in the table of each sampled row */
+        ul sampleCount;                /*!< The number of sampled rows */
+        ul rowCount;                   /*!< The number of rows of the table */
+    };
+}
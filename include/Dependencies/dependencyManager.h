@@ -12,6 +12,10 @@
 #include <vector>
 
 #include "DependencyRow/dependencyRow.h"
+#include "AttributeSet/attributeDictionary.h"
+#include "FunctionalDependency/functionalDependency.h"
+#include "MultivaluedDependency/multivaluedDependency.h"
+#include "JoinDependency/joinDependency.h"
 
 namespace normalizer::dependencies
 {
@@ -32,7 +36,15 @@ namespace normalizer::dependencies
             \author Matthew Moore
             \return std::vector<DependencyRow> The dependency rows of the table
         */
-        std::vector<row::DependencyRow> getDependencyRows() const;
+        const std::vector<row::DependencyRow> &getDependencyRows() const;
+
+        /*! \brief Gets the row names of the components of each declared join dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<std::vector<std::string>>> The row names of each component of each join dependency
+        */
+        const std::vector<std::vector<std::vector<std::string>>> &getJoinDependencyRows() const;
 
         /* Member Functions */
 
@@ -44,7 +56,44 @@ namespace normalizer::dependencies
         */
         void addDependency(const row::DependencyRow &row);
 
+        /*! \brief Adds a join dependency to the manager.
+            \param[in] components The row names of each component of the join dependency.
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addJoinDependency(const std::vector<std::vector<std::string>> &components);
+
+        /*! \brief Converts the single valued dependencies into functional dependencies over attribute identifiers
+            \param[in] dictionary The dictionary holding the identifiers of the row names
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> One functional dependency for each dependency row with single valued dependencies
+        */
+        std::vector<functional::FunctionalDependency> getFunctionalDependencies(const attribute::AttributeDictionary &dictionary) const;
+
+        /*! \brief Converts the multi valued dependencies into multi valued dependencies over attribute identifiers
+            \details Each multi valued dependency of a row is independent of the others, so row ->> (one, two) becomes row ->> one and row ->> two
+            \param[in] dictionary The dictionary holding the identifiers of the row names
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<MultivaluedDependency> One multi valued dependency for each multi valued dependency of each dependency row
+        */
+        std::vector<multivalued::MultivaluedDependency> getMultivaluedDependencies(const attribute::AttributeDictionary &dictionary) const;
+
+        /*! \brief Converts the declared join dependencies into join dependencies over attribute identifiers
+            \param[in] dictionary The dictionary holding the identifiers of the row names
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<JoinDependency> One join dependency for each declared join dependency
+        */
+        std::vector<join::JoinDependency> getJoinDependencies(const attribute::AttributeDictionary &dictionary) const;
+
     private:
-        std::vector<row::DependencyRow> dependencyRows; /*!< The dependencies of each row */
+        std::vector<row::DependencyRow> dependencyRows;                        /*!< The dependencies of each row */
+        std::vector<std::vector<std::vector<std::string>>> joinDependencyRows; /*!< The row names of each component of each join dependency */
     };
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+/*! \file csvReader.h
+    \brief Header file for reading the rows of a CSV data file.
+    \details Contains the function declarations for reading a CSV file with a header row into the rows of data of a table
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "aliases.h"
+#include "constants.h"
+#include "fileManager.h"
+#include "Table/table.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::file
+{
+    /*! \headerfile csvReader.h
+        \brief Reads a CSV file into the rows of data of a table
+        \details The first row names the columns. A value may be quoted to hold a separator or a line break, with a quote inside it written twice, and blank lines are skipped. The file is mapped into memory rather than copied, and its rows are split into chunks of about #CSV_CHUNK_BYTES that are parsed on their own threads, each giving the values of its chunk identifiers of its own. The identifiers of each column are then merged in the order of the chunks, so the rows are encoded exactly as if they were added one at a time. A quote only ever starts or ends quoting, so whether the start of a chunk is quoted is the parity of the quotes before it, which lets every chunk move its end to the first line break outside quotes without parsing the chunks before it.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class CsvReader
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a reader for a CSV file
+            \post The \p path passed will be verified as a valid file path
+            \param[in] path The path of the CSV file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        CsvReader(const std::string &path) : fileManager(path, false) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~CsvReader() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the path of the CSV file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The path of the CSV file
+        */
+        std::string getPath() const;
+
+        /* Member Functions */
+
+        /*! \brief Reads the rows of the CSV file
+            \throws std::filesystem::filesystem_error If the file cannot be opened or mapped into memory
+            \throws std::invalid_argument If a row does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance The rows of the file, with the columns named by its first row
+        */
+        table::instance::TableInstance read() const;
+
+        /*! \brief Reads the rows of the CSV file for the columns of a table
+            \param[in] table The table whose rows name the columns to read
+            \throws std::invalid_argument If the file has no column for a row of \p table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance The rows of the file, with one column per row of \p table in the same order
+        */
+        table::instance::TableInstance read(const table::Table &table) const;
+
+        /*! \brief Reads the names of the columns of the CSV file from its first row
+            \throws std::filesystem::filesystem_error If the file cannot be opened or mapped into memory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The name of each column, or none if the file is empty
+        */
+        std::vector<std::string> readColumnNames() const;
+
+        /*! \brief Reads the rows of the CSV file a window of chunks at a time, without keeping them
+            \details The chunks of each window are parsed on their own threads, and the pages of the file a window covered are released before the next one, so however large the file, only one window of it is held in memory at a time
+            \param[in] chunksPerWindow The most chunks of about #CSV_CHUNK_BYTES in a window
+            \param[in] visitRow Called with the index of its chunk in the window and the values of each row, from the thread parsing the chunk, so the rows of a chunk come in order
+            \param[in] endWindow Called with the number of chunks of each window once every row of the window was visited
+            \throws std::filesystem::filesystem_error If the file cannot be opened or mapped into memory
+            \throws std::invalid_argument If a row does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void scan(const std::size_t chunksPerWindow, const std::function<void(std::size_t, const std::vector<std::string> &)> &visitRow, const std::function<void(std::size_t)> &endWindow) const;
+
+        /*! \brief Parses the contents of a CSV file
+            \param[in] contents The text of the CSV file
+            \param[in] chunkBytes The number of characters parsed as one chunk, before moving its end to the next row
+            \throws std::invalid_argument If a row does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance The rows of \p contents, with the columns named by its first row
+        */
+        static table::instance::TableInstance parse(const std::string &contents, const std::size_t chunkBytes = CSV_CHUNK_BYTES);
+
+    private:
+        /*! \brief The rows of one chunk of a CSV file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        struct ParsedChunk
+        {
+            std::vector<std::vector<ui>> columns;               /*!< The identifier of the value of each row, one vector per column, local to the chunk */
+            std::vector<std::vector<std::string>> columnValues; /*!< The distinct values of each column in the chunk, indexed by identifier */
+        };
+
+        /* Member Functions */
+
+        /*! \brief Maps the CSV file into memory
+            \param[out] length The number of characters of the file
+            \throws std::filesystem::filesystem_error If the file cannot be opened or mapped into memory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return const char * The first character of the mapping, to be unmapped with munmap, or nullptr if the file is empty
+        */
+        const char *mapFile(std::size_t &length) const;
+
+        /*! \brief Parses the text of a CSV file
+            \param[in] data The first character of the text
+            \param[in] length The number of characters of the text
+            \param[in] chunkBytes The number of characters parsed as one chunk, before moving its end to the next row
+            \throws std::invalid_argument If a row does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance The rows of the text, with the columns named by its first row
+        */
+        static table::instance::TableInstance parseText(const char *data, const std::size_t length, const std::size_t chunkBytes);
+
+        /*! \brief Splits part of the text of a CSV file into chunks of whole rows
+            \param[in] data The first character of the text
+            \param[in] begin The index of the first character of a row, outside quotes
+            \param[in] end The index the last chunk ends near, before moving it to the next row
+            \param[in] length The number of characters of the text
+            \param[in] chunkBytes The number of characters of each chunk, before moving its end to the next row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::size_t> The index of the first character of each chunk, followed by the index after the last one
+        */
+        static std::vector<std::size_t> splitChunks(const char *data, const std::size_t begin, const std::size_t end, const std::size_t length, const std::size_t chunkBytes);
+
+        /*! \brief Reads the values of the row that starts at \p position, skipping blank lines
+            \param[in] data The first character of the text
+            \param[in] position The index of the first character of the row
+            \param[in] end The index after the last character that may be read
+            \param[out] values The values of the row, or none if only blank lines were left
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The index after the line break that ends the row
+        */
+        static std::size_t readRow(const char *data, std::size_t position, const std::size_t end, std::vector<std::string> &values);
+
+        /*! \brief Moves \p position to the start of the next row
+            \param[in] data The first character of the text
+            \param[in] position The index to move
+            \param[in] end The index after the last character of the text
+            \param[in] inQuotes If \p position is inside a quoted value
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The index after the first line break outside quotes at or after \p position, or \p end if there is none
+        */
+        static std::size_t findRowStart(const char *data, std::size_t position, const std::size_t end, bool inQuotes);
+
+        FileManager fileManager; /*!< The manager of the CSV file */
+    };
+}
@@ -0,0 +1,91 @@
+/*! \file temporaryDirectory.h
+    \brief Header file for creating a temporary directory.
+    \details Contains the function declarations for creating a uniquely named directory that is removed along with everything in it once it is no longer needed
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <cerrno>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <stdlib.h>
+
+#include "constants.h"
+#include "fileManager.h"
+
+namespace normalizer::file
+{
+    /*! \headerfile temporaryDirectory.h
+        \brief A uniquely named directory that is removed with its files when destroyed
+        \details The directory is created inside a parent directory with mkdtemp, so two runs sharing the parent never share files
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class TemporaryDirectory
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a temporary directory
+            \post The \p parentPath passed will be verified as a valid directory path
+            \param[in] parentPath The directory to create the temporary directory in
+            \throws std::filesystem::filesystem_error If the directory cannot be created
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TemporaryDirectory(const std::string &parentPath);
+
+        /*! \brief Not copyable, since each copy would remove the same directory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TemporaryDirectory(const TemporaryDirectory &) = delete;
+
+        /*! \brief Not assignable, since each copy would remove the same directory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TemporaryDirectory &operator=(const TemporaryDirectory &) = delete;
+
+        /*! \brief Removes the directory and every file in it
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~TemporaryDirectory();
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the path of the directory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The path of the directory
+        */
+        std::string getPath() const;
+
+        /* Member Functions */
+
+        /*! \brief Gets the path of a file in the directory
+            \param[in] name The name of the file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The path of \p name inside the directory
+        */
+        std::string createFilePath(const std::string &name) const;
+
+    private:
+        std::filesystem::path path; /*!< The path of the directory */
+    };
+}
@@ -77,7 +77,7 @@ namespace normalizer::interpreter::parser
             \author Matthew Moore
             \return DependencyManager The parsed dependency manager
         */
-        normalizer::dependencies::DependencyManager getDependencyManager() const;
+        const normalizer::dependencies::DependencyManager &getDependencyManager() const;
 
         /* Member Functions */
 
@@ -206,6 +206,21 @@ namespace normalizer::interpreter::parser
         */
         void parseMultiplePrimaryKeys();
 
+        /*! \brief Parses a join dependency of the table, written as JOIN: (row, ...), (row, ...), ...
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void parseJoinDependency();
+
+        /*! \brief Parses the row names of one component of a join dependency, after its opening parenthesis
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The row names of the component
+        */
+        std::vector<std::string> parseJoinComponent();
+
         /*! \brief Adds a dependency row to #dependencyRows if it does not already exist
             \param[in] rowName The name of the dependency row
             \date 10/27/2023
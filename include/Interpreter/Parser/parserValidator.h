@@ -93,6 +93,17 @@ namespace normalizer::interpreter::parser
         */
         static void validatePrimaryKey(const normalizer::interpreter::token::LiteralToken &token, const std::string &textLine, const normalizer::table::Table &table);
 
+        /*! \brief Determines if a join dependency has enough components to say anything
+            \post The program may throw an error depending on if \p components has fewer than two components
+            \param[in] token The last token of the join dependency
+            \param[in] textLine The line of the text where \p token was
+            \param[in] components The row names of each component of the join dependency
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void validateJoinDependency(const normalizer::interpreter::token::LiteralToken &token, const std::string &textLine, const std::vector<std::vector<std::string>> &components);
+
         /*! \brief Determines if \p currentRowName already exists in \p dependencyRows for single valued dependencies
             \post The program may throw an error depending on if \p currentRowName already exists in \p dependencyRows for single valued dependencies
             \param[in] token The potentially duplicated single dependency name
@@ -36,6 +36,7 @@ namespace normalizer::interpreter::token
         T_SEMICOLON,  /*!< ; */
         T_COMMA,      /*!< , */
         T_KEY,        /*!< KEY */
+        T_JOIN,       /*!< JOIN */
         T_COLON,      /*!< : */
         T_DASH,       /*!< - */
         T_RANGLE,     /*!< > */
@@ -59,6 +60,7 @@ namespace normalizer::interpreter::token
         {TokenConstants::T_SEMICOLON, "SEMICOLON"},
         {TokenConstants::T_COMMA, "COMMA"},
         {TokenConstants::T_KEY, "KEY"},
+        {TokenConstants::T_JOIN, "JOIN"},
         {TokenConstants::T_COLON, "COLON"},
         {TokenConstants::T_DASH, "DASH"},
         {TokenConstants::T_RANGLE, "RANGLE"},
@@ -80,6 +82,7 @@ namespace normalizer::interpreter::token
         {";", TokenConstants::T_SEMICOLON},
         {",", TokenConstants::T_COMMA},
         {"KEY", TokenConstants::T_KEY},
+        {"JOIN", TokenConstants::T_JOIN},
         {":", TokenConstants::T_COLON},
         {"-", TokenConstants::T_DASH},
         {">", TokenConstants::T_RANGLE},
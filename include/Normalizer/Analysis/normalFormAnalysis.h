@@ -0,0 +1,53 @@
+/*! \file normalFormAnalysis.h
+    \brief Header file for the normal form analysis of a table.
+    \details Contains the declaration of the result of classifying a table into its highest normal form without normalizing it
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+
+namespace normalizer::analysis
+{
+    /*! \headerfile normalFormAnalysis.h
+        \brief The violations of every normal form of a table, found in one pass over its dependencies
+        \details Every level is checked, even past the first one that fails, so the violations of each level can be reported together. BCNF has no number of its own in #highestForm, which goes from 0 for a table that is not in 1NF up to 5, so a table in 3NF but not in BCNF is at 3.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct NormalFormAnalysis
+    {
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        NormalFormAnalysis() : inOneNF(false), highestForm(0) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~NormalFormAnalysis() {}
+
+        bool inOneNF;                                                             /*!< If the table has a primary key and no nullable rows */
+        std::vector<std::pair<std::string, std::string>> partialDependencies;     /*!< The dependencies on part of the primary key, which violate 2NF */
+        std::vector<dependencies::attribute::AttributeSet> partialDeterminants;   /*!< The left hand side of each of #partialDependencies, once each, which 2NF splits into tables of their own */
+        std::vector<std::pair<std::string, std::string>> transitiveDependencies;  /*!< The dependencies between non key rows, which violate 3NF */
+        std::vector<std::pair<std::string, std::string>> bcnfDependencies;        /*!< The dependencies of key rows on non key rows, which violate BCNF */
+        std::vector<std::pair<std::string, std::string>> multiValuedDependencies; /*!< The multi valued dependencies that violate 4NF */
+        std::vector<dependencies::join::JoinDependency> joinDependencies;         /*!< The join dependencies that violate 5NF */
+        us highestForm;                                                           /*!< The highest normal form the table is in */
+    };
+}
@@ -0,0 +1,112 @@
+/*! \file fiveNFDecomposer.h
+    \brief Header file for decomposing relations into 5NF.
+    \details Contains the function declarations for finding the join dependencies that violate 5NF and splitting a relation on them
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+#include "Dependencies/Projection/dependencyProjector.h"
+#include "Dependencies/Chase/chaseTableau.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::decomposition
+{
+    /*! \headerfile fiveNFDecomposer.h
+        \brief Finds 5NF violations among the declared join dependencies and decomposes relations on them
+        \details A join dependency applies to a relation R when its components cover exactly R. It violates 5NF unless it is trivial or implied by the candidate keys of R, which holds exactly when chasing the tableau of its components with K -> R, for every candidate key K, produces a row of distinguished symbols. A violating relation is replaced by the components of the dependency, which join back losslessly by the dependency itself. Every (relation, join dependency) candidate of a round is checked on its own thread chunk, since each one projects the dependencies and finds the keys of its relation.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class FiveNFDecomposer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a decomposer over \p inJoinDependencies
+            \param[in, out] inClosureCache The cache of closures under the dependencies of the whole schema
+            \param[in] inJoinDependencies The declared join dependencies, of which the trivial ones are dropped
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        FiveNFDecomposer(dependencies::closure::ClosureCache &inClosureCache, const std::vector<dependencies::join::JoinDependency> &inJoinDependencies);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~FiveNFDecomposer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the non trivial join dependencies the decomposer tries
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<JoinDependency> The distinct non trivial declared join dependencies
+        */
+        const std::vector<dependencies::join::JoinDependency> &getJoinDependencies() const;
+
+        /* Member Functions */
+
+        /*! \brief Finds the join dependencies that violate 5NF on a relation
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<JoinDependency> The join dependencies over \p relation that its candidate keys do not imply
+        */
+        std::vector<dependencies::join::JoinDependency> findViolations(const dependencies::attribute::AttributeSet &relation);
+
+        /*! \brief Checks if the candidate keys of a relation imply a join dependency over it
+            \param[in] dependency The join dependency, whose components must cover exactly \p relation
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If chasing the components of \p dependency with the key dependencies of \p relation produces a row of distinguished symbols
+        */
+        bool isImpliedByKeys(const dependencies::join::JoinDependency &dependency, const dependencies::attribute::AttributeSet &relation);
+
+        /*! \brief Splits every relation until no part of it violates 5NF
+            \param[in] relations The attributes of each relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<AttributeSet>> The parts of each relation, where a relation already in 5NF is returned alone
+        */
+        std::vector<std::vector<dependencies::attribute::AttributeSet>> decompose(const std::vector<dependencies::attribute::AttributeSet> &relations);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Checks candidate pairs of a relation and a join dependency over it, spreading them over threads
+            \param[in] relations The attributes of each relation
+            \param[in] candidates The index of the relation and of the join dependency of each candidate
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<char> 1 for each candidate whose join dependency violates 5NF on its relation, and 0 otherwise
+        */
+        std::vector<char> findViolatingCandidates(const std::vector<dependencies::attribute::AttributeSet> &relations, const std::vector<std::pair<std::size_t, std::size_t>> &candidates);
+
+        dependencies::closure::ClosureCache &closureCache;                /*!< The shared cache of closures under the whole schema */
+        std::vector<dependencies::join::JoinDependency> joinDependencies; /*!< The distinct non trivial join dependencies to try */
+    };
+}
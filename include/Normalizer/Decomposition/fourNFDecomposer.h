@@ -0,0 +1,96 @@
+/*! \file fourNFDecomposer.h
+    \brief Header file for decomposing relations into 4NF.
+    \details Contains the function declarations for finding the multi valued dependencies that violate 4NF and splitting a relation on them
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "aliases.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Basis/dependencyBasis.h"
+
+namespace normalizer::decomposition
+{
+    /*! \headerfile fourNFDecomposer.h
+        \brief Finds 4NF violations with dependency bases and decomposes relations on them
+        \details For a left hand side X inside a relation R, X ->> (B ∩ R) holds on R for every block B of the basis of X. If X is not a superkey of R and at least two blocks meet R, then X ->> (B ∩ R) is a non trivial dependency that violates 4NF, and R is split into X ∪ (B ∩ R) and R - (B ∩ R), which always joins back losslessly. Only the left hand sides of the declared dependencies are tried.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class FourNFDecomposer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a decomposer that tries \p inDeterminants as left hand sides
+            \param[in, out] inBasisCalculator The calculator of the dependency bases of the whole schema
+            \param[in] inDeterminants The left hand sides to try, normally those of the declared dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        FourNFDecomposer(dependencies::basis::DependencyBasisCalculator &inBasisCalculator, const std::vector<dependencies::attribute::AttributeSet> &inDeterminants);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~FourNFDecomposer() {}
+
+        /* Member Functions */
+
+        /*! \brief Finds the dependencies that violate 4NF on a relation, one for each left hand side that does
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<MultivaluedDependency> The non trivial dependencies of \p relation whose left hand side is not a superkey
+        */
+        std::vector<dependencies::multivalued::MultivaluedDependency> findViolations(const dependencies::attribute::AttributeSet &relation);
+
+        /*! \brief Finds the violations of 4NF on a relation that are not functional dependencies
+            \details A left hand side X only counts if at least two pieces of the relation are outside of the closure of X, since otherwise the violation is a functional dependency that BCNF already forbids
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<MultivaluedDependency> The violations of \p relation that need a multi valued dependency
+        */
+        std::vector<dependencies::multivalued::MultivaluedDependency> findMultivaluedViolations(const dependencies::attribute::AttributeSet &relation);
+
+        /*! \brief Splits a relation until no part of it violates 4NF
+            \param[in] relation The attributes of the relation
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The parts of \p relation, which is returned alone if it is already in 4NF
+        */
+        std::vector<dependencies::attribute::AttributeSet> decompose(const dependencies::attribute::AttributeSet &relation);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Gets the non empty parts of a relation that the blocks of the basis of \p determinant cover
+            \param[in] determinant The left hand side, which must not be a superkey of \p relation
+            \param[in] relation The attributes of the relation
+            \param[in] excluded The attributes whose pieces are skipped
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The pieces B ∩ \p relation that are not subsets of \p excluded, for each block B
+        */
+        std::vector<dependencies::attribute::AttributeSet> getPieces(const dependencies::attribute::AttributeSet &determinant, const dependencies::attribute::AttributeSet &relation, const dependencies::attribute::AttributeSet &excluded);
+
+        dependencies::basis::DependencyBasisCalculator &basisCalculator;  /*!< The calculator of the dependency bases of the whole schema */
+        std::vector<dependencies::attribute::AttributeSet> determinants; /*!< The distinct left hand sides to try */
+    };
+}
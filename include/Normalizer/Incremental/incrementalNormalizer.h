@@ -0,0 +1,191 @@
+/*! \file incrementalNormalizer.h
+    \brief Header file for incrementally re-normalizing a decomposition.
+    \details Contains the function declarations for keeping the closures, keys and decomposition of a normalization in memory while functional dependencies are added and retracted
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "aliases.h"
+#include "Table/table.h"
+#include "Interpreter/Parser/parser.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Projection/dependencyProjector.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+
+namespace normalizer::incremental
+{
+    /*! \headerfile incrementalNormalizer.h
+        \brief Keeps a normalization in memory and updates it as functional dependencies are added and retracted
+        \details Adding or retracting X -> Y can only change the projection of a table R if X is in the closure of R, so only those tables are projected again. Cached closures are updated the same way, and only the ones that can change are recomputed. The candidate keys are updated from the ones before the change: after an add every key is still a superkey and is only shrunk, and after a retract only the keys whose closure reached X are checked again. The tables themselves are never split again, so a table a change takes out of BCNF is reported by #isComponentInBCNF and stays as it is until the input table is normalized again.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class IncrementalNormalizer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates an incremental normalizer for a finished normalization
+            \param[in] inDictionary The identifiers of the input table's row names
+            \param[in] inClosureCache The closures computed during the normalization, under the input table's dependencies
+            \param[in] inComponents The attributes of each normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        IncrementalNormalizer(const dependencies::attribute::AttributeDictionary &inDictionary, const dependencies::closure::ClosureCache &inClosureCache, const std::vector<dependencies::attribute::AttributeSet> &inComponents);
+
+        /*! \brief The copy constructor
+            \param[in] other The incremental normalizer to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        IncrementalNormalizer(const IncrementalNormalizer &other);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~IncrementalNormalizer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the current dependencies of the input table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The current dependencies of the input table
+        */
+        const std::vector<dependencies::functional::FunctionalDependency> &getFunctionalDependencies() const;
+
+        /*! \brief Gets the candidate keys of the input table under the current dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The candidate keys of the input table
+        */
+        const std::vector<dependencies::attribute::AttributeSet> &getCandidateKeys() const;
+
+        /*! \brief Gets the attributes of each normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The attributes of each normalized table
+        */
+        const std::vector<dependencies::attribute::AttributeSet> &getComponents() const;
+
+        /*! \brief Gets the dependencies that hold on each normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<FunctionalDependency>> A minimal cover of the dependencies of each normalized table
+        */
+        const std::vector<std::vector<dependencies::functional::FunctionalDependency>> &getComponentDependencies() const;
+
+        /*! \brief Gets the normalized tables the last change projected again
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The indexes of the normalized tables the last change affected
+        */
+        const std::vector<ui> &getAffectedComponents() const;
+
+        /*! \brief Gets the number of cached closures the last change recomputed
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of cached closures the last change recomputed
+        */
+        ul getRecomputedClosureCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Parses dependencies written in the syntax of a dependency file
+            \param[in] text The dependencies to parse
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The functional dependencies in \p text
+        */
+        std::vector<dependencies::functional::FunctionalDependency> parseDependencies(const std::string &text) const;
+
+        /*! \brief Adds a dependency and updates the closures, keys and tables it affects
+            \param[in] dependency The dependency to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the dependency was added, which it is not if it is already a dependency of the input table
+        */
+        bool addDependency(const dependencies::functional::FunctionalDependency &dependency);
+
+        /*! \brief Retracts a dependency and updates the closures, keys and tables it affects
+            \param[in] dependency The dependency to retract
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the dependency was retracted, which it is not if it is not a dependency of the input table
+        */
+        bool retractDependency(const dependencies::functional::FunctionalDependency &dependency);
+
+        /*! \brief Checks if a normalized table is in BCNF under the current dependencies
+            \details A table that is not is left as it is, since the decomposition does not change with the dependencies
+            \param[in] index The index of the normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the left hand side of every dependency of the table is a superkey of the table
+        */
+        bool isComponentInBCNF(const ui index);
+
+        /* Operator Overloads */
+
+        /*! \brief The copy assignment operator
+            \param[in] other The incremental normalizer to copy
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return IncrementalNormalizer The incremental normalizer with the state of \p other
+        */
+        IncrementalNormalizer &operator=(const IncrementalNormalizer &other);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds the normalized tables whose projection a change to \p dependency could affect
+            \pre Must be called before the change is applied to #closureCache
+            \param[in] dependency The dependency being added or retracted
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void findAffectedComponents(const dependencies::functional::FunctionalDependency &dependency);
+
+        /*! \brief Projects the dependencies onto the affected tables again
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void refreshAffectedComponents();
+
+        dependencies::attribute::AttributeDictionary dictionary;                                        /*!< The identifiers of the input table's row names */
+        dependencies::closure::ClosureCache closureCache;                                               /*!< The closures under the current dependencies */
+        std::vector<dependencies::attribute::AttributeSet> components;                                  /*!< The attributes of each normalized table */
+        std::vector<std::vector<dependencies::functional::FunctionalDependency>> componentDependencies; /*!< A minimal cover of the dependencies of each normalized table */
+        std::vector<dependencies::attribute::AttributeSet> candidateKeys;                               /*!< The candidate keys of the input table */
+        std::vector<ui> affectedComponents;                                                             /*!< The normalized tables the last change affected */
+        ul recomputedClosureCount;                                                                      /*!< The number of cached closures the last change recomputed */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/*! \file externalMaterializer.h
+    \brief Header file for filling the normalized tables with the rows of a CSV data file larger than memory.
+    \details Contains the function declarations for projecting the rows of a CSV data file onto each normalized table one partition at a time, and writing them as INSERT statements or CSV files
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "aliases.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Table/table.h"
+#include "Table/TableRow/tableRow.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::materialization
+{
+    /*! \headerfile externalMaterializer.h
+        \brief Fills each normalized table with the distinct projections of the rows of a CSV data file, under a memory limit
+        \details Two rows can only be duplicates on the columns of a normalized table if they agree on all of them, so the rows are split into partitions by the hash of those columns, and each partition is cleared of duplicates and written by a #TableMaterializer of its own. The rows of a table come out in the order they first appear within each partition, one partition after another, rather than in the order they first appear in the file. Every table is written in a pass of its own over the file.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ExternalMaterializer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a materializer of \p inTables from the rows read by \p inPartitioner
+            \param[in] inPartitioner The partitioner of the rows of the CSV file, which must outlive the materializer
+            \param[in] inTables The normalized tables, whose rows name columns of the CSV file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ExternalMaterializer(table::external::ExternalPartitioner &inPartitioner, const std::vector<table::Table> &inTables);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ExternalMaterializer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the number of distinct rows written for a normalized table
+            \param[in] table The index of the normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows of \p table written so far
+        */
+        ul getRowCount(const std::size_t table) const;
+
+        /* Member Functions */
+
+        /*! \brief Writes the rows of every normalized table as INSERT statements of up to #MATERIALIZE_INSERT_BATCH_SIZE rows each
+            \param[in, out] outputStream The stream to write to
+            \throws std::invalid_argument If the CSV file has no column for a row of a normalized table
+            \throws std::filesystem::filesystem_error If the CSV file cannot be read or a partition cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeInserts(std::ostream &outputStream);
+
+        /*! \brief Writes the rows of a normalized table as a CSV file, with a header row naming its columns
+            \param[in] table The index of the normalized table
+            \param[in, out] outputStream The stream to write to
+            \throws std::invalid_argument If the CSV file has no column for a row of \p table
+            \throws std::filesystem::filesystem_error If the CSV file cannot be read or a partition cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeCsv(const std::size_t table, std::ostream &outputStream);
+
+        /*! \brief Creates the LOAD DATA statements that fill the normalized tables from the CSV files written by #writeCsv
+            \param[in] csvPaths The path of the CSV file of each normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string One LOAD DATA statement per table, with every table after the tables its foreign keys reference
+        */
+        std::string createLoadScript(const std::vector<std::string> &csvPaths) const;
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Clears each partition of the rows of the CSV file on the columns of a normalized table of duplicates, and writes it
+            \param[in] table The index of the normalized table
+            \param[in] write Called with the materializer of each partition, whose only table is \p table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void materializeTable(const std::size_t table, const std::function<void(const TableMaterializer &)> &write);
+
+        /*! \brief Gets the name of every column of the normalized tables
+            \param[in] normalizedTables The normalized tables
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The name of each distinct row of \p normalizedTables, in the order they first appear
+        */
+        static std::vector<std::string> collectColumnNames(const std::vector<table::Table> &normalizedTables);
+
+        table::external::ExternalPartitioner &partitioner; /*!< The partitioner of the rows of the CSV file */
+        std::vector<table::Table> tables;                  /*!< The normalized tables */
+        table::instance::TableInstance columns;            /*!< The columns of the normalized tables, with no rows */
+        TableMaterializer layout;                          /*!< The materializer of #columns, for the headers, load order and load script of the tables */
+        std::vector<ul> rowCounts;                         /*!< The number of distinct rows written for each normalized table */
+    };
+}
@@ -0,0 +1,199 @@
+/*! \file tableMaterializer.h
+    \brief Header file for filling the normalized tables with the rows of the input table.
+    \details Contains the function declarations for projecting the rows of the input table onto each normalized table, removing their duplicates and writing them as INSERT statements or CSV files
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Table/table.h"
+#include "Table/TableRow/tableRow.h"
+#include "Table/ForeignKey/foreignKey.h"
+#include "Table/Instance/tableInstance.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::materialization
+{
+    /*! \headerfile tableMaterializer.h
+        \brief Fills each normalized table with the distinct projections of the rows of the input table
+        \details The rows of a normalized table are the rows of the input table on its columns, with the duplicates removed. Each row is hashed on the value identifiers of those columns, and the rows are split into #MATERIALIZE_PARTITION_COUNT partitions by their hash, so the duplicates of a row always share its partition and every partition is cleared of duplicates on its own thread. A normalized table keeps the first row of the input table with each of its projections, so the rows come out in the order they first appear. Nothing is copied but the index of each kept row, and the values are looked up from the input table as the rows are written.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class TableMaterializer
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a materializer of \p inTables from the rows of \p inInstance
+            \param[in] inInstance The rows of the input table, which must outlive the materializer
+            \param[in] inTables The normalized tables, whose rows name columns of \p inInstance
+            \throws std::invalid_argument If \p inInstance has no column for a row of one of \p inTables
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TableMaterializer(const table::instance::TableInstance &inInstance, const std::vector<table::Table> &inTables);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~TableMaterializer() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the rows of the input table kept by a normalized table
+            \pre #materialize must already have been called
+            \param[in] table The index of the normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The index in the input table of each row of \p table, in the order the rows first appear
+        */
+        const std::vector<ui> &getSourceRows(const std::size_t table) const;
+
+        /*! \brief Gets the number of normalized tables
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The number of normalized tables
+        */
+        std::size_t getTableCount() const;
+
+        /*! \brief Gets the columns of the input table that make up a normalized table
+            \param[in] table The index of the normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<us> The column of the input table of each row of \p table
+        */
+        const std::vector<us> &getTableColumns(const std::size_t table) const;
+
+        /*! \brief Gets the order the normalized tables can be filled in
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::size_t> The index of each normalized table, with every table after the tables its foreign keys reference
+        */
+        std::vector<std::size_t> getLoadOrder() const;
+
+        /* Member Functions */
+
+        /*! \brief Projects the rows of the input table onto every normalized table and removes the duplicates
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void materialize();
+
+        /*! \brief Writes the rows of every normalized table as INSERT statements of up to #MATERIALIZE_INSERT_BATCH_SIZE rows each
+            \pre #materialize must already have been called
+            \param[in, out] outputStream The stream to write to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeInserts(std::ostream &outputStream) const;
+
+        /*! \brief Writes the rows of a normalized table as INSERT statements of up to #MATERIALIZE_INSERT_BATCH_SIZE rows each
+            \pre #materialize must already have been called
+            \param[in] table The index of the normalized table
+            \param[in, out] outputStream The stream to write to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeInserts(const std::size_t table, std::ostream &outputStream) const;
+
+        /*! \brief Writes the rows of a normalized table as a CSV file, with a header row naming its columns
+            \pre #materialize must already have been called
+            \param[in] table The index of the normalized table
+            \param[in, out] outputStream The stream to write to
+            \param[in] writeHeader If the header row is written, or only the rows, to follow rows written before
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeCsv(const std::size_t table, std::ostream &outputStream, const bool writeHeader = true) const;
+
+        /*! \brief Creates the LOAD DATA statements that fill the normalized tables from the CSV files written by #writeCsv
+            \param[in] csvPaths The path of the CSV file of each normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string One LOAD DATA statement per table, in the order of #getLoadOrder
+        */
+        std::string createLoadScript(const std::vector<std::string> &csvPaths) const;
+
+        /*! \brief Quotes a value for a CSV file, if it needs to be
+            \param[in] value The value to quote
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string \p value in quotes with every quote inside it written twice if it holds a separator, quote or line break, otherwise \p value itself
+        */
+        static std::string quoteCsvValue(const std::string &value);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Finds the first row of the input table with each distinct projection onto \p columns
+            \param[in] columns The columns of the input table to project onto
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The index of each kept row, ascending
+        */
+        std::vector<ui> deduplicate(const std::vector<us> &columns) const;
+
+        /*! \brief Checks if two rows of the input table agree on every one of \p columns
+            \param[in] first The index of the first row
+            \param[in] second The index of the second row
+            \param[in] columns The columns to compare
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the rows have the same value in each of \p columns
+        */
+        bool rowsAgree(const ui first, const ui second, const std::vector<us> &columns) const;
+
+        /*! \brief Gets the names of the columns of a normalized table, separated by commas
+            \param[in] table The index of the normalized table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The column list of \p table
+        */
+        std::string getColumnList(const std::size_t table) const;
+
+        /*! \brief Quotes a value for an SQL statement
+            \param[in] value The value to quote
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string \p value in single quotes, with every quote and backslash inside it written twice
+        */
+        static std::string quoteSqlValue(const std::string &value);
+
+        const table::instance::TableInstance &instance; /*!< The rows of the input table */
+        std::vector<table::Table> tables;               /*!< The normalized tables */
+        std::vector<std::vector<us>> tableColumns;      /*!< The column of #instance of each row of each normalized table */
+        std::vector<std::vector<ui>> sourceRows;        /*!< The rows of #instance kept by each normalized table */
+    };
+}
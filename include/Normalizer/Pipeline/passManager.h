@@ -0,0 +1,167 @@
+/*! \file passManager.h
+    \brief Header file for running the normalization passes.
+    \details Contains the function declarations for running normalization passes in order, computing the analyses they need and skipping the ones whose form already holds
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "aliases.h"
+#include "Normalizer/formConstants.h"
+
+namespace normalizer::pipeline
+{
+    /*! \headerfile passManager.h
+        \brief The analyses that normalization passes share
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    enum class Analysis
+    {
+        CLOSURES,     /*!< The closures under the dependencies of the input table */
+        KEYS,         /*!< The candidate keys and prime attributes of the input table */
+        PROJECTIONS,  /*!< The dependencies that hold on each working table, projected from those of the input table */
+        NORMAL_FORMS, /*!< The partial, transitive and BCNF dependencies of each working table, from its projected dependencies */
+        COUNT         /*!< The number of analyses */
+    };
+
+    /*! \headerfile passManager.h
+        \brief One step of the normalization pipeline
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    struct NormalizationPass
+    {
+        NormalizationForm form;                  /*!< The form the tables are in after the pass */
+        std::vector<Analysis> requiredAnalyses;  /*!< The analyses that must be computed before the pass, or before checking #isSatisfied */
+        std::vector<Analysis> preservedAnalyses; /*!< The analyses that stay valid when the pass changes the tables */
+        std::function<bool()> isSatisfied;       /*!< Checks if the tables are already in #form, so the pass can be skipped, or empty if the pass always runs */
+        std::function<bool()> run;               /*!< Runs the pass, returning if it changed the tables */
+    };
+
+    /*! \headerfile passManager.h
+        \brief Runs normalization passes in order, sharing the analyses between them
+        \details An analysis is computed the first time a pass needs it and kept until a pass that changes the tables does not preserve it. A pass whose form already holds is skipped, which changes nothing, so every analysis stays valid.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class PassManager
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a manager with no passes, where every analysis is invalid and computes nothing
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        PassManager();
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~PassManager() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the forms of the passes that were skipped by the last run
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<NormalizationForm> The forms that already held when their pass was reached
+        */
+        const std::vector<NormalizationForm> &getSkippedPasses() const;
+
+        /*! \brief Gets the number of times an analysis was computed
+            \param[in] analysis The analysis
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of times \p analysis was computed
+        */
+        ui getComputeCount(const Analysis analysis) const;
+
+        /* Member Functions */
+
+        /*! \brief Adds a pass to the end of the pipeline
+            \param[in] pass The pass to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addPass(const NormalizationPass &pass);
+
+        /*! \brief Sets how an analysis is computed
+            \param[in] analysis The analysis
+            \param[in] compute Computes \p analysis
+            \param[in] valid If \p analysis has already been computed
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void registerAnalysis(const Analysis analysis, const std::function<void()> &compute, const bool valid);
+
+        /*! \brief Checks if an analysis has been computed since the last pass that invalidated it
+            \param[in] analysis The analysis
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p analysis is valid
+        */
+        bool isValid(const Analysis analysis) const;
+
+        /*! \brief Marks an analysis as needing to be computed again
+            \param[in] analysis The analysis
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void invalidate(const Analysis analysis);
+
+        /*! \brief Checks if a pass reaches a form
+            \param[in] form The form
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If some pass of the pipeline has \p form
+        */
+        bool hasPass(const NormalizationForm form) const;
+
+        /*! \brief Runs the passes in order up to and including the pass of \p target
+            \param[in] target The form of the last pass to run
+            \param[in] onPassDone Called with the form of each pass after it is run or skipped, if not empty
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void run(const NormalizationForm target, const std::function<void(NormalizationForm)> &onPassDone = {});
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Computes an analysis if it is not valid
+            \param[in] analysis The analysis
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void require(const Analysis analysis);
+
+        std::vector<NormalizationPass> passes;                /*!< The passes of the pipeline, in the order they run */
+        std::vector<std::function<void()>> analysisComputers; /*!< How each analysis is computed */
+        std::vector<bool> validAnalyses;                      /*!< If each analysis is valid */
+        std::vector<ui> computeCounts;                        /*!< The number of times each analysis was computed */
+        std::vector<NormalizationForm> skippedPasses;         /*!< The forms of the passes that the last run skipped */
+    };
+}
@@ -0,0 +1,190 @@
+/*! \file dataJoinVerifier.h
+    \brief Header file for verifying on the rows of a table that a decomposition is lossless.
+    \details Contains the function declarations for joining the rows of the normalized tables back together and comparing them to the rows they were filled from
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Table/Instance/tableInstance.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::verification
+{
+    /*! \headerfile dataJoinVerifier.h
+        \brief Verifies that the rows of the normalized tables join back into exactly the rows they were filled from
+        \details The tables are joined one at a time, each next one sharing the most columns with the ones already joined, through a hash index of its rows on the shared columns. The joined rows are never stored: each is hashed as soon as it is complete, and the hashes are added up with a count of the rows, which gives the same total in any order. The rows of the first table are split across threads, each joining its own rows through the other tables. The join of the projections of a table always holds its rows, so the decomposition is lossless exactly when the total and count match the distinct rows of the data. Only when they do not are the rows joined again to find the ones that are not in the data, along with any rows of the data that did not come back. Every table shares the value identifiers of the data, so the join compares identifiers instead of strings.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DataJoinVerifier
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a verifier of the rows of a materialized decomposition
+            \param[in] inInstance The rows the normalized tables were filled from, which must outlive the verifier
+            \param[in] inMaterializer The normalized tables after #normalizer::materialization::TableMaterializer::materialize, which must outlive the verifier
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DataJoinVerifier(const table::instance::TableInstance &inInstance, const materialization::TableMaterializer &inMaterializer);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DataJoinVerifier() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the columns of the data that no normalized table holds
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<us> The columns left out of the decomposition, which the join cannot bring back
+        */
+        const std::vector<us> &getUncoveredColumns() const;
+
+        /*! \brief Gets the number of distinct rows of the data on the columns the normalized tables hold
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows the join should give back
+        */
+        ul getDistinctRowCount() const;
+
+        /*! \brief Gets the number of rows the normalized tables joined back into
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of joined rows, where counting stops once it passes #getDistinctRowCount
+        */
+        ul getJoinedRowCount() const;
+
+        /*! \brief Gets joined rows that are not rows of the data
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<std::string>> Up to #DATA_JOIN_REPORTED_ROWS rows, with the values of the columns the normalized tables hold
+        */
+        const std::vector<std::vector<std::string>> &getSpuriousRows() const;
+
+        /*! \brief Gets rows of the data that the join did not give back
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<std::string>> Up to #DATA_JOIN_REPORTED_ROWS rows, with the values of the columns the normalized tables hold
+        */
+        const std::vector<std::vector<std::string>> &getMissingRows() const;
+
+        /* Member Functions */
+
+        /*! \brief Joins the rows of the normalized tables and compares them to the rows of the data
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If every column is held by a normalized table and the join gives back exactly the distinct rows of the data
+        */
+        bool verify();
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Orders the tables of the join, builds the hash index of every table after the first and finds the distinct rows of the data
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void planJoin();
+
+        /*! \brief Hashes the values of some columns of a row
+            \param[in] values The value identifier of each column of the data
+            \param[in] columns The columns to hash
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The hash of the values of \p columns
+        */
+        static ul hashValues(const std::vector<ui> &values, const std::vector<us> &columns);
+
+        /*! \brief Gets the values of a row of the data
+            \param[in] row The index of the row
+            \param[out] values The value identifier of each column of the data
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void loadRow(const ui row, std::vector<ui> &values) const;
+
+        /*! \brief Finds the distinct row of the data with the values of a joined row
+            \param[in] values The value identifier of each column of the joined row
+            \param[in] hash The hash of the covered columns of \p values
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The index in #distinctRows of the row, or the size of #distinctRows if the joined row is not in the data
+        */
+        std::size_t findDistinctRow(const std::vector<ui> &values, const ul hash) const;
+
+        /*! \brief Joins rows of the first table through the other tables, one joined row at a time
+            \param[in] begin The first row of the first table to join
+            \param[in] end The row of the first table after the last one to join
+            \param[in] visit Called with the value identifier of each column of each joined row, and stops the join when it returns false
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void joinRows(const std::size_t begin, const std::size_t end, const std::function<bool(const std::vector<ui> &)> &visit) const;
+
+        /*! \brief Joins a partly joined row with the rows of the next table
+            \param[in] position The position in #joinOrder of the next table
+            \param[in, out] values The value identifier of each column joined so far
+            \param[in] visit Called with each joined row, and stops the join when it returns false
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the join should go on
+        */
+        bool extendRow(const std::size_t position, std::vector<ui> &values, const std::function<bool(const std::vector<ui> &)> &visit) const;
+
+        /*! \brief Gets the values of the covered columns of a row
+            \param[in] values The value identifier of each column of the row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The value of each covered column
+        */
+        std::vector<std::string> describeRow(const std::vector<ui> &values) const;
+
+        const table::instance::TableInstance &instance;               /*!< The rows of the data */
+        const materialization::TableMaterializer &materializer;       /*!< The normalized tables and the rows of the data each one kept */
+        std::vector<us> coveredColumns;                               /*!< The columns of the data held by a normalized table */
+        std::vector<us> uncoveredColumns;                             /*!< The columns of the data no normalized table holds */
+        std::vector<std::size_t> joinOrder;                           /*!< The normalized tables in the order they are joined */
+        std::vector<std::vector<us>> keyColumns;                      /*!< The columns each table of #joinOrder shares with the tables before it */
+        std::vector<std::vector<us>> newColumns;                      /*!< The columns each table of #joinOrder adds to the tables before it */
+        std::vector<std::unordered_map<ul, std::vector<ui>>> indexes; /*!< The rows of each table of #joinOrder by the hash of their key columns */
+        std::vector<ui> distinctRows;                                 /*!< The first row of the data with each distinct tuple of the covered columns */
+        std::unordered_map<ul, std::vector<ui>> distinctRowsByHash;   /*!< The index in #distinctRows of each distinct row, by the hash of its covered columns */
+        ul distinctChecksum;                                          /*!< The sum of the hashes of the covered columns of #distinctRows */
+        ul joinedCount;                                               /*!< The number of rows joined by the last verification */
+        std::vector<std::vector<std::string>> spuriousRows;           /*!< Joined rows that are not rows of the data */
+        std::vector<std::vector<std::string>> missingRows;            /*!< Rows of the data the join did not give back */
+    };
+}
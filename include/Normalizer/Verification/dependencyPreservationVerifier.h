@@ -0,0 +1,85 @@
+/*! \file dependencyPreservationVerifier.h
+    \brief Header file for verifying that a decomposition preserves its dependencies.
+    \details Contains the function declarations for finding the functional dependencies that no longer follow from the tables of a decomposition
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::verification
+{
+    /*! \headerfile dependencyPreservationVerifier.h
+        \brief Verifies that a decomposition preserves the functional dependencies of its schema
+        \details Uses the restricted closure test, so no dependencies are ever projected onto the tables. For X -> Y, Z starts as X and every table R grows Z by the closure of Z ∩ R kept to R, until Z stops changing. The dependency is preserved if Y ⊆ Z. Each dependency is tested independently, so the dependencies are split across threads that share one closure cache.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class DependencyPreservationVerifier
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a verifier for the dependencies of a schema
+            \param[in, out] inClosureCache The cache of closures under the functional dependencies of the schema
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        DependencyPreservationVerifier(dependencies::closure::ClosureCache &inClosureCache);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~DependencyPreservationVerifier() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the dependencies the last verified decomposition did not preserve
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The dependencies the last verified decomposition did not preserve
+        */
+        const std::vector<dependencies::functional::FunctionalDependency> &getLostDependencies() const;
+
+        /* Member Functions */
+
+        /*! \brief Checks if a decomposition preserves every dependency of the schema
+            \param[in] components The attributes of each table of the decomposition
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If every dependency follows from the dependencies that hold on the tables
+        */
+        bool verify(const std::vector<dependencies::attribute::AttributeSet> &components);
+
+        /*! \brief Checks if a decomposition preserves one dependency
+            \param[in] dependency The dependency to check
+            \param[in] components The attributes of each table of the decomposition
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If \p dependency follows from the dependencies that hold on the tables
+        */
+        bool isPreserved(const dependencies::functional::FunctionalDependency &dependency, const std::vector<dependencies::attribute::AttributeSet> &components);
+
+    private:
+        dependencies::closure::ClosureCache &closureCache;                            /*!< The cache of closures under the dependencies of the schema */
+        std::vector<dependencies::functional::FunctionalDependency> lostDependencies; /*!< The dependencies the last verified decomposition did not preserve */
+    };
+}
\ No newline at end of file
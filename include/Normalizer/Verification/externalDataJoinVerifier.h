@@ -0,0 +1,261 @@
+/*! \file externalDataJoinVerifier.h
+    \brief Header file for verifying on the rows of a CSV data file larger than memory that a decomposition is lossless.
+    \details Contains the function declarations for joining the rows of the normalized tables back together one partition at a time, and comparing them to the rows they were filled from
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "FileManager/csvReader.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Normalizer/Materialization/externalMaterializer.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Normalizer/Verification/dataJoinVerifier.h"
+#include "Table/table.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::verification
+{
+    /*! \headerfile externalDataJoinVerifier.h
+        \brief Verifies that the rows of the normalized tables join back into exactly the rows of a CSV data file, under a memory limit
+        \details A data file that fits under the limit is read all at once and checked by a #DataJoinVerifier. For a larger one, the rows of each normalized table are written to a temporary file, and the tables are joined one at a time in the order of #DataJoinVerifier, as a hash join split into partitions. The rows joined so far and the rows of the next table are written to one file, told apart by #DATA_JOIN_SIDE_COLUMN, and an #normalizer::table::external::ExternalPartitioner splits it by the hash of the columns the two share, so rows that join always share a partition and each partition is joined on its own. The joined rows of the last table and the rows of the data are then split the same way by every column, and each partition compares the count and the sum of the hashes of its joined rows to those of its distinct rows of the data. Rows are only looked at one by one in a partition whose totals differ. A join that grows past the number of rows of the data is stopped there, even a partial one, and reported as lossy.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ExternalDataJoinVerifier
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a verifier of the rows of a decomposition filled from a CSV data file
+            \param[in] inDataPath The path of the CSV data file
+            \param[in] inColumnNames The columns of the data that the normalized tables should cover, which are the rows of the input table
+            \param[in] inMaterializer The materializer of the normalized tables from the rows of \p inDataPath, which must outlive the verifier
+            \param[in] inTables The normalized tables, in the order of \p inMaterializer
+            \param[in] inTemporaryPath The directory the rows are spilled to
+            \param[in] inMemoryLimit The most bytes of memory a partition may take once read back
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ExternalDataJoinVerifier(const std::string &inDataPath, const std::vector<std::string> &inColumnNames, materialization::ExternalMaterializer &inMaterializer, const std::vector<table::Table> &inTables, const std::string &inTemporaryPath, const ul inMemoryLimit) : dataPath(inDataPath), columnNames(inColumnNames), materializer(inMaterializer), tables(inTables), temporaryPath(inTemporaryPath), memoryLimit(inMemoryLimit), distinctCount(0), joinedCount(0), partitionCount(0), spilledBytes(0), overflowed(false), matched(true) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ExternalDataJoinVerifier() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the columns of the data that no normalized table holds
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The columns left out of the decomposition, which the join cannot bring back
+        */
+        const std::vector<std::string> &getUncoveredColumns() const;
+
+        /*! \brief Gets the number of distinct rows of the data on the columns the normalized tables hold
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows the join should give back
+        */
+        ul getDistinctRowCount() const;
+
+        /*! \brief Gets the number of rows the normalized tables joined back into
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of joined rows, where joining stops once it passes the number of rows of the data
+        */
+        ul getJoinedRowCount() const;
+
+        /*! \brief Gets joined rows that are not rows of the data
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<std::string>> Up to #DATA_JOIN_REPORTED_ROWS rows, with the values of the columns the normalized tables hold
+        */
+        const std::vector<std::vector<std::string>> &getSpuriousRows() const;
+
+        /*! \brief Gets rows of the data that the join did not give back
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::vector<std::string>> Up to #DATA_JOIN_REPORTED_ROWS rows, with the values of the columns the normalized tables hold
+        */
+        const std::vector<std::vector<std::string>> &getMissingRows() const;
+
+        /*! \brief Gets the number of partitions read back into memory by the last verification
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of partitions joined or compared, or 0 if the data was read all at once
+        */
+        ul getPartitionCount() const;
+
+        /*! \brief Gets the number of bytes spilled to disk by the last verification
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of bytes of partitions written to temporary files
+        */
+        ul getSpilledBytes() const;
+
+        /* Member Functions */
+
+        /*! \brief Joins the rows of the normalized tables and compares them to the rows of the data
+            \throws std::invalid_argument If the CSV file has no column for a row of a normalized table
+            \throws std::filesystem::filesystem_error If the CSV file cannot be read or a temporary file cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If every column is held by a normalized table and the join gives back exactly the distinct rows of the data
+        */
+        bool verify();
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Verifies the decomposition with a #DataJoinVerifier over every row of the data at once
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the join gives back exactly the distinct rows of the data
+        */
+        bool verifyInMemory();
+
+        /*! \brief Orders the tables of the join as #DataJoinVerifier does, and finds the columns of each step
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void planJoin();
+
+        /*! \brief Joins the rows of one step of the join, one partition at a time
+            \param[in] joinPath The file of the rows joined so far and the rows of the next table
+            \param[in] position The position in #joinOrder of the next table
+            \param[in, out] output The file the joined rows are written to, as the rows joined so far of the next step, or the joined rows to compare to the data after the last one
+            \param[in] rowLimit The number of rows of the data, past which the join is stopped
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void joinStep(const std::string &joinPath, const std::size_t position, std::ostream &output, const ul rowLimit);
+
+        /*! \brief Compares the joined rows of a partition to its rows of the data
+            \param[in] partition The rows of the partition, on the covered columns and #DATA_JOIN_SIDE_COLUMN
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void comparePartition(const table::instance::TableInstance &partition);
+
+        /*! \brief Appends the rows of a CSV file to a file with other columns
+            \param[in] csvPath The path of the CSV file
+            \param[in] layout The columns of the file to append to, other than #DATA_JOIN_SIDE_COLUMN, where a column the CSV file does not have is left empty
+            \param[in] side The #DATA_JOIN_SIDE_COLUMN of every appended row
+            \param[in, out] output The file to append to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows appended
+        */
+        ul appendRows(const std::string &csvPath, const std::vector<std::string> &layout, const std::string &side, std::ostream &output) const;
+
+        /*! \brief Hashes the values of some columns of a row of a partition
+            \param[in] partition The rows of the partition
+            \param[in] row The index of the row
+            \param[in] columns The columns to hash
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The hash of the value identifiers of \p columns
+        */
+        static ul hashValues(const table::instance::TableInstance &partition, const ui row, const std::vector<us> &columns);
+
+        /*! \brief Checks if two rows of a partition agree on every one of \p columns
+            \param[in] partition The rows of the partition
+            \param[in] first The index of the first row
+            \param[in] second The index of the second row
+            \param[in] columns The columns to compare
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the rows have the same value in each of \p columns
+        */
+        static bool rowsAgree(const table::instance::TableInstance &partition, const ui first, const ui second, const std::vector<us> &columns);
+
+        /*! \brief Appends a row to the text of a CSV file
+            \param[in, out] text The text to append to
+            \param[in] values The values of the row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void appendCsvRow(std::string &text, const std::vector<std::string> &values);
+
+        /*! \brief Opens a temporary file for writing
+            \param[in] path The path of the file
+            \throws std::filesystem::filesystem_error If the file cannot be opened
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::ofstream The open file
+        */
+        static std::ofstream openFile(const std::string &path);
+
+        /*! \brief Closes a temporary file once it is written
+            \param[in, out] output The file
+            \param[in] path The path of \p output
+            \throws std::filesystem::filesystem_error If the file could not be written in full
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void closeFile(std::ofstream &output, const std::string &path);
+
+        std::string dataPath;                                /*!< The path of the CSV data file */
+        std::vector<std::string> columnNames;                /*!< The columns of the data the normalized tables should cover */
+        materialization::ExternalMaterializer &materializer; /*!< The materializer of the normalized tables */
+        std::vector<table::Table> tables;                    /*!< The normalized tables */
+        std::string temporaryPath;                           /*!< The directory the rows are spilled to */
+        ul memoryLimit;                                      /*!< The most bytes of memory a partition may take once read back */
+        std::vector<std::string> coveredColumns;             /*!< The columns of the data held by a normalized table, in the order of #columnNames */
+        std::vector<std::string> uncoveredColumns;           /*!< The columns of the data no normalized table holds */
+        std::vector<std::size_t> joinOrder;                  /*!< The normalized tables in the order they are joined */
+        std::vector<std::vector<std::string>> keyColumns;    /*!< The columns each table of #joinOrder shares with the tables before it */
+        std::vector<std::vector<std::string>> layouts;       /*!< The columns of the rows joined up to each table of #joinOrder */
+        ul distinctCount;                                    /*!< The number of distinct rows of the data on #coveredColumns */
+        ul joinedCount;                                      /*!< The number of rows joined by the last verification */
+        ul partitionCount;                                   /*!< The number of partitions read back by the last verification */
+        ul spilledBytes;                                     /*!< The number of bytes spilled by the last verification */
+        bool overflowed;                                     /*!< If the last verification stopped a join that grew past the rows of the data */
+        bool matched;                                        /*!< If every partition compared so far had the totals of its rows of the data */
+        std::vector<std::vector<std::string>> spuriousRows;  /*!< Joined rows that are not rows of the data */
+        std::vector<std::vector<std::string>> missingRows;   /*!< Rows of the data the join did not give back */
+    };
+}
@@ -0,0 +1,106 @@
+/*! \file losslessJoinVerifier.h
+    \brief Header file for verifying that a decomposition is lossless.
+    \details Contains the function declarations for proving or refuting that the tables of a decomposition join back into the input table
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+#include "Dependencies/Chase/chaseTableau.h"
+
+namespace normalizer::verification
+{
+    /*! \headerfile losslessJoinVerifier.h
+        \brief The outcome of chasing the tableau of a decomposition
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    enum class JoinResult
+    {
+        LOSSLESS,    /*!< The chase produced a row of distinguished symbols */
+        LOSSY,       /*!< The chase ended without a row of distinguished symbols */
+        INCONCLUSIVE /*!< The chase reached its row limit without a row of distinguished symbols, so the decomposition may still be lossless */
+    };
+
+    /*! \headerfile losslessJoinVerifier.h
+        \brief Verifies that a decomposition is lossless by chasing its tableau
+        \details A decomposition is lossless when chasing its tableau with the dependencies of the schema produces a row of distinguished symbols
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class LosslessJoinVerifier
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a verifier for the dependencies of a schema
+            \param[in] inFunctionalDependencies The functional dependencies of the schema
+            \param[in] inMultivaluedDependencies The multi valued dependencies of the schema
+            \param[in] count The number of attributes in the schema
+            \param[in] inJoinDependencies The join dependencies of the schema
+            \param[in] inMaxRows The most rows the tableau may grow to from multi valued and join dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        LosslessJoinVerifier(const std::vector<dependencies::functional::FunctionalDependency> &inFunctionalDependencies, const std::vector<dependencies::multivalued::MultivaluedDependency> &inMultivaluedDependencies, const us count, const std::vector<dependencies::join::JoinDependency> &inJoinDependencies = {}, const ui inMaxRows = CHASE_ROW_LIMIT);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~LosslessJoinVerifier() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the attributes of the schema that the last verified decomposition left out
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The attributes that no table of the last verified decomposition holds
+        */
+        const dependencies::attribute::AttributeSet &getUncoveredAttributes() const;
+
+        /*! \brief Gets the number of rows the tableau of the last verified decomposition grew to
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of rows the tableau of the last verified decomposition grew to
+        */
+        ui getChaseRowCount() const;
+
+        /* Member Functions */
+
+        /*! \brief Proves or refutes that a decomposition is lossless
+            \details A decomposition that leaves out an attribute is never lossless. If the chase has to leave out rows to stay within #maxRows and finds no row of distinguished symbols, neither is proven.
+            \param[in] components The attributes of each table of the decomposition
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return JoinResult If the decomposition is lossless, lossy, or could not be decided within #maxRows rows
+        */
+        JoinResult verify(const std::vector<dependencies::attribute::AttributeSet> &components);
+
+    private:
+        std::vector<dependencies::functional::FunctionalDependency> functionalDependencies;    /*!< The functional dependencies of the schema */
+        std::vector<dependencies::multivalued::MultivaluedDependency> multivaluedDependencies; /*!< The multi valued dependencies of the schema */
+        std::vector<dependencies::join::JoinDependency> joinDependencies;                      /*!< The join dependencies of the schema */
+        us attributeCount;                                                                     /*!< The number of attributes in the schema */
+        dependencies::attribute::AttributeSet uncoveredAttributes;                             /*!< The attributes that no table of the last verified decomposition holds */
+        ui chaseRowCount;                                                                      /*!< The number of rows the tableau of the last verified decomposition grew to */
+        ui maxRows;                                                                            /*!< The most rows the tableau may grow to from multi valued and join dependencies */
+    };
+}
\ No newline at end of file
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <map>
+#include <optional>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -17,6 +20,22 @@
 #include "FileManager/fileManager.h"
 #include "Table/table.h"
 #include "Dependencies/dependencyManager.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Closure/closureMatrix.h"
+#include "Dependencies/Graph/dependencyGraph.h"
+#include "Dependencies/Keys/primeAttributeService.h"
+#include "Dependencies/Basis/dependencyBasis.h"
+#include "Dependencies/Projection/dependencyProjector.h"
+#include "Dependencies/Comparison/dependencyComparator.h"
+#include "Normalizer/Analysis/normalFormAnalysis.h"
+#include "Normalizer/Decomposition/fourNFDecomposer.h"
+#include "Normalizer/Decomposition/fiveNFDecomposer.h"
+#include "Normalizer/Verification/losslessJoinVerifier.h"
+#include "Normalizer/Verification/dependencyPreservationVerifier.h"
+#include "Normalizer/Incremental/incrementalNormalizer.h"
+#include "Normalizer/Pipeline/passManager.h"
 #include "Interpreter/Parser/parser.h"
 
 namespace normalizer
@@ -52,7 +71,10 @@ namespace normalizer
             \version 1.0
             \author Matthew Moore
         */
-        Normalizer(const NormalizationForm &normalizeForm, const bool getNormalizedForm, const table::Table &sqlTable, const dependencies::DependencyManager &functionalDependencies) : normalizeTo(normalizeForm), getHighestForm(getNormalizedForm), table(sqlTable), dependencies(functionalDependencies) {}
+        Normalizer(const NormalizationForm &normalizeForm, const bool getNormalizedForm, const table::Table &sqlTable, const dependencies::DependencyManager &functionalDependencies) : normalizeTo(normalizeForm), getHighestForm(getNormalizedForm), table(sqlTable), inputTable(sqlTable), dependencies(functionalDependencies), hasPrimaryKey(true), hasNullableRows(false), verifyDecomposition(false), joinResult(verification::JoinResult::LOSSY)
+        {
+            this->initializeDependencyAnalysis();
+        }
 
         /*! \brief The default destructor
             \date 10/27/2023
@@ -71,6 +93,82 @@ namespace normalizer
         */
         std::vector<table::Table> &getNormalizedTables();
 
+        /*! \brief Gets the table as it was parsed, before any normalization
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return Table The input table, whose rows are the columns of the data of the normalized tables
+        */
+        const table::Table &getInputTable() const;
+
+        /*! \brief Gets the functional dependencies of the dependency file, as they were declared
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> One functional dependency for each dependency row with single valued dependencies
+        */
+        std::vector<dependencies::functional::FunctionalDependency> getDeclaredDependencies() const;
+
+        /*! \brief Gets the functional dependencies that hold on a table
+            \details Projects the dependencies of the input table onto the rows of \p inTable, which the 2NF, 3NF and BCNF checks of each normalized table use instead of the input table's
+            \param[in] inTable The table to get the dependencies of
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> A minimal cover of the dependencies that hold on \p inTable
+        */
+        std::vector<dependencies::functional::FunctionalDependency> getTableDependencies(const table::Table &inTable);
+
+        /*! \brief Gets the dictionary of the input table's row names
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeDictionary The dictionary of the input table's row names
+        */
+        const dependencies::attribute::AttributeDictionary &getAttributeDictionary() const;
+
+        /*! \brief Sets if the normalized tables should be checked to join back losslessly after every normalization
+            \param[in] verify If the normalized tables should be checked
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void setVerifyDecomposition(const bool verify);
+
+        /*! \brief Gets if the normalized tables join back into the input table without losing or adding any rows
+            \pre #verifyDecomposition must be set before calling #normalize
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return JoinResult If the last normalization was verified to be lossless, lossy, or could not be decided within #normalizer::verification::CHASE_ROW_LIMIT rows
+        */
+        verification::JoinResult getJoinResult() const;
+
+        /*! \brief Gets the dependencies of the input table that the normalized tables no longer enforce
+            \pre #verifyDecomposition must be set before calling #normalize
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<FunctionalDependency> The dependencies the last normalization did not preserve
+        */
+        const std::vector<dependencies::functional::FunctionalDependency> &getLostDependencies() const;
+
+        /*! \brief Gets the closures under the input table's dependencies that every pass shares
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ClosureCache The closure cache of the run, along with its hit and miss counts
+        */
+        const dependencies::closure::ClosureCache &getClosureCache() const;
+
+        /*! \brief Gets the attributes of the input table that are in some candidate key
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return AttributeSet The prime attributes of the input table
+        */
+        const dependencies::attribute::AttributeSet &getPrimeAttributes() const;
+
         /* Member Functions */
 
         /*! \brief Normalizes the database according to #normalizeTo
@@ -80,6 +178,52 @@ namespace normalizer
         */
         void normalize();
 
+        /*! \brief Normalizes the database to several forms in one run of the passes
+            \details The passes run once, up to the highest of \p targetForms, so each form starts from the tables of the one below it and every form shares the closures, keys and analysis of the input table. The input table is left as it was parsed, so this can be called again. #normalizedTables holds the tables of the highest form afterwards, which is the one verified when #verifyDecomposition is set.
+            \param[in] targetForms The forms to normalize to, in any order
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::map<NormalizationForm, std::vector<Table>> The normalized tables of each of \p targetForms
+        */
+        std::map<NormalizationForm, std::vector<table::Table>> normalize(const std::vector<NormalizationForm> &targetForms);
+
+        /*! \brief Classifies the input table into its highest normal form without normalizing it
+            \details The keys, prime attributes and closures are shared by every level, and the analysis is only computed on the first call. When #getHighestForm is set, #normalize calls this before any pass changes the input table.
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return NormalFormAnalysis The highest normal form of the input table and the violations of every level
+        */
+        const analysis::NormalFormAnalysis &analyze();
+
+        /*! \brief Creates an incremental normalizer that keeps the closures and normalized tables of this normalization in memory
+            \pre #normalize must be called first
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return IncrementalNormalizer The incremental normalizer for #normalizedTables
+        */
+        incremental::IncrementalNormalizer createIncrementalNormalizer() const;
+
+        /*! \brief Compares the functional dependencies of the input table against those of another dependency file for the same table
+            \param[in] dependencyFilePath The path to the other dependency file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return DependencyComparator The comparison of the input table's dependencies, as the old version, against the other file's, as the new version
+        */
+        dependencies::comparison::DependencyComparator compareDependencies(const std::string &dependencyFilePath) const;
+
+        /*! \brief Converts normalized tables into their SQL, skipping the tables with only one row
+            \param[in] tables The tables to print
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The CREATE TABLE statement of each table with more than one row
+        */
+        std::string printTables(std::vector<table::Table> &tables);
+
         /* Operator Overloads */
 
         /*! \brief Pretty print the \ref #normalizer::Normalizer "Normalizer"
@@ -97,6 +241,28 @@ namespace normalizer
     private:
         /* Member Functions */
 
+        /*! \brief Builds #attributeDictionary, #closureCache, #closureMatrix, #dependencyGraph, #primeAttributes and #basisCalculator from the input table and its dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void initializeDependencyAnalysis();
+
+        /*! \brief Gets the attributes of each of #normalizedTables
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<AttributeSet> The attributes of each normalized table
+        */
+        std::vector<dependencies::attribute::AttributeSet> getNormalizedComponents() const;
+
+        /*! \brief Checks that #normalizedTables join back into the input table and preserve its dependencies
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void verifyNormalizedTables();
+
         /*! \brief Converts a 1NF database into a string representation
             \param [in] inTable The table to print
             \date 10/28/2023
@@ -122,7 +288,18 @@ namespace normalizer
         */
         void normalizeToOneNF();
 
+        /*! \brief Creates the pipeline of normalization passes, from 1NF to 5NF
+            \details Every pass keeps the closures and keys of the input table, while a pass that changes #normalizedTables invalidates #tableDependencies and the partial, transitive and BCNF dependencies of #workingAnalysis, which the next pass computes again for the new tables
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return PassManager The pass manager that runs every pass in order
+        */
+        pipeline::PassManager createPassManager();
+
         /*! \brief Normalizes the database into 2NF
+            \details Each left hand side of a partial dependency gets a table of its own with every row it decides, keyed on it. The rows that are in no candidate key leave the table they were split from, which keeps its primary key and references each new table
+            \pre #table must already be in 1NF
             \date 10/29/2023
             \version 1.0
             \author Matthew Moore
@@ -130,6 +307,7 @@ namespace normalizer
         void normalizeToTwoNF();
 
         /*! \brief Normalizes the database into 3NF
+            \pre #normalizedTables must already be in 2NF
             \date 10/30/2023
             \version 1.0
             \author Matthew Moore
@@ -137,6 +315,7 @@ namespace normalizer
         void normalizeToThreeNF();
 
         /*! \brief Normalizes the database into BCNF
+            \pre #normalizedTables must already be in 3NF
             \date 10/30/2023
             \version 1.0
             \author Matthew Moore
@@ -144,6 +323,7 @@ namespace normalizer
         void normalizeToBCNF();
 
         /*! \brief Normalizes the database into 4NF
+            \pre #normalizedTables must already be in BCNF
             \date 10/30/2023
             \version 1.0
             \author Matthew Moore
@@ -151,6 +331,7 @@ namespace normalizer
         void normalizeToFourNF();
 
         /*! \brief Normalizes the database into 5NF
+            \pre #normalizedTables must already be in 4NF
             \date 10/31/2023
             \version 1.0
             \author Matthew Moore
@@ -192,45 +373,85 @@ namespace normalizer
         */
         std::vector<std::string> getNonDependentRows();
 
-        /*! \brief Gets the partial dependencies in the database
-            \date 10/29/2023
+        /*! \brief Finds the dependencies that violate 2NF, 3NF and BCNF in each of \p tables
+            \details Each table is checked against its own dependencies, projected from those of the input table, and its own candidate keys
+            \param[out] result The analysis whose partial, transitive and BCNF dependencies are replaced
+            \param[in] tables The tables to check
+            \param[in] dependenciesOfTables The projected dependencies of each of \p tables
+            \date 10/18/2026
             \version 1.0
             \author Matthew Moore
-            \return std::vector<std::pair<std::string, std::string>> The partial dependencies in the database
         */
-        std::vector<std::pair<std::string, std::string>> getPartialDependencies();
-
-        /*! \brief Gets the transitive dependencies in the database
-            \date 10/29/2023
+        void findKeyViolations(analysis::NormalFormAnalysis &result, const std::vector<table::Table> &tables, const std::vector<std::vector<dependencies::functional::FunctionalDependency>> &dependenciesOfTables);
+
+        /*! \brief Finds the dependencies that violate 2NF, 3NF and BCNF in one pass over the dependencies of a table
+            \details Of the dependencies whose left hand side is not a superkey of the table, one from part of a candidate key to a row in no candidate key is partial, and one from any other rows is transitive. One between the prime rows of a group that determine each other is a BCNF violation
+            \param[in, out] result The analysis the partial, transitive and BCNF dependencies of the table are added to
+            \param[in] relation The rows of the table
+            \param[in] relationDependencies A minimal cover of the dependencies that hold on \p relation
+            \date 10/18/2026
             \version 1.0
             \author Matthew Moore
-            \return std::vector<std::pair<std::string, std::string>> The transitive dependencies in the database
         */
-        std::vector<std::pair<std::string, std::string>> getTrasitiveDependencies();
+        void findKeyViolations(analysis::NormalFormAnalysis &result, const dependencies::attribute::AttributeSet &relation, const std::vector<dependencies::functional::FunctionalDependency> &relationDependencies);
 
-        /*! \brief Gets the dependencies that violate BCNF
+        /*! \brief Gets the multi valued dependencies in the database that violate 4NF
+            \details Violations that are functional dependencies are left to the BCNF checks, so only dependencies that need a multi valued dependency are returned
             \date 10/30/2023
             \version 1.0
             \author Matthew Moore
-            \return std::vector<std::pair<std::string, std::string>> The dependencies that violate BCNF
+            \return std::vector<std::pair<std::string, std::string>> The left hand side and each multi valued row of every violation
         */
-        std::vector<std::pair<std::string, std::string>> getBCNFDependencies();
+        std::vector<std::pair<std::string, std::string>> getMultiValuedDependencies();
 
-        /*! \brief Gets the multi valued dependencies in the database
-            \date 10/30/2023
+        /*! \brief Gets the left hand sides of the declared functional and multi valued dependencies
+            \date 10/18/2026
             \version 1.0
             \author Matthew Moore
-            \return std::vector<std::pair<std::string, std::string>> The multi valued dependencies in the database
+            \return std::vector<AttributeSet> The left hand sides of the declared dependencies
         */
-        std::vector<std::pair<std::string, std::string>> getMultiValuedDependencies();
+        std::vector<dependencies::attribute::AttributeSet> getDeclaredDeterminants() const;
 
-        /*! \brief Gets the join dependencies in the database
+        /*! \brief Creates the table holding the rows of \p sourceTable that are in \p component
+            \details The primary key is a candidate key of \p component, and the foreign keys of \p sourceTable on rows of \p component are kept
+            \param[in] sourceTable The table that was decomposed
+            \param[in] component The attributes of the new table
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return Table The table of \p component
+        */
+        table::Table createComponentTable(const table::Table &sourceTable, const dependencies::attribute::AttributeSet &component);
+
+        /*! \brief Creates the table holding the rows of \p sourceTable that are in \p component, with a given name and primary key
+            \details The foreign keys of \p sourceTable on rows of \p component are kept
+            \param[in] sourceTable The table that was decomposed
+            \param[in] component The attributes of the new table
+            \param[in] tableName The name of the new table
+            \param[in] primaryKey The rows of the primary key of the new table, which must be a key of \p component
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return Table The table of \p component
+        */
+        table::Table createComponentTable(const table::Table &sourceTable, const dependencies::attribute::AttributeSet &component, const std::string &tableName, const dependencies::attribute::AttributeSet &primaryKey);
+
+        /*! \brief Adds the tables split off by the 3NF or BCNF pass to #normalizedTables
+            \details A table named like one of #normalizedTables is keyed on the same row, so its rows are merged into that table instead
+            \param[in] newTables The split off tables, by the row they are keyed on
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addNewTables(const std::unordered_map<std::string, table::Table> &newTables);
+
+        /*! \brief Gets the declared join dependencies that violate 5NF on the input table
             \date 10/31/2023
             \version 1.0
             \author Matthew Moore
-            \return std::vector<std::pair<std::string, std::string>> The join dependencies in the database
+            \return std::vector<JoinDependency> The join dependencies over the input table that its candidate keys do not imply
         */
-        std::vector<std::pair<std::string, std::string>> getJoinDependencies();
+        std::vector<dependencies::join::JoinDependency> getJoinDependencies();
 
         /*! \brief Converts a row name into a table name
             \param[in] rowName The row name to be converted
@@ -241,13 +462,6 @@ namespace normalizer
         */
         std::string convertRowToTableName(const std::string &rowName) const;
 
-        /*! \brief Creates a connection table based on the composite key
-            \date 10/30/2023
-            \version 1.0
-            \author Matthew Moore
-        */
-        void createTableOnCompositeKey();
-
         /*! \brief Gets the highest normalized form of the user's input table
             \date 11/02/2023
             \version 1.0
@@ -256,12 +470,27 @@ namespace normalizer
         */
         us getHighestNormalizedForm();
 
-        NormalizationForm normalizeTo;                /*!< The normalization form to go to */
-        bool getHighestForm;                          /*!< If the user wants to get the highest normalized form of the table */
-        table::Table table;                           /*!< The table to normalizer */
-        std::vector<table::Table> normalizedTables;   /*!< The normalized tables */
-        dependencies::DependencyManager dependencies; /*!< The functional dependencies of the project */
-        bool hasPrimaryKey;                           /*!< If the table has a primary key set */
-        bool hasNullableRows;                         /*!< If the table has any nullable rows */
+        NormalizationForm normalizeTo;                                                              /*!< The normalization form to go to */
+        bool getHighestForm;                                                                        /*!< If the user wants to get the highest normalized form of the table */
+        table::Table table;                                                                         /*!< The table to normalizer */
+        table::Table inputTable;                                                                    /*!< The table as it was parsed, which every run of the passes starts from */
+        std::vector<table::Table> normalizedTables;                                                 /*!< The normalized tables */
+        dependencies::DependencyManager dependencies;                                               /*!< The functional dependencies of the project */
+        bool hasPrimaryKey;                                                                         /*!< If the table has a primary key set */
+        bool hasNullableRows;                                                                       /*!< If the table has any nullable rows */
+        dependencies::attribute::AttributeDictionary attributeDictionary;                           /*!< The identifiers of the input table's row names */
+        dependencies::closure::ClosureCache closureCache;                                           /*!< The closures under the input table's dependencies, shared by every pass of a run */
+        dependencies::closure::ClosureMatrix closureMatrix;                                         /*!< The closure of every single attribute of the input table, for the passes that compare rows one at a time */
+        dependencies::graph::DependencyGraph dependencyGraph;                                       /*!< The groups of rows of the input table that determine each other, each standing in as its first row */
+        std::vector<dependencies::attribute::AttributeSet> candidateKeys;                           /*!< The candidate keys of the input table */
+        dependencies::attribute::AttributeSet primeAttributes;                                      /*!< The attributes of the input table that are in some candidate key */
+        dependencies::basis::DependencyBasisCalculator basisCalculator;                             /*!< The dependency bases under the input table's functional and multi valued dependencies */
+        bool verifyDecomposition;                                                                   /*!< If the normalized tables are verified after every normalization */
+        verification::JoinResult joinResult;                                                        /*!< If the last normalization was verified to be lossless, lossy, or could not be decided */
+        analysis::NormalFormAnalysis workingAnalysis;                                               /*!< The partial, transitive and BCNF dependencies of #normalizedTables that the passes split on */
+        std::vector<std::vector<dependencies::functional::FunctionalDependency>> tableDependencies; /*!< The dependencies of each of #normalizedTables, projected from those of the input table */
+        std::optional<analysis::NormalFormAnalysis> normalFormAnalysis;                             /*!< The analysis of the input table, once #analyze has been called */
+        dependencies::attribute::AttributeSet uncoveredAttributes;                                  /*!< The attributes of the input table that no normalized table holds */
+        std::vector<dependencies::functional::FunctionalDependency> lostDependencies;               /*!< The dependencies of the input table that the normalized tables do not preserve */
     };
 }
\ No newline at end of file
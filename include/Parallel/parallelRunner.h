@@ -0,0 +1,43 @@
+/*! \file parallelRunner.h
+    \brief Header file for running a task over a range of indices across threads.
+    \details Contains the function declarations for splitting a range of indices into one contiguous chunk per thread and carrying the errors of the threads back to the caller
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace normalizer::parallel
+{
+    /*! \headerfile parallelRunner.h
+        \brief Runs a task over a range of indices, split across threads
+        \details Each thread runs the task over one contiguous chunk of the indices, so the chunks of earlier threads hold the earlier indices
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ParallelRunner
+    {
+    public:
+        /* Static Functions */
+
+        /*! \brief Runs \p task over the indices up to \p count, with at most one thread per \p indicesPerThread indices
+            \details Every thread is joined before returning, even when one of them throws
+            \param[in] count The number of indices
+            \param[in] indicesPerThread The fewest indices worth starting another thread for
+            \param[in] task Runs over the indices from its first argument up to its second
+            \throws Any The error thrown by \p task over the earliest indices, once every thread has finished
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void run(const std::size_t count, const std::size_t indicesPerThread, const std::function<void(std::size_t, std::size_t)> &task);
+    };
+}
@@ -0,0 +1,232 @@
+/*! \file externalPartitioner.h
+    \brief Header file for splitting the rows of a CSV data file into partitions that each fit in memory.
+    \details Contains the function declarations for spilling the rows of a CSV data file to disk in partitions by a key, and reading the partitions back one at a time under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "FileManager/csvReader.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::table::external
+{
+    /*! \headerfile externalPartitioner.h
+        \brief Reads the rows of a CSV data file in partitions that each fit under a memory limit
+        \details Every analysis that groups rows by a key only ever compares rows with the same key, so it can run on each partition of the rows by the hash of the key on its own. A file that fits in memory is read all at once. A larger one is read a window of chunks at a time, and the values of the columns of each row are appended to one of up to #EXTERNAL_MAX_FANOUT files in a temporary directory, picked by the top bits of the hash of its key. Each file is then read back into memory, unless it is still too large, in which case it is split again by a hash with a different seed. The rows are written in segments, each holding the rows of one chunk with the index of the first of them, so the rows of every partition keep their order and their index in the file without the chunks ever waiting on each other.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ExternalPartitioner
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a partitioner of the rows of a CSV file
+            \post The \p csvPath passed will be verified as a valid file path
+            \param[in] csvPath The path of the CSV file
+            \param[in] inTemporaryPath The directory the partitions are spilled to
+            \param[in] inMemoryLimit The most bytes of memory a partition may take once read back
+            \throws std::filesystem::filesystem_error If \p inTemporaryPath is not a directory
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ExternalPartitioner(const std::string &csvPath, const std::string &inTemporaryPath, const ul inMemoryLimit);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ExternalPartitioner() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the memory limit of the partitions
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The most bytes of memory a partition may take once read back
+        */
+        ul getMemoryLimit() const;
+
+        /*! \brief Gets the number of partitions read back into memory so far
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of partitions visited since the partitioner was created
+        */
+        ul getPartitionCount() const;
+
+        /*! \brief Gets the number of bytes spilled to disk so far
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of bytes written to temporary files since the partitioner was created
+        */
+        ul getSpilledBytes() const;
+
+        /* Member Functions */
+
+        /*! \brief Reads the rows of the CSV file in partitions by a key, one partition at a time
+            \param[in] columnNames The columns of the file to read
+            \param[in] keyColumns The index in \p columnNames of each column of the key, where rows with the same values in them always share a partition
+            \param[in] visit Called with the rows of each partition, and the index in the file of each of them, ascending
+            \throws std::invalid_argument If the file has no column for one of \p columnNames, or a row does not have one value per column
+            \throws std::filesystem::filesystem_error If the file cannot be read or a partition cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void forEachPartition(const std::vector<std::string> &columnNames, const std::vector<us> &keyColumns, const std::function<void(const instance::TableInstance &, const std::vector<ul> &)> &visit);
+
+        /*! \brief Parses a memory limit such as 512M or 8G
+            \param[in] text A number of bytes, followed by an optional K, M or G for kibibytes, mebibytes or gibibytes
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of bytes, or 0 if \p text is not a memory limit
+        */
+        static ul parseMemoryLimit(const std::string &text);
+
+    private:
+        /* Member Functions */
+
+        /*! \brief Gets the number of partitions a number of bytes of rows are split into
+            \param[in] bytes The number of bytes of the rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t A power of two from 2 to #EXTERNAL_MAX_FANOUT, enough for each partition to fit under the memory limit if the keys spread evenly
+        */
+        std::size_t countPartitions(const ul bytes) const;
+
+        /*! \brief Splits the rows of the CSV file into partition files
+            \param[in] columns The column of the file of each value written for a row
+            \param[in] keyColumns The column of the file of each column of the key
+            \param[in] paths The path of each partition file
+            \throws std::filesystem::filesystem_error If a partition file cannot be written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void spillFile(const std::vector<us> &columns, const std::vector<us> &keyColumns, const std::vector<std::string> &paths);
+
+        /*! \brief Reads a partition file back into memory and visits it, or splits it again if it does not fit
+            \param[in] path The path of the partition file, which is removed once read
+            \param[in] columnNames The columns of the rows of the file
+            \param[in] keyColumns The index in \p columnNames of each column of the key
+            \param[in] depth The number of times the rows of the file were split
+            \param[in] visit Called with the rows of each partition and the index in the CSV file of each of them
+            \throws std::filesystem::filesystem_error If a partition file cannot be read or written
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void visitPartition(const std::string &path, const std::vector<std::string> &columnNames, const std::vector<us> &keyColumns, const us depth, const std::function<void(const instance::TableInstance &, const std::vector<ul> &)> &visit);
+
+        /*! \brief Opens a partition file for writing
+            \param[in] path The path of the file
+            \throws std::filesystem::filesystem_error If the file cannot be opened
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::ofstream The open file
+        */
+        static std::ofstream openPartition(const std::string &path);
+
+        /*! \brief Closes partition files once they are written
+            \param[in, out] outputs The partition files
+            \param[in] paths The path of each of \p outputs
+            \throws std::filesystem::filesystem_error If a partition file could not be written in full
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void closePartitions(std::vector<std::ofstream> &outputs, const std::vector<std::string> &paths);
+
+        /*! \brief Appends the rows of one chunk to a partition file
+            \param[in, out] output The partition file
+            \param[in] firstRow The index in the CSV file of the first row of the chunk
+            \param[in] records The rows of the chunk that belong to the partition, as written by #appendRecord
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void writeSegment(std::ofstream &output, const ul firstRow, const std::string &records);
+
+        /*! \brief Reads the next segment of a partition file
+            \param[in, out] input The partition file
+            \param[out] firstRow The index in the CSV file of the first row of the chunk of the segment
+            \param[out] records The rows of the segment
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If a segment was read, or false at the end of the file
+        */
+        static bool readSegment(std::ifstream &input, ul &firstRow, std::string &records);
+
+        /*! \brief Appends a row to the records of a segment
+            \param[in, out] records The records to append to
+            \param[in] localRow The index of the row in its chunk
+            \param[in] values The values of the row
+            \param[in] columns The index in \p values of each value to write
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        static void appendRecord(std::string &records, const ui localRow, const std::vector<std::string> &values, const std::vector<us> &columns);
+
+        /*! \brief Reads a row from the records of a segment
+            \param[in] records The records of the segment
+            \param[in] position The index of the first byte of the row in \p records
+            \param[out] localRow The index of the row in its chunk
+            \param[in, out] values Sized to the number of columns of the row, which are filled with its values
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The index in \p records after the row
+        */
+        static std::size_t readRecord(const std::string &records, std::size_t position, ui &localRow, std::vector<std::string> &values);
+
+        /*! \brief Picks the partition of a row by the hash of its key
+            \param[in] values The values of the row
+            \param[in] keyColumns The index in \p values of each column of the key
+            \param[in] seed The seed of the hash, which differs each time a partition is split again
+            \param[in] fanout The number of partitions, a power of two
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::size_t The partition of the row
+        */
+        static std::size_t choosePartition(const std::vector<std::string> &values, const std::vector<us> &keyColumns, const ul seed, const std::size_t fanout);
+
+        file::CsvReader reader;    /*!< The reader of the CSV file */
+        std::string temporaryPath; /*!< The directory the partitions are spilled to */
+        ul memoryLimit;            /*!< The most bytes of memory a partition may take once read back */
+        ul partitionCount;         /*!< The number of partitions visited so far */
+        ul spilledBytes;           /*!< The number of bytes written to temporary files so far */
+    };
+}
@@ -0,0 +1,160 @@
+/*! \file tableInstance.h
+    \brief Header file for the rows of data of a table.
+    \details Contains the function declarations for storing the rows of a table column by column, with every value replaced by a small identifier
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+
+namespace normalizer::table::instance
+{
+    /*! \headerfile tableInstance.h
+        \brief The rows of data of a table, stored column by column
+        \details Every distinct value of a column is given an identifier in the order it first appears, so two rows agree on a column exactly when their identifiers are equal. Comparing rows then never touches the strings, which is all that dependency discovery needs.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class TableInstance
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief The default constructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TableInstance() : rowCount(0) {}
+
+        /*! \brief Creates an instance with no rows
+            \param[in] inColumnNames The name of each column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TableInstance(const std::vector<std::string> &inColumnNames);
+
+        /*! \brief Creates an instance from columns that are already encoded
+            \param[in] inColumnNames The name of each column
+            \param[in] inColumns The value identifier of each row, one vector per column
+            \param[in] inColumnValues The distinct values of each column, indexed by identifier
+            \throws std::invalid_argument If the columns do not all have the same number of rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        TableInstance(const std::vector<std::string> &inColumnNames, std::vector<std::vector<ui>> &&inColumns, std::vector<std::vector<std::string>> &&inColumnValues);
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~TableInstance() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the name of each column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<std::string> The column names, in the order of the values of each row
+        */
+        const std::vector<std::string> &getColumnNames() const;
+
+        /*! \brief Gets the number of columns
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return us The number of columns
+        */
+        us getColumnCount() const;
+
+        /*! \brief Gets the number of rows
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of rows
+        */
+        ui getRowCount() const;
+
+        /*! \brief Gets the value identifiers of a column
+            \param[in] column The index of the column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::vector<ui> The identifier of the value of \p column in each row
+        */
+        const std::vector<ui> &getColumn(const us column) const;
+
+        /*! \brief Gets the number of distinct values of a column
+            \param[in] column The index of the column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ui The number of distinct values, which is one more than the largest identifier of \p column
+        */
+        ui getDistinctCount(const us column) const;
+
+        /*! \brief Gets the value of a column in a row
+            \param[in] row The index of the row
+            \param[in] column The index of the column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The value of \p column in \p row
+        */
+        const std::string &getValue(const ui row, const us column) const;
+
+        /*! \brief Gets the value of a column with an identifier
+            \param[in] column The index of the column
+            \param[in] id The identifier of the value
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return std::string The value of \p column that \p id stands for
+        */
+        const std::string &getDistinctValue(const us column, const ui id) const;
+
+        /* Member Functions */
+
+        /*! \brief Adds a row to the end of the instance
+            \param[in] values The value of each column
+            \throws std::invalid_argument If \p values does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void addRow(const std::vector<std::string> &values);
+
+        /*! \brief Gets the columns with the given names, in the given order
+            \param[in] names The name of each column to keep
+            \throws std::invalid_argument If the instance has no column of one of \p names
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance The rows of the instance with only the columns in \p names
+        */
+        TableInstance selectColumns(const std::vector<std::string> &names) const;
+
+    private:
+        std::vector<std::string> columnNames;                      /*!< The name of each column */
+        std::vector<std::vector<ui>> columns;                      /*!< The value identifier of each row, one vector per column */
+        std::vector<std::vector<std::string>> columnValues;        /*!< The distinct values of each column, indexed by identifier */
+        std::vector<std::unordered_map<std::string, ui>> valueIds; /*!< The identifier of each distinct value of each column */
+        ui rowCount;                                               /*!< The number of rows */
+    };
+}
@@ -0,0 +1,151 @@
+/*! \file reservoirSampler.h
+    \brief Header file for drawing a uniform sample of the rows of a CSV data file in one pass.
+    \details Contains the function declarations for keeping a fixed number of the rows of a CSV data file, picked uniformly at random, while reading it a window of chunks at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "aliases.h"
+#include "constants.h"
+#include "FileManager/csvReader.h"
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::table::sampling
+{
+    /*! \headerfile reservoirSampler.h
+        \brief Keeps a uniform sample of the rows of a CSV file, without holding the rest of them
+        \details Each row is given a random priority from the hash of its position, and the reservoir keeps the rows with the lowest priorities, which is a uniform sample of them whatever order they are read in. Each chunk of a window keeps a reservoir of its own while its thread parses it, and the reservoirs of the chunks are merged into the one of the file once the window is read, so at most one window of the file and one reservoir per chunk are ever held in memory. The priorities only depend on the position of each row, so the same file always gives the same sample.
+        \date 10/18/2026
+        \version 1.0
+        \author Matthew Moore
+    */
+    class ReservoirSampler
+    {
+    public:
+        /* Constructors and Destructors */
+
+        /*! \brief Creates a sampler of the rows of a CSV file
+            \post The \p csvPath passed will be verified as a valid file path
+            \param[in] csvPath The path of the CSV file
+            \param[in] inSampleSize The most rows to keep
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ReservoirSampler(const std::string &csvPath, const ul inSampleSize) : reader(csvPath), sampleSize(inSampleSize), rowCount(0) {}
+
+        /*! \brief The default destructor
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        ~ReservoirSampler() {}
+
+        /* Getters and Setters */
+
+        /*! \brief Gets the most rows the sample keeps
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The size of the reservoir
+        */
+        ul getSampleSize() const;
+
+        /*! \brief Gets the number of rows of the CSV file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows read by the last call to #sample
+        */
+        ul getRowCount() const;
+
+        /*! \brief Gets the index in the CSV file of each sampled row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return const std::vector<ul>& The index of each row of the last sample, ascending
+        */
+        const std::vector<ul> &getRowNumbers() const;
+
+        /* Member Functions */
+
+        /*! \brief Reads the CSV file and keeps a uniform sample of its rows
+            \throws std::filesystem::filesystem_error If the file cannot be opened or mapped into memory
+            \throws std::invalid_argument If a row does not have one value per column
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return TableInstance Up to #sampleSize rows of the file, in the order they appear in it, with every column of the file
+        */
+        instance::TableInstance sample();
+
+        /*! \brief Gets the most rows of a CSV file a sample can keep under a memory limit
+            \details The width of a row is taken from the rows of the first chunk of the file
+            \param[in] csvPath The path of the CSV file
+            \param[in] memoryLimit The most bytes of memory the sample may take
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul The number of rows that fit under \p memoryLimit, which is at least 1
+        */
+        static ul countFittingRows(const std::string &csvPath, const ul memoryLimit);
+
+    private:
+        /*! \brief A row kept by a reservoir
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        struct SampledRow
+        {
+            ul priority;                     /*!< The random priority of the row, where the lowest priorities are kept */
+            ul row;                          /*!< The index of the row in its chunk, or in the file once its window is read */
+            std::vector<std::string> values; /*!< The value of each column of the row */
+        };
+
+        /* Member Functions */
+
+        /*! \brief Checks if a reservoir would keep a row
+            \param[in] reservoir The rows of the reservoir, as a heap with the highest priority first
+            \param[in] priority The priority of the row
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return bool If the reservoir is not full or \p priority is lower than its highest priority
+        */
+        bool accepts(const std::vector<SampledRow> &reservoir, const ul priority) const;
+
+        /*! \brief Adds a row to a reservoir, dropping its row of the highest priority if it is full
+            \param[in, out] reservoir The rows of the reservoir, as a heap with the highest priority first
+            \param[in] sampled The row to add
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+        */
+        void offer(std::vector<SampledRow> &reservoir, SampledRow &&sampled) const;
+
+        /*! \brief Mixes the bits of a number into a random looking priority
+            \param[in] position The position of a row, unique among the rows of the file
+            \date 10/18/2026
+            \version 1.0
+            \author Matthew Moore
+            \return ul A priority, where every bit depends on every bit of \p position
+        */
+        static ul mixPriority(const ul position);
+
+        file::CsvReader reader;     /*!< The reader of the CSV file */
+        ul sampleSize;              /*!< The most rows to keep */
+        ul rowCount;                /*!< The number of rows of the CSV file */
+        std::vector<ul> rowNumbers; /*!< The index in the CSV file of each sampled row */
+    };
+}
@@ -13,7 +13,17 @@
 
 namespace normalizer
 {
-    const us DECIMAL_BASE = 10; /*!< The base of a standard decimal value */
+    const us DECIMAL_BASE = 10;                                           /*!< The base of a standard decimal value */
+    const std::string VERIFY_ARGUMENT = "--verify";                       /*!< The command line argument for checking that the normalized tables join back losslessly, and with --materialize, that their rows join back into the rows of the data */
+    const std::string INCREMENTAL_ARGUMENT = "--incremental";             /*!< The command line argument for adding and retracting dependencies after the normalization */
+    const std::string COMPARE_ARGUMENT = "--compare";                     /*!< The command line argument for comparing the dependency file against another version of it after the normalization */
+    const std::string ANALYZE_ARGUMENT = "--analyze";                     /*!< The command line argument for printing the violations of every normal form instead of normalizing */
+    const std::string DISCOVER_ARGUMENT = "--discover";                   /*!< The command line argument for writing a dependency file from the rows of a CSV data file instead of normalizing */
+    const std::string MATERIALIZE_ARGUMENT = "--materialize";             /*!< The command line argument for writing the rows of a CSV data file into the normalized tables after the normalization */
+    const std::string VALIDATE_ARGUMENT = "--validate";                   /*!< The command line argument for checking the dependency file against the rows of a CSV data file before normalizing */
+    const std::string MEMORY_LIMIT_ARGUMENT = "--memory-limit=";          /*!< The command line argument, followed by a number of bytes with an optional K, M or G suffix, for reading the CSV data file of --materialize, --validate and --discover in partitions spilled to disk instead of all at once */
+    const std::string TEMPORARY_DIRECTORY_ARGUMENT = "--temp-directory="; /*!< The command line argument, followed by a directory, for where the partitions of a CSV data file are spilled under a memory limit */
+    const std::string SAMPLE_ARGUMENT = "--sample=";                      /*!< The command line argument, followed by a number of rows, for checking the dependencies of --discover and --validate on a uniform sample of the rows of a CSV data file, with a bound on how often the rest of the rows could break each of them, before checking only the chosen ones on every row */
 
     namespace file
     {
@@ -21,12 +31,67 @@ namespace normalizer
         const std::string RESOURCES_FOLDER = "resources/";                                     /*!< The top level folder where all user input files will go in */
         const std::string SQL_DATASET_FOLDER = RESOURCES_FOLDER + "sql/";                      /*!< The folder where the sql dataset file(s) will go in */
         const std::string FUNCTIONAL_DEPENDENCIES_FOLDER = RESOURCES_FOLDER + "dependencies/"; /*!< The folder where the functional dependency file(s) will go in */
+        const std::string DATA_FOLDER = RESOURCES_FOLDER + "data/";                            /*!< The folder where the CSV data file(s) will go in */
+        const std::string MATERIALIZED_FOLDER = DATA_FOLDER + "normalized/";                   /*!< The folder where the rows of the normalized tables are written */
+        const std::string MATERIALIZED_INSERT_FILE = "inserts.sql";                            /*!< The file of #MATERIALIZED_FOLDER that the INSERT statements of the normalized tables are written to */
+        const std::string MATERIALIZED_LOAD_FILE = "load.sql";                                 /*!< The file of #MATERIALIZED_FOLDER that the LOAD DATA statements of the normalized tables are written to */
+        const char CSV_SEPARATOR = ',';                                                        /*!< The separator between the values of a CSV row */
+        const char CSV_QUOTE = '"';                                                            /*!< The quote around a CSV value that holds a separator, quote or line break */
+        const std::size_t CSV_CHUNK_BYTES = 1 << 22;                                           /*!< The number of bytes of a CSV file parsed as one chunk, before moving its end to the next row */
+        const std::string TEMPORARY_DIRECTORY_TEMPLATE = "normalizer-XXXXXX";                  /*!< The name of a temporary directory, whose trailing Xs are replaced to make it unique */
 
         // For file validation
         const std::string DIRECTORY_DOES_NOT_EXIST = "Directory does not exist"; /*!< Error message for if the user's directory path is not valid */
         const std::string FILE_DOES_NOT_EXIST = "File does not exist";           /*!< Error message for if the user's file path is not valid */
         const std::string FILE_DID_NOT_OPEN = "File did not open";               /*!< Error message for if the user's file does not open */
         const std::string READ_DIRECTORY_NOT_FILE = "File did not open";         /*!< Error message for if the user tries to read a directory not a file */
+        const std::string FILE_NOT_WRITTEN = "File could not be written";        /*!< Error message for if a file could not be written in full */
+    }
+
+    namespace table
+    {
+        const std::string ROW_WIDTH_MISMATCH = "Row does not have one value per column"; /*!< Error message for if a row of data does not match the columns of its table */
+        const std::string MISSING_DATA_COLUMN = "Data has no column named ";             /*!< Error message for if the rows of data lack a column of their table */
+        const ul EXTERNAL_MEMORY_FACTOR = 4;                                             /*!< The bytes of memory assumed for each byte of a partition spilled to disk once it is read back into memory */
+        const us EXTERNAL_MAX_FANOUT = 256;                                              /*!< The most partitions the rows are split into by one pass, so the most files written at once */
+        const us EXTERNAL_MAX_DEPTH = 4;                                                 /*!< The most times a partition that does not fit in memory is split again, since rows that all share their key can never be split */
+        const ul SAMPLE_SEED = 0x2545f4914f6cdd1dULL;                                    /*!< The seed of the random priority given to each row of a CSV data file when sampling its rows */
+    }
+
+    namespace dependencies
+    {
+        const us ATTRIBUTE_WORD_BITS = 64;                     /*!< The number of attributes stored in each word of an \ref normalizer::dependencies::attribute::AttributeSet "AttributeSet" */
+        const us CLOSURE_CACHE_SHARD_COUNT = 16;               /*!< The number of shards a \ref normalizer::dependencies::closure::ClosureCache "ClosureCache" splits its closures across */
+        const us SUPERKEY_BATCH_SIZE = 64;                     /*!< The number of superkey queries evaluated together, one per bit of a word */
+        const ui DISCOVERY_NODES_PER_THREAD = 8;               /*!< The fewest attribute sets of a lattice level worth starting another thread for when discovering dependencies */
+        const us DISCOVERY_LATTICE_COLUMN_LIMIT = 20;          /*!< The most columns discovered with a lattice search before sampling and validating instead */
+        const double DISCOVERY_SAMPLING_EFFICIENCY = 0.01;     /*!< The fewest new agree sets per comparison worth sampling for before validating for the first time */
+        const double DISCOVERY_VALIDATION_FAILURE_RATE = 0.01; /*!< The share of the candidates of a level that may fail validation before sampling again */
+        const double SAMPLE_CONFIDENCE = 0.95;                 /*!< The confidence of the bounds on how often a dependency that holds on a sample of the rows is broken by the rest of them */
+    }
+
+    namespace decomposition
+    {
+        const ui JOIN_CANDIDATES_PER_THREAD = 4; /*!< The fewest join dependency candidates worth starting another thread for when checking 5NF */
+    }
+
+    namespace verification
+    {
+        const ui CHASE_ROW_LIMIT = 65536;                   /*!< The most rows a chase tableau may grow to from multi valued and join dependencies, past which a chase that found no row of distinguished symbols is inconclusive */
+        const ui PRESERVATION_DEPENDENCIES_PER_THREAD = 64; /*!< The fewest dependencies worth starting another thread for when checking dependency preservation */
+        const ui DATA_JOIN_ROWS_PER_THREAD = 1024;          /*!< The fewest rows of the first table worth starting another thread for when joining the rows of the normalized tables */
+        const ui DATA_JOIN_REPORTED_ROWS = 10;              /*!< The most spurious or missing rows reported when the rows of the normalized tables do not join back into the data */
+        const std::string DATA_JOIN_SIDE_COLUMN = "#side";  /*!< The column of the files spilled when joining the rows of the normalized tables under a memory limit that tells the two sides of each join apart, named so no row of a table can share its name */
+        const std::string DATA_JOIN_FIRST_SIDE = "0";       /*!< The #DATA_JOIN_SIDE_COLUMN of the rows joined so far, or of the rows of the data */
+        const std::string DATA_JOIN_SECOND_SIDE = "1";      /*!< The #DATA_JOIN_SIDE_COLUMN of the rows of the next table to join, or of the joined rows */
+    }
+
+    namespace materialization
+    {
+        const us MATERIALIZE_PARTITION_COUNT = 64;     /*!< The number of partitions the rows of a table are hashed into before removing their duplicates */
+        const ui MATERIALIZE_ROWS_PER_THREAD = 65536;  /*!< The fewest rows worth starting another thread for when hashing the rows of a table */
+        const ui MATERIALIZE_INSERT_BATCH_SIZE = 1000; /*!< The most rows written by one INSERT statement */
+        const ul MATERIALIZE_MEMORY_LIMIT = 1UL << 30; /*!< The memory limit the rows of --materialize are read under when --memory-limit is not given, so a CSV data file too large for it is read in partitions rather than all at once */
     }
 
     namespace interpreter::token
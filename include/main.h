@@ -7,8 +7,184 @@
 
 #pragma once
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 #include "constants.h"
+#include "FileManager/csvReader.h"
 #include "Normalizer/normalizer.h"
-#include "Normalizer/formConstants.h"
\ No newline at end of file
+#include "Normalizer/formConstants.h"
+#include "Normalizer/Incremental/incrementalNormalizer.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Normalizer/Materialization/externalMaterializer.h"
+#include "Normalizer/Verification/externalDataJoinVerifier.h"
+#include "Dependencies/Discovery/taneDiscoverer.h"
+#include "Dependencies/Discovery/hybridDiscoverer.h"
+#include "Dependencies/Discovery/multivaluedDiscoverer.h"
+#include "Dependencies/Discovery/externalDiscoverer.h"
+#include "Dependencies/Discovery/dependencyFileWriter.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Dependencies/Validation/externalDependencyValidator.h"
+#include "Dependencies/Validation/sampleValidator.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Sampling/reservoirSampler.h"
+
+/*! \brief Reads dependencies to add or retract from the user, updating the normalized tables after each one
+    \details Each line is + or - followed by dependencies in the syntax of a dependency file, and q ends the loop
+    \param[in] normalizer The normalizer whose normalized tables are updated
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void runIncrementalMode(normalizer::Normalizer &normalizer);
+
+/*! \brief Compares the dependency file of \p normalizer against another version of it read from the user, and normalizes again only if they are not equivalent
+    \details Prints the dependencies that are new, removed, or redundant in the other version
+    \param[in] normalizer The normalizer of the first dependency file
+    \param[in] normalizationForm The normalization form to go to
+    \param[in] getNormalizedForm If the highest normalized form of the input table is printed
+    \param[in] datasetFile The SQL dataset file, relative to the resources/sql folder
+    \param[in] verifyDecomposition If the normalized tables are verified
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void runCompareMode(const normalizer::Normalizer &normalizer, const normalizer::NormalizationForm normalizationForm, const bool getNormalizedForm, const std::string &datasetFile, const bool verifyDecomposition);
+
+/*! \brief Normalizes the input table of \p normalizer to several forms in one run and prints the tables of each of them, lowest first
+    \details The tables of the highest form are left in the normalizer to be printed, verified, and compared or updated like a single form
+    \param[in] normalizer The normalizer of the input table
+    \param[in] normalizationForms The forms to normalize to
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void runMultipleFormsMode(normalizer::Normalizer &normalizer, const std::vector<normalizer::NormalizationForm> &normalizationForms);
+
+/*! \brief Reads the rows of a CSV data file from the user and writes the functional and multi valued dependencies that hold on them as a dependency file
+    \details Dependencies with more than one row on the left hand side are printed instead, as the dependency file cannot hold them. From a sample of the rows, the exact dependencies are reported with how often the rest of the rows could break them, and the ones picked and found broken by every row are not written
+    \param[in] sampleSize The number of rows to discover the dependencies on, or 0 for every row
+    \param[in] memoryLimit The most bytes of rows to hold at once when checking dependencies against every row, or 0 to read every row at once. Without \p sampleSize, a data file that does not fit under it is discovered on a sample that does, and the dependencies of the sample are then checked and made larger one partition of the rows at a time
+    \param[in] temporaryPath The directory to spill the partitions of the rows to under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return int The status code of the program
+*/
+int runDiscoverMode(const ul sampleSize, const ul memoryLimit, const std::string &temporaryPath);
+
+/*! \brief Reads the rows of the input table of \p normalizer from a CSV data file and writes the rows of each normalized table, as INSERT statements or as CSV files with a LOAD DATA script
+    \details The files are written to the resources/data/normalized folder, and the number of distinct rows of each normalized table is printed
+    \param[in] normalizer The normalizer whose normalized tables are filled
+    \param[in] verifyDecomposition If the rows of the normalized tables are joined back together and compared to the rows of the data
+    \param[in] memoryLimit The most bytes of rows to hold at once, or 0 for #normalizer::materialization::MATERIALIZE_MEMORY_LIMIT
+    \param[in] temporaryPath The directory to spill the partitions of the rows to under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return int The status code of the program
+*/
+int runMaterializeMode(normalizer::Normalizer &normalizer, const bool verifyDecomposition, const ul memoryLimit, const std::string &temporaryPath);
+
+/*! \brief Writes the rows of the normalized tables to one file per output path
+    \tparam Materializer A #normalizer::materialization::TableMaterializer or #normalizer::materialization::ExternalMaterializer
+    \param[in] materializer The materializer of the normalized tables
+    \param[in] outputPaths The INSERT file, or the CSV file of each normalized table followed by the LOAD DATA script
+    \param[in] tableCount The number of normalized tables
+    \param[in] format i for INSERT statements, or c for CSV files
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return int The status code of the program
+*/
+template <typename Materializer>
+int writeMaterializedRows(Materializer &materializer, const std::vector<std::string> &outputPaths, const std::size_t tableCount, const char format);
+
+/*! \brief Reads the rows of the input table of \p normalizer from a CSV data file and checks every functional dependency of the dependency file against them
+    \details Each broken dependency is printed with the number of groups of rows that break it and a pair of rows that shows it
+    \param[in] normalizer The normalizer whose dependency file is checked
+    \param[in] sampleSize The number of rows to check the dependencies and primary key on before checking the picked ones against every row, or 0 to check every dependency against every row
+    \param[in] memoryLimit The most bytes of rows to hold at once, or 0 to read every row at once
+    \param[in] temporaryPath The directory to spill the partitions of the rows to under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return int 0 if every dependency holds on the rows checked, or 1 if any is broken
+*/
+int runValidateMode(const normalizer::Normalizer &normalizer, const ul sampleSize, const ul memoryLimit, const std::string &temporaryPath);
+
+/*! \brief Checks functional dependencies against every row of a CSV data file
+    \param[in] dataPath The path of the CSV data file
+    \param[in] dictionary The dictionary of the attributes the dependencies are written over
+    \param[in] dependencies The dependencies to check
+    \param[in] memoryLimit The most bytes of rows to hold at once, or 0 to read every row at once
+    \param[in] temporaryPath The directory to spill the partitions of the rows to under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return std::vector<normalizer::dependencies::validation::DependencyViolation> Each broken dependency with a pair of rows that breaks it, in the order of \p dependencies
+*/
+std::vector<normalizer::dependencies::validation::DependencyViolation> checkEveryRow(const std::string &dataPath, const normalizer::dependencies::attribute::AttributeDictionary &dictionary, const std::vector<normalizer::dependencies::functional::FunctionalDependency> &dependencies, const ul memoryLimit, const std::string &temporaryPath);
+
+/*! \brief Prints the estimate of each dependency from a sample of the rows of a CSV data file, then checks the ones the user picks against every row
+    \param[in] sample The sampled rows
+    \param[in] sampler The sampler of \p sample, with the index and number of the rows of the file
+    \param[in] dictionary The dictionary of the attributes the dependencies are written over
+    \param[in] dependencies The dependencies to check, where the last \p keyCount of them are keys determining every other attribute
+    \param[in] keyCount The number of keys at the end of \p dependencies
+    \param[in] dataPath The path of the CSV data file
+    \param[in] memoryLimit The most bytes of rows to hold at once when checking every row, or 0 to read every row at once
+    \param[in] temporaryPath The directory to spill the partitions of the rows to under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return std::vector<bool> If each dependency is broken, by the sample or by every row once picked
+*/
+std::vector<bool> runSampleChecks(const normalizer::table::instance::TableInstance &sample, const normalizer::table::sampling::ReservoirSampler &sampler, const normalizer::dependencies::attribute::AttributeDictionary &dictionary, const std::vector<normalizer::dependencies::functional::FunctionalDependency> &dependencies, const std::size_t keyCount, const std::string &dataPath, const ul memoryLimit, const std::string &temporaryPath);
+
+/*! \brief Prints the violations of every normal form of the input table of \p normalizer and its highest normal form, without normalizing it
+    \param[in] normalizer The normalizer of the input table
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void runAnalyzeMode(normalizer::Normalizer &normalizer);
+
+/*! \brief Prints one line for each dependency that violates a normal form
+    \param[in] label The normal form the dependencies violate
+    \param[in] arrow The arrow between the determinant and dependent, -> or ->>
+    \param[in] violations The determinant and dependent of each violation
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void printViolations(const std::string &label, const std::string &arrow, const std::vector<std::pair<std::string, std::string>> &violations);
+
+/*! \brief Prints a broken dependency with the number of groups of rows that break it and a pair of rows that shows it
+    \param[in] violation The broken dependency
+    \param[in] name The dependency as written to the user
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+void printViolation(const normalizer::dependencies::validation::DependencyViolation &violation, const std::string &name);
+
+/*! \brief Formats the values of a row of data
+    \param[in] values The value of each column
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return std::string The values, separated by commas, in parentheses
+*/
+std::string printRow(const std::vector<std::string> &values);
@@ -0,0 +1,23 @@
+/*! \file attributeDictionaryHelper.h
+    \brief Header file for creating the attribute dictionaries of tests.
+    \details Contains the function declarations for creating an attribute dictionary from the row names of a test
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+
+/*! \brief Creates a dictionary that gives each of \p rowNames its identifier, in order
+    \param[in] rowNames The row names to add
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return normalizer::dependencies::attribute::AttributeDictionary The dictionary of \p rowNames
+*/
+normalizer::dependencies::attribute::AttributeDictionary createDictionary(const std::vector<std::string> &rowNames);
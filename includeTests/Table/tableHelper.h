@@ -0,0 +1,37 @@
+/*! \file tableHelper.h
+    \brief Header file for creating the tables and CSV data files of tests.
+    \details Contains the function declarations for creating a table from the row names of a test and for writing the rows of a test to a CSV data file
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "FileManager/temporaryDirectory.h"
+#include "Table/table.h"
+#include "Table/TableRow/RowDefinition/genericRowDefinition.h"
+
+/*! \brief Creates a table whose rows are \p rowNames, each a VARCHAR
+    \param[in] name The name of the table
+    \param[in] rowNames The names of the rows of the table, in order
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return normalizer::table::Table The table of \p rowNames
+*/
+normalizer::table::Table createTable(const std::string &name, const std::vector<std::string> &rowNames);
+
+/*! \brief Writes \p contents to a CSV data file in \p directory
+    \param[in] directory The directory to write the file in
+    \param[in] contents The header and rows of the file
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+    \return std::string The path of the file
+*/
+std::string writeRows(const normalizer::file::TemporaryDirectory &directory, const std::string &contents);
@@ -0,0 +1,142 @@
+/*! \file attributeDictionary.cpp
+    \brief C++ file for creating an attribute dictionary.
+    \details Contains the function definitions for mapping row names to attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+
+namespace normalizer::dependencies::attribute
+{
+    /* Constructors and Destructors */
+
+    AttributeDictionary::AttributeDictionary(const table::Table &sqlTable)
+    {
+        for (const table::row::TableRow &row : sqlTable.getTableRows())
+        {
+            this->addAttribute(row.getRowName());
+        }
+    }
+
+    /* Getters and Setters */
+
+    us AttributeDictionary::getAttributeCount() const
+    {
+        return static_cast<us>(this->attributeNames.size());
+    }
+
+    us AttributeDictionary::getAttributeId(const std::string &rowName) const
+    {
+        return this->attributeIds.at(rowName);
+    }
+
+    std::string AttributeDictionary::getAttributeName(const us attribute) const
+    {
+        return this->attributeNames[attribute];
+    }
+
+    /* Member Functions */
+
+    us AttributeDictionary::addAttribute(const std::string &rowName)
+    {
+        auto it = this->attributeIds.find(rowName);
+
+        if (it != this->attributeIds.end())
+        {
+            return it->second;
+        }
+
+        const us attribute = static_cast<us>(this->attributeNames.size());
+
+        this->attributeNames.push_back(rowName);
+        this->attributeIds[rowName] = attribute;
+
+        return attribute;
+    }
+
+    bool AttributeDictionary::containsAttribute(const std::string &rowName) const
+    {
+        return this->attributeIds.find(rowName) != this->attributeIds.end();
+    }
+
+    AttributeSet AttributeDictionary::createEmptySet() const
+    {
+        return AttributeSet(this->getAttributeCount());
+    }
+
+    AttributeSet AttributeDictionary::createFullSet() const
+    {
+        AttributeSet attributes(this->getAttributeCount());
+
+        for (us i = 0; i < this->getAttributeCount(); ++i)
+        {
+            attributes.addAttribute(i);
+        }
+
+        return attributes;
+    }
+
+    AttributeSet AttributeDictionary::toAttributeSet(const std::vector<std::string> &rowNames) const
+    {
+        AttributeSet attributes(this->getAttributeCount());
+
+        for (const std::string &rowName : rowNames)
+        {
+            attributes.addAttribute(this->getAttributeId(rowName));
+        }
+
+        return attributes;
+    }
+
+    AttributeSet AttributeDictionary::getTableAttributes(const table::Table &sqlTable) const
+    {
+        AttributeSet attributes(this->getAttributeCount());
+
+        for (const table::row::TableRow &row : sqlTable.getTableRows())
+        {
+            attributes.addAttribute(this->getAttributeId(row.getRowName()));
+        }
+
+        return attributes;
+    }
+
+    std::vector<std::string> AttributeDictionary::toRowNames(const AttributeSet &attributes) const
+    {
+        std::vector<std::string> rowNames;
+
+        for (const us attribute : attributes.getAttributes())
+        {
+            rowNames.push_back(this->attributeNames[attribute]);
+        }
+
+        return rowNames;
+    }
+
+    std::string AttributeDictionary::toString(const AttributeSet &attributes) const
+    {
+        const std::vector<std::string> rowNames = this->toRowNames(attributes);
+
+        if (rowNames.size() == 1)
+        {
+            return rowNames[0];
+        }
+
+        std::string returnValue = "(";
+
+        for (const std::string &rowName : rowNames)
+        {
+            returnValue += rowName + ", ";
+        }
+
+        if (rowNames.size() > 0)
+        {
+            returnValue = returnValue.substr(0, returnValue.length() - 2);
+        }
+
+        returnValue += ")";
+
+        return returnValue;
+    }
+}
\ No newline at end of file
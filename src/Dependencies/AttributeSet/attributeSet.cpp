@@ -0,0 +1,291 @@
+/*! \file attributeSet.cpp
+    \brief C++ file for creating a set of attributes.
+    \details Contains the function definitions for creating a bitset of attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/AttributeSet/attributeSet.h"
+
+namespace normalizer::dependencies::attribute
+{
+    /* Constructors and Destructors */
+
+    AttributeSet::AttributeSet(const us count) : attributeCount(count), words(static_cast<std::size_t>((count + ATTRIBUTE_WORD_BITS - 1) / ATTRIBUTE_WORD_BITS), 0) {}
+
+    AttributeSet::AttributeSet(const AttributeSet &other) : attributeCount(other.attributeCount), words(other.words) {}
+
+    /* Getters and Setters */
+
+    us AttributeSet::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    const std::vector<ul> &AttributeSet::getWords() const
+    {
+        return this->words;
+    }
+
+    std::vector<us> AttributeSet::getAttributes() const
+    {
+        std::vector<us> attributes;
+
+        for (us attribute = this->findFirst(); attribute < this->attributeCount; attribute = this->findNext(attribute))
+        {
+            attributes.push_back(attribute);
+        }
+
+        return attributes;
+    }
+
+    /* Member Functions */
+
+    void AttributeSet::addAttribute(const us attribute)
+    {
+        if (attribute >= this->attributeCount)
+        {
+            this->reserveAttributes(static_cast<us>(attribute + 1));
+        }
+
+        this->words[attribute / ATTRIBUTE_WORD_BITS] |= static_cast<ul>(1) << (attribute % ATTRIBUTE_WORD_BITS);
+    }
+
+    void AttributeSet::removeAttribute(const us attribute)
+    {
+        if (attribute < this->attributeCount)
+        {
+            this->words[attribute / ATTRIBUTE_WORD_BITS] &= ~(static_cast<ul>(1) << (attribute % ATTRIBUTE_WORD_BITS));
+        }
+    }
+
+    bool AttributeSet::containsAttribute(const us attribute) const
+    {
+        if (attribute >= this->attributeCount)
+        {
+            return false;
+        }
+
+        return (this->words[attribute / ATTRIBUTE_WORD_BITS] >> (attribute % ATTRIBUTE_WORD_BITS)) & 1;
+    }
+
+    us AttributeSet::count() const
+    {
+        us total = 0;
+
+        for (const ul word : this->words)
+        {
+            total = static_cast<us>(total + std::popcount(word));
+        }
+
+        return total;
+    }
+
+    bool AttributeSet::isEmpty() const
+    {
+        for (const ul word : this->words)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool AttributeSet::isSubsetOf(const AttributeSet &other) const
+    {
+        const std::size_t otherSize = other.words.size();
+
+        for (std::size_t i = 0; i < this->words.size(); ++i)
+        {
+            const ul otherWord = i < otherSize ? other.words[i] : 0;
+
+            if ((this->words[i] & ~otherWord) != 0) // An attribute of this set is missing from the other set
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool AttributeSet::intersects(const AttributeSet &other) const
+    {
+        const std::size_t sharedSize = std::min(this->words.size(), other.words.size());
+
+        for (std::size_t i = 0; i < sharedSize; ++i)
+        {
+            if ((this->words[i] & other.words[i]) != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    us AttributeSet::findFirst() const
+    {
+        for (std::size_t i = 0; i < this->words.size(); ++i)
+        {
+            if (this->words[i] != 0)
+            {
+                return static_cast<us>(i * ATTRIBUTE_WORD_BITS + static_cast<std::size_t>(std::countr_zero(this->words[i])));
+            }
+        }
+
+        return this->attributeCount;
+    }
+
+    us AttributeSet::findNext(const us attribute) const
+    {
+        const us start = static_cast<us>(attribute + 1);
+
+        if (start >= this->attributeCount)
+        {
+            return this->attributeCount;
+        }
+
+        std::size_t wordIndex = start / ATTRIBUTE_WORD_BITS;
+        ul word = this->words[wordIndex] & (~static_cast<ul>(0) << (start % ATTRIBUTE_WORD_BITS)); // Mask off the bits up to and including attribute
+
+        while (true)
+        {
+            if (word != 0)
+            {
+                return static_cast<us>(wordIndex * ATTRIBUTE_WORD_BITS + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+
+            if (++wordIndex >= this->words.size())
+            {
+                return this->attributeCount;
+            }
+
+            word = this->words[wordIndex];
+        }
+    }
+
+    std::size_t AttributeSet::hash() const
+    {
+        std::size_t usedWords = this->words.size();
+
+        while (usedWords > 0 && this->words[usedWords - 1] == 0) // Trailing empty words do not change equality, so they must not change the hash
+        {
+            --usedWords;
+        }
+
+        std::size_t seed = 0;
+
+        for (std::size_t i = 0; i < usedWords; ++i)
+        {
+            seed ^= std::hash<ul>{}(this->words[i]) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+
+    void AttributeSet::reserveAttributes(const us count)
+    {
+        this->attributeCount = count;
+        this->words.resize(static_cast<std::size_t>((count + ATTRIBUTE_WORD_BITS - 1) / ATTRIBUTE_WORD_BITS), 0);
+    }
+
+    /* Operator Overloads */
+
+    AttributeSet &AttributeSet::operator=(const AttributeSet &other)
+    {
+        this->attributeCount = other.attributeCount;
+        this->words = other.words;
+
+        return *this;
+    }
+
+    AttributeSet &AttributeSet::operator|=(const AttributeSet &other)
+    {
+        if (other.attributeCount > this->attributeCount)
+        {
+            this->reserveAttributes(other.attributeCount);
+        }
+
+        for (std::size_t i = 0; i < other.words.size(); ++i)
+        {
+            this->words[i] |= other.words[i];
+        }
+
+        return *this;
+    }
+
+    AttributeSet &AttributeSet::operator&=(const AttributeSet &other)
+    {
+        const std::size_t otherSize = other.words.size();
+
+        for (std::size_t i = 0; i < this->words.size(); ++i)
+        {
+            this->words[i] &= i < otherSize ? other.words[i] : 0;
+        }
+
+        return *this;
+    }
+
+    AttributeSet &AttributeSet::operator-=(const AttributeSet &other)
+    {
+        const std::size_t sharedSize = std::min(this->words.size(), other.words.size());
+
+        for (std::size_t i = 0; i < sharedSize; ++i)
+        {
+            this->words[i] &= ~other.words[i];
+        }
+
+        return *this;
+    }
+
+    AttributeSet AttributeSet::operator|(const AttributeSet &other) const
+    {
+        AttributeSet result(*this);
+        result |= other;
+
+        return result;
+    }
+
+    AttributeSet AttributeSet::operator&(const AttributeSet &other) const
+    {
+        AttributeSet result(*this);
+        result &= other;
+
+        return result;
+    }
+
+    AttributeSet AttributeSet::operator-(const AttributeSet &other) const
+    {
+        AttributeSet result(*this);
+        result -= other;
+
+        return result;
+    }
+
+    bool AttributeSet::operator==(const AttributeSet &other) const
+    {
+        const std::size_t largestSize = std::max(this->words.size(), other.words.size());
+
+        for (std::size_t i = 0; i < largestSize; ++i)
+        {
+            const ul word = i < this->words.size() ? this->words[i] : 0;
+            const ul otherWord = i < other.words.size() ? other.words[i] : 0;
+
+            if (word != otherWord)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::size_t AttributeSetHash::operator()(const AttributeSet &set) const
+    {
+        return set.hash();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*! \file dependencyBasis.cpp
+    \brief C++ file for computing dependency bases.
+    \details Contains the function definitions for computing the dependency basis of a set of attributes under functional and multi valued dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Basis/dependencyBasis.h"
+
+namespace normalizer::dependencies::basis
+{
+    /* Constructors and Destructors */
+
+    DependencyBasisCalculator::DependencyBasisCalculator(const std::vector<functional::FunctionalDependency> &inFunctionalDependencies, const std::vector<multivalued::MultivaluedDependency> &inMultivaluedDependencies, const us count) : splitters(inMultivaluedDependencies), functionallyDetermined(count), attributeCount(count)
+    {
+        for (const functional::FunctionalDependency &dependency : inFunctionalDependencies)
+        {
+            const attribute::AttributeSet determined = dependency.getDependent() - dependency.getDeterminant();
+
+            this->functionallyDetermined |= determined;
+
+            for (us attributeId = determined.findFirst(); attributeId < determined.getAttributeCount(); attributeId = determined.findNext(attributeId))
+            {
+                attribute::AttributeSet dependent(count);
+                dependent.addAttribute(attributeId);
+
+                this->splitters.push_back({dependency.getDeterminant(), dependent});
+            }
+        }
+    }
+
+    /* Getters and Setters */
+
+    us DependencyBasisCalculator::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    std::size_t DependencyBasisCalculator::getCachedBasisCount() const
+    {
+        return this->bases.size();
+    }
+
+    /* Member Functions */
+
+    const std::vector<attribute::AttributeSet> &DependencyBasisCalculator::getBasis(const attribute::AttributeSet &attributes)
+    {
+        const auto found = this->bases.find(attributes);
+
+        if (found != this->bases.end())
+        {
+            return found->second;
+        }
+
+        return this->bases.emplace(attributes, this->computeBasis(attributes)).first->second;
+    }
+
+    attribute::AttributeSet DependencyBasisCalculator::computeClosure(const attribute::AttributeSet &attributes)
+    {
+        attribute::AttributeSet closure(this->attributeCount);
+        closure |= attributes;
+
+        for (const attribute::AttributeSet &block : this->getBasis(attributes))
+        {
+            if (block.count() == 1 && block.isSubsetOf(this->functionallyDetermined))
+            {
+                closure |= block;
+            }
+        }
+
+        return closure;
+    }
+
+    bool DependencyBasisCalculator::implies(const multivalued::MultivaluedDependency &dependency)
+    {
+        const attribute::AttributeSet dependent = dependency.getDependent() - dependency.getDeterminant();
+
+        for (const attribute::AttributeSet &block : this->getBasis(dependency.getDeterminant()))
+        {
+            if (block.intersects(dependent) && !block.isSubsetOf(dependent)) // The dependent holds only part of this block
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<attribute::AttributeSet> DependencyBasisCalculator::computeBasis(const attribute::AttributeSet &attributes) const
+    {
+        std::vector<attribute::AttributeSet> blocks;
+
+        attribute::AttributeSet remaining(this->attributeCount);
+
+        for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId)
+        {
+            remaining.addAttribute(attributeId);
+        }
+
+        remaining -= attributes;
+
+        if (!remaining.isEmpty())
+        {
+            blocks.push_back(remaining);
+        }
+
+        bool changed = true;
+
+        while (changed)
+        {
+            changed = false;
+
+            for (const multivalued::MultivaluedDependency &splitter : this->splitters)
+            {
+                const std::size_t blockCount = blocks.size();
+
+                for (std::size_t i = 0; i < blockCount; ++i)
+                {
+                    if (blocks[i].intersects(splitter.getDeterminant())) // The splitter only applies to blocks its left hand side misses
+                    {
+                        continue;
+                    }
+
+                    attribute::AttributeSet inside = blocks[i] & splitter.getDependent();
+
+                    if (inside.isEmpty() || inside == blocks[i])
+                    {
+                        continue;
+                    }
+
+                    blocks.push_back(blocks[i] - splitter.getDependent());
+                    blocks[i] = inside;
+                    changed = true;
+                }
+            }
+        }
+
+        std::sort(blocks.begin(), blocks.end(), [](const attribute::AttributeSet &first, const attribute::AttributeSet &second)
+                  { return first.findFirst() < second.findFirst(); });
+
+        return blocks;
+    }
+}
@@ -0,0 +1,418 @@
+/*! \file chaseTableau.cpp
+    \brief C++ file for creating a chase tableau.
+    \details Contains the function definitions for chasing a tableau of symbols with functional, multi valued and join dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Chase/chaseTableau.h"
+
+namespace normalizer::dependencies::chase
+{
+    std::size_t SymbolRowHash::operator()(const std::vector<ui> &symbols) const noexcept
+    {
+        std::size_t seed = symbols.size();
+
+        for (const ui symbol : symbols)
+        {
+            seed ^= std::hash<ui>{}(symbol) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+
+    /* Constructors and Destructors */
+
+    ChaseTableau::ChaseTableau(const std::vector<attribute::AttributeSet> &components, const us count) : rowCount(static_cast<ui>(components.size())), attributeCount(count), roundCount(0), truncated(false)
+    {
+        this->cells.resize(static_cast<std::size_t>(this->rowCount) * this->attributeCount);
+
+        for (ui row = 0; row < this->rowCount; ++row)
+        {
+            for (us column = 0; column < this->attributeCount; ++column)
+            {
+                this->cells[static_cast<std::size_t>(row) * this->attributeCount + column] = components[row].containsAttribute(column) ? 0 : row + 1;
+            }
+        }
+
+        for (us column = 0; column < this->attributeCount; ++column) // Swapped rows only copy symbols, so each column never needs more than the starting ones
+        {
+            std::vector<ui> parents(this->rowCount + 1);
+
+            for (ui symbol = 0; symbol <= this->rowCount; ++symbol)
+            {
+                parents[symbol] = symbol;
+            }
+
+            this->symbolParents.push_back(parents);
+        }
+    }
+
+    /* Getters and Setters */
+
+    ui ChaseTableau::getRowCount() const
+    {
+        return this->rowCount;
+    }
+
+    ui ChaseTableau::getRoundCount() const
+    {
+        return this->roundCount;
+    }
+
+    bool ChaseTableau::isTruncated() const
+    {
+        return this->truncated;
+    }
+
+    /* Member Functions */
+
+    bool ChaseTableau::chase(const std::vector<functional::FunctionalDependency> &functionalDependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies, const ui maxRows)
+    {
+        return this->chase(functionalDependencies, multivaluedDependencies, {}, maxRows);
+    }
+
+    bool ChaseTableau::chase(const std::vector<functional::FunctionalDependency> &functionalDependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies, const std::vector<join::JoinDependency> &joinDependencies, const ui maxRows)
+    {
+        this->roundCount = 0;
+        this->truncated = false;
+
+        while (true)
+        {
+            ++this->roundCount;
+
+            bool changed = false;
+
+            for (const functional::FunctionalDependency &dependency : functionalDependencies)
+            {
+                changed = this->applyFunctionalDependency(dependency) || changed;
+            }
+
+            if (this->hasDistinguishedRow())
+            {
+                return true;
+            }
+
+            for (const multivalued::MultivaluedDependency &dependency : multivaluedDependencies)
+            {
+                changed = this->applyMultivaluedDependency(dependency, maxRows) || changed;
+            }
+
+            if (this->hasDistinguishedRow())
+            {
+                return true;
+            }
+
+            for (const join::JoinDependency &dependency : joinDependencies)
+            {
+                changed = this->applyJoinDependency(dependency, maxRows) || changed;
+            }
+
+            if (this->hasDistinguishedRow())
+            {
+                return true;
+            }
+
+            if (!changed)
+            {
+                return false;
+            }
+        }
+    }
+
+    bool ChaseTableau::applyFunctionalDependency(const functional::FunctionalDependency &dependency)
+    {
+        const std::vector<us> determinantColumns = dependency.getDeterminant().getAttributes();
+        const std::vector<us> dependentColumns = dependency.getDependent().getAttributes();
+
+        std::unordered_map<std::vector<ui>, ui, SymbolRowHash> firstRowOfKey;
+
+        bool changed = false;
+
+        for (ui row = 0; row < this->rowCount; ++row)
+        {
+            auto inserted = firstRowOfKey.emplace(this->getRowKey(row, determinantColumns), row);
+
+            if (inserted.second) // First row with these left hand side symbols
+            {
+                continue;
+            }
+
+            const ui firstRow = inserted.first->second;
+
+            for (const us column : dependentColumns)
+            {
+                if (column < this->attributeCount)
+                {
+                    changed = this->equateSymbols(column, this->findSymbol(firstRow, column), this->findSymbol(row, column)) || changed;
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    bool ChaseTableau::applyMultivaluedDependency(const multivalued::MultivaluedDependency &dependency, const ui maxRows)
+    {
+        const std::vector<us> determinantColumns = dependency.getDeterminant().getAttributes();
+        const attribute::AttributeSet takenFromFirst = dependency.getDeterminant() | dependency.getDependent();
+
+        std::unordered_set<std::vector<ui>, SymbolRowHash> existingRows;
+        std::unordered_map<std::vector<ui>, std::vector<ui>, SymbolRowHash> rowsOfKey;
+
+        std::vector<us> allColumns;
+
+        for (us column = 0; column < this->attributeCount; ++column)
+        {
+            allColumns.push_back(column);
+        }
+
+        for (ui row = 0; row < this->rowCount; ++row)
+        {
+            existingRows.insert(this->getRowKey(row, allColumns));
+            rowsOfKey[this->getRowKey(row, determinantColumns)].push_back(row);
+        }
+
+        bool changed = false;
+
+        for (const auto &pair : rowsOfKey)
+        {
+            for (const ui firstRow : pair.second)
+            {
+                for (const ui secondRow : pair.second)
+                {
+                    if (firstRow == secondRow)
+                    {
+                        continue;
+                    }
+
+                    std::vector<ui> swappedRow(this->attributeCount);
+
+                    for (us column = 0; column < this->attributeCount; ++column)
+                    {
+                        swappedRow[column] = this->findSymbol(takenFromFirst.containsAttribute(column) ? firstRow : secondRow, column);
+                    }
+
+                    if (!existingRows.insert(swappedRow).second) // The tableau already has the row
+                    {
+                        continue;
+                    }
+
+                    if (this->rowCount >= maxRows)
+                    {
+                        this->truncated = true;
+                        continue;
+                    }
+
+                    this->cells.insert(this->cells.end(), swappedRow.begin(), swappedRow.end());
+                    ++this->rowCount;
+
+                    changed = true;
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    bool ChaseTableau::applyJoinDependency(const join::JoinDependency &dependency, const ui maxRows)
+    {
+        if (dependency.getAttributes().count() != this->attributeCount)
+        {
+            return false;
+        }
+
+        const ui unset = std::numeric_limits<ui>::max();
+
+        std::vector<us> allColumns;
+
+        for (us column = 0; column < this->attributeCount; ++column)
+        {
+            allColumns.push_back(column);
+        }
+
+        std::vector<std::vector<ui>> joinedRows = {std::vector<ui>(this->attributeCount, unset)};
+        attribute::AttributeSet joinedColumns(this->attributeCount);
+
+        for (const attribute::AttributeSet &component : dependency.getComponents())
+        {
+            const std::vector<us> componentColumns = component.getAttributes();
+            const std::vector<us> sharedColumns = (joinedColumns & component).getAttributes();
+
+            std::unordered_set<std::vector<ui>, SymbolRowHash> projectedRows;
+            std::unordered_map<std::vector<ui>, std::vector<std::vector<ui>>, SymbolRowHash> projectionsOfKey;
+
+            for (ui row = 0; row < this->rowCount; ++row)
+            {
+                std::vector<ui> projection = this->getRowKey(row, componentColumns);
+
+                if (projectedRows.insert(projection).second)
+                {
+                    projectionsOfKey[this->getRowKey(row, sharedColumns)].push_back(projection);
+                }
+            }
+
+            std::vector<std::vector<ui>> nextRows;
+
+            for (const std::vector<ui> &joinedRow : joinedRows)
+            {
+                std::vector<ui> key;
+                key.reserve(sharedColumns.size());
+
+                for (const us column : sharedColumns)
+                {
+                    key.push_back(joinedRow[column]);
+                }
+
+                const auto found = projectionsOfKey.find(key);
+
+                if (found == projectionsOfKey.end())
+                {
+                    continue;
+                }
+
+                for (const std::vector<ui> &projection : found->second)
+                {
+                    std::vector<ui> nextRow = joinedRow;
+
+                    for (std::size_t i = 0; i < componentColumns.size(); ++i)
+                    {
+                        nextRow[componentColumns[i]] = projection[i];
+                    }
+
+                    nextRows.push_back(nextRow);
+                }
+
+                if (nextRows.size() >= maxRows) // Every joined row is implied, so stopping early only leaves some out
+                {
+                    this->truncated = true;
+                    break;
+                }
+            }
+
+            joinedRows = nextRows;
+            joinedColumns |= component;
+        }
+
+        std::unordered_set<std::vector<ui>, SymbolRowHash> existingRows;
+
+        for (ui row = 0; row < this->rowCount; ++row)
+        {
+            existingRows.insert(this->getRowKey(row, allColumns));
+        }
+
+        bool changed = false;
+
+        for (const std::vector<ui> &joinedRow : joinedRows)
+        {
+            if (!existingRows.insert(joinedRow).second)
+            {
+                continue;
+            }
+
+            if (this->rowCount >= maxRows)
+            {
+                this->truncated = true;
+                break;
+            }
+
+            this->cells.insert(this->cells.end(), joinedRow.begin(), joinedRow.end());
+            ++this->rowCount;
+
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    bool ChaseTableau::hasDistinguishedRow()
+    {
+        for (ui row = 0; row < this->rowCount; ++row)
+        {
+            bool distinguished = true;
+
+            for (us column = 0; column < this->attributeCount; ++column)
+            {
+                if (this->findSymbol(row, column) != 0)
+                {
+                    distinguished = false;
+                    break;
+                }
+            }
+
+            if (distinguished)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ChaseTableau::isDistinguishedOn(const ui row, const attribute::AttributeSet &attributes)
+    {
+        for (const us column : attributes.getAttributes())
+        {
+            if (column >= this->attributeCount || this->findSymbol(row, column) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ui ChaseTableau::findSymbol(const ui row, const us column)
+    {
+        return this->findRepresentative(column, this->cells[static_cast<std::size_t>(row) * this->attributeCount + column]);
+    }
+
+    ui ChaseTableau::findRepresentative(const us column, ui symbol)
+    {
+        std::vector<ui> &parents = this->symbolParents[column];
+
+        while (parents[symbol] != symbol)
+        {
+            parents[symbol] = parents[parents[symbol]]; // Path halving
+            symbol = parents[symbol];
+        }
+
+        return symbol;
+    }
+
+    bool ChaseTableau::equateSymbols(const us column, const ui first, const ui second)
+    {
+        const ui firstRoot = this->findRepresentative(column, first);
+        const ui secondRoot = this->findRepresentative(column, second);
+
+        if (firstRoot == secondRoot)
+        {
+            return false;
+        }
+
+        if (firstRoot < secondRoot)
+        {
+            this->symbolParents[column][secondRoot] = firstRoot;
+        }
+        else
+        {
+            this->symbolParents[column][firstRoot] = secondRoot;
+        }
+
+        return true;
+    }
+
+    std::vector<ui> ChaseTableau::getRowKey(const ui row, const std::vector<us> &columns)
+    {
+        std::vector<ui> key;
+        key.reserve(columns.size());
+
+        for (const us column : columns)
+        {
+            key.push_back(column < this->attributeCount ? this->findSymbol(row, column) : 0);
+        }
+
+        return key;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*! \file closureCache.cpp
+    \brief C++ file for caching attribute closures.
+    \details Contains the function definitions for a closure cache that can be shared by every normalization pass and read from several threads
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Closure/closureCache.h"
+
+namespace normalizer::dependencies::closure
+{
+    ClosureCacheShard::ClosureCacheShard(const ClosureCacheShard &other)
+    {
+        const std::shared_lock<std::shared_mutex> lock(other.mutex);
+
+        this->closures = other.closures;
+    }
+
+    ClosureCacheShard &ClosureCacheShard::operator=(const ClosureCacheShard &other)
+    {
+        if (this != &other)
+        {
+            const std::shared_lock<std::shared_mutex> otherLock(other.mutex);
+            const std::unique_lock<std::shared_mutex> lock(this->mutex);
+
+            this->closures = other.closures;
+        }
+
+        return *this;
+    }
+
+    /* Constructors and Destructors */
+
+    ClosureCache::ClosureCache() : shards(1), hitCount(0), missCount(0) {}
+
+    ClosureCache::ClosureCache(const ClosureCalculator &inCalculator, const us shardCount) : calculator(inCalculator), shards(shardCount == 0 ? 1 : shardCount), hitCount(0), missCount(0) {}
+
+    ClosureCache::ClosureCache(const ClosureCache &other) : calculator(other.calculator), shards(other.shards), hitCount(other.hitCount.load()), missCount(other.missCount.load()) {}
+
+    /* Getters and Setters */
+
+    const ClosureCalculator &ClosureCache::getCalculator() const
+    {
+        return this->calculator;
+    }
+
+    ul ClosureCache::getHitCount() const
+    {
+        return this->hitCount.load(std::memory_order_relaxed);
+    }
+
+    ul ClosureCache::getMissCount() const
+    {
+        return this->missCount.load(std::memory_order_relaxed);
+    }
+
+    std::size_t ClosureCache::getSize() const
+    {
+        std::size_t size = 0;
+
+        for (const ClosureCacheShard &shard : this->shards)
+        {
+            const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+            size += shard.closures.size();
+        }
+
+        return size;
+    }
+
+    /* Member Functions */
+
+    const attribute::AttributeSet &ClosureCache::getClosure(const attribute::AttributeSet &attributes)
+    {
+        ClosureCacheShard &shard = this->shards[attribute::AttributeSetHash{}(attributes) % this->shards.size()];
+
+        {
+            const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+            const auto it = shard.closures.find(attributes);
+
+            if (it != shard.closures.end())
+            {
+                this->hitCount.fetch_add(1, std::memory_order_relaxed);
+
+                return it->second;
+            }
+        }
+
+        this->missCount.fetch_add(1, std::memory_order_relaxed);
+
+        attribute::AttributeSet closure = this->calculator.computeClosure(attributes); // Computed outside the lock so other threads can keep reading the shard
+
+        const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+        return shard.closures.emplace(attributes, closure).first->second; // Keeps the first closure if another thread computed it in the meantime
+    }
+
+    bool ClosureCache::implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs)
+    {
+        return rhs.isSubsetOf(this->getClosure(lhs));
+    }
+
+    ul ClosureCache::addDependency(const functional::FunctionalDependency &dependency)
+    {
+        std::vector<functional::FunctionalDependency> functionalDependencies = this->calculator.getFunctionalDependencies();
+        functionalDependencies.push_back(dependency);
+
+        this->calculator = ClosureCalculator(functionalDependencies, this->calculator.getAttributeCount());
+
+        ul recomputedCount = 0;
+
+        for (ClosureCacheShard &shard : this->shards)
+        {
+            const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            for (auto &pair : shard.closures)
+            {
+                if (dependency.getDeterminant().isSubsetOf(pair.second) && !dependency.getDependent().isSubsetOf(pair.second))
+                {
+                    pair.second = this->calculator.computeClosure(pair.second);
+                    ++recomputedCount;
+                }
+            }
+        }
+
+        return recomputedCount;
+    }
+
+    ul ClosureCache::retractDependency(const functional::FunctionalDependency &dependency)
+    {
+        std::vector<functional::FunctionalDependency> functionalDependencies = this->calculator.getFunctionalDependencies();
+
+        const auto it = std::find(functionalDependencies.begin(), functionalDependencies.end(), dependency);
+
+        if (it == functionalDependencies.end())
+        {
+            return 0;
+        }
+
+        functionalDependencies.erase(it);
+
+        this->calculator = ClosureCalculator(functionalDependencies, this->calculator.getAttributeCount());
+
+        ul recomputedCount = 0;
+
+        for (ClosureCacheShard &shard : this->shards)
+        {
+            const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            for (auto &pair : shard.closures)
+            {
+                if (dependency.getDeterminant().isSubsetOf(pair.second))
+                {
+                    pair.second = this->calculator.computeClosure(pair.first);
+                    ++recomputedCount;
+                }
+            }
+        }
+
+        return recomputedCount;
+    }
+
+    /* Operator Overloads */
+
+    ClosureCache &ClosureCache::operator=(const ClosureCache &other)
+    {
+        this->calculator = other.calculator;
+        this->shards = other.shards;
+        this->hitCount.store(other.hitCount.load());
+        this->missCount.store(other.missCount.load());
+
+        return *this;
+    }
+}
\ No newline at end of file
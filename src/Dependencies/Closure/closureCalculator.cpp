@@ -0,0 +1,130 @@
+/*! \file closureCalculator.cpp
+    \brief C++ file for creating an attribute closure calculator.
+    \details Contains the function definitions for computing the closure of a set of attributes under a set of functional dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Closure/closureCalculator.h"
+
+namespace normalizer::dependencies::closure
+{
+    /* Constructors and Destructors */
+
+    ClosureCalculator::ClosureCalculator(const std::vector<functional::FunctionalDependency> &inDependencies, const us count) : functionalDependencies(inDependencies), dependencyStore(inDependencies, count), attributeCount(count) {}
+
+    /* Getters and Setters */
+
+    const std::vector<functional::FunctionalDependency> &ClosureCalculator::getFunctionalDependencies() const
+    {
+        return this->functionalDependencies;
+    }
+
+    us ClosureCalculator::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    const store::DependencyStore &ClosureCalculator::getDependencyStore() const
+    {
+        return this->dependencyStore;
+    }
+
+    /* Member Functions */
+
+    attribute::AttributeSet ClosureCalculator::computeClosure(const attribute::AttributeSet &attributes) const
+    {
+        return this->computeClosure(attributes, std::vector<bool>(this->functionalDependencies.size(), true));
+    }
+
+    attribute::AttributeSet ClosureCalculator::computeClosure(const attribute::AttributeSet &attributes, const std::vector<bool> &enabledDependencies) const
+    {
+        return this->computeClosure(attributes, enabledDependencies, attribute::AttributeSet(this->attributeCount));
+    }
+
+    bool ClosureCalculator::implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs) const
+    {
+        return this->implies(lhs, rhs, std::vector<bool>(this->functionalDependencies.size(), true));
+    }
+
+    bool ClosureCalculator::implies(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs, const std::vector<bool> &enabledDependencies) const
+    {
+        const attribute::AttributeSet target = rhs - lhs;
+
+        if (target.isEmpty()) // Trivial, and an empty target would never stop the search
+        {
+            return true;
+        }
+
+        return target.isSubsetOf(this->computeClosure(lhs, enabledDependencies, target));
+    }
+
+    attribute::AttributeSet ClosureCalculator::computeClosure(const attribute::AttributeSet &attributes, const std::vector<bool> &enabledDependencies, const attribute::AttributeSet &target) const
+    {
+        attribute::AttributeSet closure(this->attributeCount);
+        closure |= attributes;
+
+        std::size_t targetRemaining = (target - attributes).count();
+
+        std::vector<ui> reachedCounts(this->dependencyStore.getDependencyCount(), 0); // Counts up rather than down, so only the dependencies reached are ever touched
+        std::vector<us> pending = attributes.getAttributes();
+
+        for (const ui dependencyIndex : this->dependencyStore.getDependenciesWithEmptyDeterminant()) // Dependencies with an empty left hand side always fire
+        {
+            if (!enabledDependencies[dependencyIndex])
+            {
+                continue;
+            }
+
+            for (const us added : this->dependencyStore.getDependent(dependencyIndex))
+            {
+                if (!closure.containsAttribute(added))
+                {
+                    closure.addAttribute(added);
+                    pending.push_back(added);
+
+                    if (target.containsAttribute(added))
+                    {
+                        --targetRemaining;
+                    }
+                }
+            }
+        }
+
+        while (!pending.empty() && (target.isEmpty() || targetRemaining > 0))
+        {
+            const us attributeId = pending.back();
+            pending.pop_back();
+
+            if (attributeId >= this->attributeCount)
+            {
+                continue;
+            }
+
+            for (const ui dependencyIndex : this->dependencyStore.getDependenciesWithDeterminant(attributeId))
+            {
+                if (++reachedCounts[dependencyIndex] != this->dependencyStore.getDeterminant(dependencyIndex).size() || !enabledDependencies[dependencyIndex]) // Not every attribute of the left hand side is in the closure yet
+                {
+                    continue;
+                }
+
+                for (const us added : this->dependencyStore.getDependent(dependencyIndex))
+                {
+                    if (!closure.containsAttribute(added))
+                    {
+                        closure.addAttribute(added);
+                        pending.push_back(added);
+
+                        if (target.containsAttribute(added) && --targetRemaining == 0) // Every attribute asked for is reached
+                        {
+                            return closure;
+                        }
+                    }
+                }
+            }
+        }
+
+        return closure;
+    }
+}
\ No newline at end of file
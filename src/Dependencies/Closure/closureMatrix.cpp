@@ -0,0 +1,188 @@
+/*! \file closureMatrix.cpp
+    \brief C++ file for the closures of every single attribute.
+    \details Contains the function definitions for a bit matrix holding the closure of each attribute of the schema, computed once with word parallel propagation
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Closure/closureMatrix.h"
+
+namespace normalizer::dependencies::closure
+{
+    /* Constructors and Destructors */
+
+    ClosureMatrix::ClosureMatrix(const store::DependencyStore &store) : singleAttributeKeys(store.getAttributeCount()), determinedAttributes(store.getAttributeCount()), attributeCount(store.getAttributeCount()), wordCount(static_cast<std::size_t>((store.getAttributeCount() + ATTRIBUTE_WORD_BITS - 1) / ATTRIBUTE_WORD_BITS))
+    {
+        this->rows.assign(this->wordCount * this->attributeCount, 0);
+
+        for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId)
+        {
+            this->addToRow(attributeId, attributeId);
+        }
+
+        for (ui index = 0; index < store.getDependencyCount(); ++index)
+        {
+            const std::span<const us> determinant = store.getDeterminant(index);
+
+            if (determinant.size() > 1)
+            {
+                continue;
+            }
+
+            for (us row = 0; row < this->attributeCount; ++row)
+            {
+                if (!determinant.empty() && determinant.front() != row)
+                {
+                    continue;
+                }
+
+                for (const us dependentId : store.getDependent(index))
+                {
+                    this->addToRow(row, dependentId);
+                }
+            }
+        }
+
+        do
+        {
+            this->propagate();
+        } while (this->applyCompositeDependencies(store));
+
+        for (us row = 0; row < this->attributeCount; ++row)
+        {
+            const ul *rowWords = &this->rows[row * this->wordCount];
+            us rowCount = 0;
+
+            for (std::size_t word = 0; word < this->wordCount; ++word)
+            {
+                rowCount = static_cast<us>(rowCount + std::popcount(rowWords[word]));
+            }
+
+            if (rowCount == this->attributeCount)
+            {
+                this->singleAttributeKeys.addAttribute(row);
+            }
+
+            for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId)
+            {
+                if (attributeId != row && ((rowWords[attributeId / ATTRIBUTE_WORD_BITS] >> (attributeId % ATTRIBUTE_WORD_BITS)) & 1))
+                {
+                    this->determinedAttributes.addAttribute(attributeId);
+                }
+            }
+        }
+    }
+
+    /* Getters and Setters */
+
+    us ClosureMatrix::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    const attribute::AttributeSet &ClosureMatrix::getSingleAttributeKeys() const
+    {
+        return this->singleAttributeKeys;
+    }
+
+    const attribute::AttributeSet &ClosureMatrix::getDeterminedAttributes() const
+    {
+        return this->determinedAttributes;
+    }
+
+    /* Member Functions */
+
+    attribute::AttributeSet ClosureMatrix::getClosure(const us attributeId) const
+    {
+        attribute::AttributeSet closure(this->attributeCount);
+
+        for (us dependentId = 0; dependentId < this->attributeCount; ++dependentId)
+        {
+            if (this->determines(attributeId, dependentId))
+            {
+                closure.addAttribute(dependentId);
+            }
+        }
+
+        return closure;
+    }
+
+    bool ClosureMatrix::determines(const us determinant, const us dependent) const
+    {
+        return (this->rows[determinant * this->wordCount + dependent / ATTRIBUTE_WORD_BITS] >> (dependent % ATTRIBUTE_WORD_BITS)) & 1;
+    }
+
+    bool ClosureMatrix::isSuperkey(const us attributeId) const
+    {
+        return this->singleAttributeKeys.containsAttribute(attributeId);
+    }
+
+    bool ClosureMatrix::isDetermined(const us attributeId) const
+    {
+        return this->determinedAttributes.containsAttribute(attributeId);
+    }
+
+    void ClosureMatrix::addToRow(const us row, const us attributeId)
+    {
+        this->rows[row * this->wordCount + attributeId / ATTRIBUTE_WORD_BITS] |= static_cast<ul>(1) << (attributeId % ATTRIBUTE_WORD_BITS);
+    }
+
+    void ClosureMatrix::propagate()
+    {
+        for (us through = 0; through < this->attributeCount; ++through)
+        {
+            const ul *throughWords = &this->rows[through * this->wordCount];
+
+            for (us row = 0; row < this->attributeCount; ++row)
+            {
+                if (row == through || !this->determines(row, through))
+                {
+                    continue;
+                }
+
+                ul *rowWords = &this->rows[row * this->wordCount];
+
+                for (std::size_t word = 0; word < this->wordCount; ++word)
+                {
+                    rowWords[word] |= throughWords[word];
+                }
+            }
+        }
+    }
+
+    bool ClosureMatrix::applyCompositeDependencies(const store::DependencyStore &store)
+    {
+        bool changed = false;
+
+        for (ui index = 0; index < store.getDependencyCount(); ++index)
+        {
+            const std::span<const us> determinant = store.getDeterminant(index);
+
+            if (determinant.size() <= 1)
+            {
+                continue;
+            }
+
+            for (us row = 0; row < this->attributeCount; ++row)
+            {
+                if (!std::all_of(determinant.begin(), determinant.end(), [this, row](const us attributeId)
+                                 { return this->determines(row, attributeId); }))
+                {
+                    continue;
+                }
+
+                for (const us dependentId : store.getDependent(index))
+                {
+                    if (!this->determines(row, dependentId))
+                    {
+                        this->addToRow(row, dependentId);
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        return changed;
+    }
+}
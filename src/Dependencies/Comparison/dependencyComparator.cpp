@@ -0,0 +1,88 @@
+/*! \file dependencyComparator.cpp
+    \brief C++ file for comparing two sets of functional dependencies.
+    \details Contains the function definitions for checking if two sets of functional dependencies over the same schema are equivalent and finding how they differ
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Comparison/dependencyComparator.h"
+
+namespace normalizer::dependencies::comparison
+{
+    /* Constructors and Destructors */
+
+    DependencyComparator::DependencyComparator(const std::vector<functional::FunctionalDependency> &inOldDependencies, const std::vector<functional::FunctionalDependency> &inNewDependencies, const us count)
+    {
+        const closure::ClosureCalculator oldCalculator(inOldDependencies, count);
+        const closure::ClosureCalculator newCalculator(inNewDependencies, count);
+
+        this->addedDependencies = DependencyComparator::findUnimplied(inNewDependencies, oldCalculator);
+        this->removedDependencies = DependencyComparator::findUnimplied(inOldDependencies, newCalculator);
+        this->redundantDependencies = DependencyComparator::findRedundant(newCalculator);
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<functional::FunctionalDependency> &DependencyComparator::getAddedDependencies() const
+    {
+        return this->addedDependencies;
+    }
+
+    const std::vector<functional::FunctionalDependency> &DependencyComparator::getRemovedDependencies() const
+    {
+        return this->removedDependencies;
+    }
+
+    const std::vector<functional::FunctionalDependency> &DependencyComparator::getRedundantDependencies() const
+    {
+        return this->redundantDependencies;
+    }
+
+    /* Member Functions */
+
+    bool DependencyComparator::isEquivalent() const
+    {
+        return this->addedDependencies.empty() && this->removedDependencies.empty();
+    }
+
+    std::vector<functional::FunctionalDependency> DependencyComparator::findUnimplied(const std::vector<functional::FunctionalDependency> &dependencies, const closure::ClosureCalculator &calculator)
+    {
+        std::vector<functional::FunctionalDependency> unimplied;
+
+        for (const functional::FunctionalDependency &dependency : dependencies)
+        {
+            if (calculator.implies(dependency.getDeterminant(), dependency.getDependent())) // Stops as soon as the right hand side is reached
+            {
+                continue;
+            }
+
+            unimplied.push_back({dependency.getDeterminant(), dependency.getDependent() - calculator.computeClosure(dependency.getDeterminant())});
+        }
+
+        return unimplied;
+    }
+
+    std::vector<functional::FunctionalDependency> DependencyComparator::findRedundant(const closure::ClosureCalculator &calculator)
+    {
+        const std::vector<functional::FunctionalDependency> &dependencies = calculator.getFunctionalDependencies();
+
+        std::vector<functional::FunctionalDependency> redundant;
+        std::vector<bool> enabledDependencies(dependencies.size(), true);
+
+        for (std::size_t i = 0; i < dependencies.size(); ++i)
+        {
+            enabledDependencies[i] = false;
+
+            if (calculator.implies(dependencies[i].getDeterminant(), dependencies[i].getDependent(), enabledDependencies))
+            {
+                redundant.push_back(dependencies[i]); // Left disabled, so two dependencies that imply each other are not both dropped
+                continue;
+            }
+
+            enabledDependencies[i] = true;
+        }
+
+        return redundant;
+    }
+}
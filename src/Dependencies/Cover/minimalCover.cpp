@@ -0,0 +1,119 @@
+/*! \file minimalCover.cpp
+    \brief C++ file for computing a minimal cover.
+    \details Contains the function definitions for reducing a set of functional dependencies to a minimal cover
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Cover/minimalCover.h"
+
+namespace normalizer::dependencies::cover
+{
+    /* Static Functions */
+
+    std::vector<functional::FunctionalDependency> MinimalCover::compute(const std::vector<functional::FunctionalDependency> &functionalDependencies, const us attributeCount)
+    {
+        std::vector<functional::FunctionalDependency> splitDependencies = MinimalCover::splitDependents(functionalDependencies, attributeCount);
+
+        const closure::ClosureCalculator originalCalculator(splitDependencies, attributeCount);
+
+        std::vector<functional::FunctionalDependency> reducedDependencies;
+
+        for (const functional::FunctionalDependency &dependency : splitDependencies) // Remove the extraneous attributes of each left hand side
+        {
+            attribute::AttributeSet determinant = dependency.getDeterminant();
+
+            for (const us attributeId : dependency.getDeterminant().getAttributes())
+            {
+                attribute::AttributeSet reduced = determinant;
+                reduced.removeAttribute(attributeId);
+
+                if (originalCalculator.implies(reduced, dependency.getDependent()))
+                {
+                    determinant = reduced;
+                }
+            }
+
+            reducedDependencies.push_back({determinant, dependency.getDependent()});
+        }
+
+        const closure::ClosureCalculator reducedCalculator(reducedDependencies, attributeCount);
+
+        std::vector<bool> enabledDependencies(reducedDependencies.size(), true);
+
+        for (std::size_t i = 0; i < reducedDependencies.size(); ++i) // Drop the dependencies implied by the rest
+        {
+            enabledDependencies[i] = false;
+
+            const attribute::AttributeSet closure = reducedCalculator.computeClosure(reducedDependencies[i].getDeterminant(), enabledDependencies);
+
+            if (!reducedDependencies[i].getDependent().isSubsetOf(closure))
+            {
+                enabledDependencies[i] = true;
+            }
+        }
+
+        std::vector<functional::FunctionalDependency> coverDependencies;
+
+        for (std::size_t i = 0; i < reducedDependencies.size(); ++i)
+        {
+            if (enabledDependencies[i])
+            {
+                coverDependencies.push_back(reducedDependencies[i]);
+            }
+        }
+
+        return MinimalCover::mergeDeterminants(coverDependencies);
+    }
+
+    std::vector<functional::FunctionalDependency> MinimalCover::splitDependents(const std::vector<functional::FunctionalDependency> &functionalDependencies, const us attributeCount)
+    {
+        std::vector<functional::FunctionalDependency> splitDependencies;
+
+        for (const functional::FunctionalDependency &dependency : functionalDependencies)
+        {
+            const attribute::AttributeSet nonTrivial = dependency.getDependent() - dependency.getDeterminant();
+
+            for (const us attributeId : nonTrivial.getAttributes())
+            {
+                attribute::AttributeSet dependent(attributeCount);
+                dependent.addAttribute(attributeId);
+
+                splitDependencies.push_back({dependency.getDeterminant(), dependent});
+            }
+        }
+
+        return splitDependencies;
+    }
+
+    std::vector<functional::FunctionalDependency> MinimalCover::mergeDeterminants(const std::vector<functional::FunctionalDependency> &functionalDependencies)
+    {
+        std::vector<attribute::AttributeSet> determinantOrder;
+        std::unordered_map<attribute::AttributeSet, attribute::AttributeSet, attribute::AttributeSetHash> mergedDependents;
+
+        for (const functional::FunctionalDependency &dependency : functionalDependencies)
+        {
+            auto it = mergedDependents.find(dependency.getDeterminant());
+
+            if (it == mergedDependents.end())
+            {
+                determinantOrder.push_back(dependency.getDeterminant());
+                mergedDependents.emplace(dependency.getDeterminant(), dependency.getDependent());
+            }
+            else
+            {
+                it->second |= dependency.getDependent();
+            }
+        }
+
+        std::vector<functional::FunctionalDependency> mergedDependencies;
+
+        for (const attribute::AttributeSet &determinant : determinantOrder)
+        {
+            mergedDependencies.push_back({determinant, mergedDependents.at(determinant)});
+        }
+
+        return mergedDependencies;
+    }
+}
\ No newline at end of file
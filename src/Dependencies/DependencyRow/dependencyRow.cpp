@@ -12,17 +12,17 @@ namespace normalizer::dependencies::row
 {
     /* Getters and Setters */
 
-    std::string DependencyRow::getRowName() const
+    const std::string &DependencyRow::getRowName() const
     {
         return this->rowName;
     }
 
-    std::vector<std::string> DependencyRow::getSingleDependencies() const
+    const std::vector<std::string> &DependencyRow::getSingleDependencies() const
     {
         return this->singleValuedDependencies;
     }
 
-    std::vector<std::string> DependencyRow::getMultiDependencies() const
+    const std::vector<std::string> &DependencyRow::getMultiDependencies() const
     {
         return this->multiValuedDependencies;
     }
@@ -0,0 +1,108 @@
+/*! \file dependencyFileWriter.cpp
+    \brief C++ file for writing discovered dependencies as a dependency file.
+    \details Contains the function definitions for turning functional and multi valued dependencies into the syntax of the files in resources/dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/dependencyFileWriter.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    DependencyFileWriter::DependencyFileWriter(const attribute::AttributeDictionary &inDictionary, const std::vector<functional::FunctionalDependency> &dependencies, const std::vector<multivalued::MultivaluedDependency> &multivaluedDependencies) : dictionary(inDictionary)
+    {
+        std::vector<attribute::AttributeSet> dependents(this->dictionary.getAttributeCount(), this->dictionary.createEmptySet());
+
+        for (const functional::FunctionalDependency &dependency : dependencies)
+        {
+            if (dependency.getDeterminant().count() != 1)
+            {
+                this->unwrittenDependencies.push_back(dependency);
+                continue;
+            }
+
+            dependents[dependency.getDeterminant().findFirst()] |= dependency.getDependent();
+        }
+
+        for (us row = 0; row < this->dictionary.getAttributeCount(); ++row)
+        {
+            if (dependents[row].isEmpty())
+            {
+                continue;
+            }
+
+            attribute::AttributeSet determinant = this->dictionary.createEmptySet();
+            determinant.addAttribute(row);
+
+            this->writtenDependencies.push_back({determinant, dependents[row]});
+        }
+
+        std::vector<attribute::AttributeSet> multiDependents(this->dictionary.getAttributeCount(), this->dictionary.createEmptySet());
+
+        for (const multivalued::MultivaluedDependency &multivaluedDependency : multivaluedDependencies) // Each row of a ->> line is read as its own dependency, so merging them loses nothing
+        {
+            multiDependents[multivaluedDependency.getDeterminant().findFirst()] |= multivaluedDependency.getDependent();
+        }
+
+        for (us row = 0; row < this->dictionary.getAttributeCount(); ++row)
+        {
+            if (multiDependents[row].isEmpty())
+            {
+                continue;
+            }
+
+            attribute::AttributeSet determinant = this->dictionary.createEmptySet();
+            determinant.addAttribute(row);
+
+            this->writtenMultivaluedDependencies.push_back({determinant, multiDependents[row]});
+        }
+
+        closure::ClosureCache closureCache(closure::ClosureCalculator(dependencies, this->dictionary.getAttributeCount()));
+
+        this->primaryKey = this->dictionary.createFullSet();
+
+        for (const attribute::AttributeSet &candidateKey : keys::CandidateKeyFinder(closureCache).findCandidateKeys())
+        {
+            if (candidateKey.count() < this->primaryKey.count())
+            {
+                this->primaryKey = candidateKey;
+            }
+        }
+    }
+
+    /* Getters and Setters */
+
+    const attribute::AttributeSet &DependencyFileWriter::getPrimaryKey() const
+    {
+        return this->primaryKey;
+    }
+
+    const std::vector<functional::FunctionalDependency> &DependencyFileWriter::getUnwrittenDependencies() const
+    {
+        return this->unwrittenDependencies;
+    }
+
+    /* Member Functions */
+
+    std::string DependencyFileWriter::toString() const
+    {
+        std::string returnValue = "";
+
+        for (const functional::FunctionalDependency &dependency : this->writtenDependencies)
+        {
+            returnValue += dependency.toString(this->dictionary) + "\n";
+        }
+
+        for (const multivalued::MultivaluedDependency &multivaluedDependency : this->writtenMultivaluedDependencies)
+        {
+            returnValue += multivaluedDependency.toString(this->dictionary) + "\n";
+        }
+
+        returnValue += "KEY: " + this->dictionary.toString(this->primaryKey);
+
+        return returnValue;
+    }
+}
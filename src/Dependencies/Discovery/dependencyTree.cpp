@@ -0,0 +1,221 @@
+/*! \file dependencyTree.cpp
+    \brief C++ file for a prefix tree of functional dependencies.
+    \details Contains the function definitions for storing candidate functional dependencies by their left hand sides, so the generalizations of a dependency can be found without scanning every dependency
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/dependencyTree.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    DependencyTree::DependencyTree(const us count) : attributeCount(count)
+    {
+        TreeNode root;
+        root.dependents = attribute::AttributeSet(count);
+        root.subtreeDependents = attribute::AttributeSet(count);
+
+        this->nodes.push_back(root);
+    }
+
+    /* Member Functions */
+
+    void DependencyTree::addDependency(const attribute::AttributeSet &determinant, const us dependent)
+    {
+        ui node = 0;
+
+        this->nodes[node].subtreeDependents.addAttribute(dependent);
+
+        for (us column = determinant.findFirst(); column < determinant.getAttributeCount(); column = determinant.findNext(column))
+        {
+            std::vector<std::pair<us, ui>> &children = this->nodes[node].children;
+            const auto child = std::lower_bound(children.begin(), children.end(), std::pair<us, ui>(column, 0));
+
+            if (child != children.end() && child->first == column)
+            {
+                node = child->second;
+            }
+            else
+            {
+                const ui childIndex = static_cast<ui>(this->nodes.size());
+
+                children.insert(child, {column, childIndex});
+
+                TreeNode childNode;
+                childNode.dependents = attribute::AttributeSet(this->attributeCount);
+                childNode.subtreeDependents = attribute::AttributeSet(this->attributeCount);
+
+                this->nodes.push_back(childNode); // Invalidates children, which is not used again
+
+                node = childIndex;
+            }
+
+            this->nodes[node].subtreeDependents.addAttribute(dependent);
+        }
+
+        this->nodes[node].dependents.addAttribute(dependent);
+    }
+
+    void DependencyTree::removeDependency(const attribute::AttributeSet &determinant, const us dependent)
+    {
+        ui node = 0;
+
+        for (us column = determinant.findFirst(); column < determinant.getAttributeCount(); column = determinant.findNext(column))
+        {
+            const std::vector<std::pair<us, ui>> &children = this->nodes[node].children;
+            const auto child = std::lower_bound(children.begin(), children.end(), std::pair<us, ui>(column, 0));
+
+            if (child == children.end() || child->first != column)
+            {
+                return;
+            }
+
+            node = child->second;
+        }
+
+        this->nodes[node].dependents.removeAttribute(dependent);
+    }
+
+    bool DependencyTree::containsGeneralization(const attribute::AttributeSet &determinant, const us dependent) const
+    {
+        return this->containsGeneralization(0, determinant, dependent);
+    }
+
+    std::vector<attribute::AttributeSet> DependencyTree::removeGeneralizations(const attribute::AttributeSet &determinant, const us dependent)
+    {
+        std::vector<attribute::AttributeSet> removed;
+        attribute::AttributeSet path(this->attributeCount);
+
+        this->removeGeneralizations(0, determinant, dependent, path, removed);
+
+        return removed;
+    }
+
+    std::vector<std::pair<attribute::AttributeSet, attribute::AttributeSet>> DependencyTree::getLevel(const us level) const
+    {
+        std::vector<std::pair<attribute::AttributeSet, attribute::AttributeSet>> levelDependencies;
+        std::vector<std::pair<ui, attribute::AttributeSet>> pending = {{0, attribute::AttributeSet(this->attributeCount)}};
+
+        while (!pending.empty())
+        {
+            const std::pair<ui, attribute::AttributeSet> current = pending.back();
+            pending.pop_back();
+
+            const TreeNode &node = this->nodes[current.first];
+
+            if (current.second.count() == level)
+            {
+                if (!node.dependents.isEmpty())
+                {
+                    levelDependencies.push_back({current.second, node.dependents});
+                }
+
+                continue;
+            }
+
+            for (auto child = node.children.rbegin(); child != node.children.rend(); ++child) // Reversed so the left hand sides come out in lexicographic order
+            {
+                attribute::AttributeSet path = current.second;
+                path.addAttribute(child->first);
+
+                pending.push_back({child->second, path});
+            }
+        }
+
+        return levelDependencies;
+    }
+
+    us DependencyTree::getDepth() const
+    {
+        us depth = 0;
+        std::vector<std::pair<ui, us>> pending = {{0, 0}};
+
+        while (!pending.empty())
+        {
+            const std::pair<ui, us> current = pending.back();
+            pending.pop_back();
+
+            depth = std::max(depth, current.second);
+
+            for (const std::pair<us, ui> &child : this->nodes[current.first].children)
+            {
+                pending.push_back({child.second, static_cast<us>(current.second + 1)});
+            }
+        }
+
+        return depth;
+    }
+
+    std::vector<functional::FunctionalDependency> DependencyTree::getDependencies() const
+    {
+        std::vector<functional::FunctionalDependency> dependencies;
+
+        for (us level = 0; level <= this->getDepth(); ++level)
+        {
+            for (const std::pair<attribute::AttributeSet, attribute::AttributeSet> &levelDependency : this->getLevel(level))
+            {
+                for (us dependent = levelDependency.second.findFirst(); dependent < levelDependency.second.getAttributeCount(); dependent = levelDependency.second.findNext(dependent))
+                {
+                    attribute::AttributeSet dependentSet(this->attributeCount);
+                    dependentSet.addAttribute(dependent);
+
+                    dependencies.push_back({levelDependency.first, dependentSet});
+                }
+            }
+        }
+
+        return dependencies;
+    }
+
+    bool DependencyTree::containsGeneralization(const ui node, const attribute::AttributeSet &determinant, const us dependent) const
+    {
+        if (this->nodes[node].dependents.containsAttribute(dependent))
+        {
+            return true;
+        }
+
+        const std::vector<std::pair<us, ui>> &children = this->nodes[node].children;
+        auto child = children.begin();
+
+        for (us column = determinant.findFirst(); column < determinant.getAttributeCount() && child != children.end(); column = determinant.findNext(column)) // Both are in ascending order, so only the attributes of the determinant are looked up rather than every child
+        {
+            child = std::lower_bound(child, children.end(), std::pair<us, ui>(column, 0));
+
+            if (child != children.end() && child->first == column && this->nodes[child->second].subtreeDependents.containsAttribute(dependent) && this->containsGeneralization(child->second, determinant, dependent))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void DependencyTree::removeGeneralizations(const ui node, const attribute::AttributeSet &determinant, const us dependent, attribute::AttributeSet &path, std::vector<attribute::AttributeSet> &removed)
+    {
+        if (this->nodes[node].dependents.containsAttribute(dependent))
+        {
+            this->nodes[node].dependents.removeAttribute(dependent);
+            removed.push_back(path);
+        }
+
+        for (us column = determinant.findFirst(); column < determinant.getAttributeCount(); column = determinant.findNext(column))
+        {
+            const std::vector<std::pair<us, ui>> &children = this->nodes[node].children;
+            const auto child = std::lower_bound(children.begin(), children.end(), std::pair<us, ui>(column, 0));
+
+            if (child == children.end() || child->first != column || !this->nodes[child->second].subtreeDependents.containsAttribute(dependent))
+            {
+                continue;
+            }
+
+            const ui childIndex = child->second;
+
+            path.addAttribute(column);
+            this->removeGeneralizations(childIndex, determinant, dependent, path, removed);
+            path.removeAttribute(column);
+        }
+    }
+}
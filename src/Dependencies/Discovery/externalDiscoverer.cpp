@@ -0,0 +1,139 @@
+/*! \file externalDiscoverer.cpp
+    \brief C++ file for discovering the functional dependencies of a CSV data file larger than memory.
+    \details Contains the function definitions for turning the minimal functional dependencies of a sample of the rows of a CSV data file into those of every row, one partition of the rows at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/externalDiscoverer.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Getters and Setters */
+
+    ul ExternalDiscoverer::getValidationCount() const
+    {
+        return this->validationCount;
+    }
+
+    us ExternalDiscoverer::getLevelCount() const
+    {
+        return this->levelCount;
+    }
+
+    /* Member Functions */
+
+    std::vector<functional::FunctionalDependency> ExternalDiscoverer::discover(const std::vector<functional::FunctionalDependency> &sampleDependencies)
+    {
+        const validation::ExternalDependencyValidator validator(this->partitioner, this->dictionary);
+
+        this->candidates = DependencyTree(this->dictionary.getAttributeCount());
+        this->validationCount = 0;
+        this->levelCount = 0;
+
+        for (const functional::FunctionalDependency &dependency : sampleDependencies)
+        {
+            const attribute::AttributeSet &dependents = dependency.getDependent();
+
+            for (us dependent = dependents.findFirst(); dependent < dependents.getAttributeCount(); dependent = dependents.findNext(dependent))
+            {
+                this->candidates.addDependency(dependency.getDeterminant(), dependent);
+            }
+        }
+
+        for (us level = 0; level <= this->candidates.getDepth(); ++level)
+        {
+            std::vector<functional::FunctionalDependency> levelDependencies;
+
+            for (const std::pair<attribute::AttributeSet, attribute::AttributeSet> &levelCandidate : this->candidates.getLevel(level))
+            {
+                const attribute::AttributeSet &determinant = levelCandidate.first;
+
+                for (us dependent = levelCandidate.second.findFirst(); dependent < levelCandidate.second.getAttributeCount(); dependent = levelCandidate.second.findNext(dependent))
+                {
+                    this->candidates.removeDependency(determinant, dependent);
+
+                    if (this->candidates.containsGeneralization(determinant, dependent)) // A candidate of a lower level already held, so this one is not minimal
+                    {
+                        continue;
+                    }
+
+                    this->candidates.addDependency(determinant, dependent);
+
+                    attribute::AttributeSet dependentSet = this->dictionary.createEmptySet();
+                    dependentSet.addAttribute(dependent);
+
+                    levelDependencies.push_back({determinant, dependentSet});
+                }
+            }
+
+            if (levelDependencies.empty())
+            {
+                continue;
+            }
+
+            ++this->levelCount;
+            this->validationCount += levelDependencies.size();
+
+            if (level == 0)
+            {
+                for (const functional::FunctionalDependency &dependency : levelDependencies)
+                {
+                    const us dependent = dependency.getDependent().findFirst();
+
+                    if (!this->isConstant(dependent))
+                    {
+                        this->candidates.removeDependency(dependency.getDeterminant(), dependent);
+                        this->specialize(dependency.getDeterminant(), dependent);
+                    }
+                }
+
+                continue;
+            }
+
+            for (const validation::DependencyViolation &violation : validator.validate(levelDependencies))
+            {
+                const us dependent = violation.dependency.getDependent().findFirst();
+
+                this->candidates.removeDependency(violation.dependency.getDeterminant(), dependent);
+                this->specialize(violation.dependency.getDeterminant(), dependent);
+            }
+        }
+
+        std::vector<functional::FunctionalDependency> dependencies = this->candidates.getDependencies();
+
+        std::sort(dependencies.begin(), dependencies.end());
+
+        return dependencies;
+    }
+
+    bool ExternalDiscoverer::isConstant(const us column)
+    {
+        ul valueCount = 0;
+
+        this->partitioner.forEachPartition({this->dictionary.getAttributeName(column)}, {0}, [&valueCount](const table::instance::TableInstance &instance, const std::vector<ul> &) noexcept
+                                           { valueCount += instance.getRowCount() > 0 ? instance.getDistinctCount(0) : 0; }); // Each value is in one partition, so the distinct values of the partitions add up
+
+        return valueCount <= 1;
+    }
+
+    void ExternalDiscoverer::specialize(const attribute::AttributeSet &determinant, const us dependent)
+    {
+        for (us column = 0; column < this->dictionary.getAttributeCount(); ++column)
+        {
+            if (column == dependent || determinant.containsAttribute(column))
+            {
+                continue;
+            }
+
+            attribute::AttributeSet specialization = determinant;
+            specialization.addAttribute(column);
+
+            if (!this->candidates.containsGeneralization(specialization, dependent))
+            {
+                this->candidates.addDependency(specialization, dependent);
+            }
+        }
+    }
+}
@@ -0,0 +1,381 @@
+/*! \file hybridDiscoverer.cpp
+    \brief C++ file for discovering the functional dependencies of a wide table by sampling and validating.
+    \details Contains the function definitions for finding every minimal functional dependency of a table instance by alternating between comparing sampled pairs of rows and validating candidate dependencies against every row
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/hybridDiscoverer.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    HybridDiscoverer::HybridDiscoverer(const table::instance::TableInstance &inInstance) : instance(inInstance), efficiencyThreshold(DISCOVERY_SAMPLING_EFFICIENCY), comparisonCount(0), validationCount(0), samplingRoundCount(0)
+    {
+        for (const std::string &columnName : this->instance.getColumnNames())
+        {
+            this->dictionary.addAttribute(columnName);
+        }
+    }
+
+    /* Getters and Setters */
+
+    const attribute::AttributeDictionary &HybridDiscoverer::getAttributeDictionary() const
+    {
+        return this->dictionary;
+    }
+
+    ul HybridDiscoverer::getComparisonCount() const
+    {
+        return this->comparisonCount;
+    }
+
+    ul HybridDiscoverer::getValidationCount() const
+    {
+        return this->validationCount;
+    }
+
+    us HybridDiscoverer::getSamplingRoundCount() const
+    {
+        return this->samplingRoundCount;
+    }
+
+    /* Member Functions */
+
+    std::vector<functional::FunctionalDependency> HybridDiscoverer::discover()
+    {
+        const us attributeCount = this->dictionary.getAttributeCount();
+
+        this->partitions.assign(attributeCount, StrippedPartition());
+        this->candidates = DependencyTree(attributeCount);
+        this->agreeSets.clear();
+        this->newAgreeSets.clear();
+        this->windows.assign(attributeCount, 0);
+        this->efficiencies.assign(attributeCount, 0);
+        this->efficiencyThreshold = DISCOVERY_SAMPLING_EFFICIENCY;
+        this->comparisonCount = 0;
+        this->validationCount = 0;
+        this->samplingRoundCount = 0;
+
+        for (us column = 0; column < attributeCount; ++column) // ∅ -> A is the most general candidate of each attribute
+        {
+            this->candidates.addDependency(this->dictionary.createEmptySet(), column);
+        }
+
+        parallel::ParallelRunner::run(attributeCount, DISCOVERY_NODES_PER_THREAD, [this](const std::size_t begin, const std::size_t end)
+                                      {
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              const us column = static_cast<us>(i);
+
+                                              this->partitions[i] = StrippedPartition(this->instance.getColumn(column), this->instance.getDistinctCount(column));
+                                          } });
+
+        for (us column = 0; column < attributeCount; ++column)
+        {
+            this->windows[column] = 1;
+            this->efficiencies[column] = this->compareWindow(column, 1);
+        }
+
+        this->sample();
+        this->induce();
+
+        for (us level = 0; level <= this->candidates.getDepth(); ++level)
+        {
+            ul failedCount = 0;
+            const ul previousValidationCount = this->validationCount;
+            const std::vector<std::pair<ui, ui>> violations = this->validateLevel(level, failedCount);
+
+            if (static_cast<double>(failedCount) <= static_cast<double>(this->validationCount - previousValidationCount) * DISCOVERY_VALIDATION_FAILURE_RATE)
+            {
+                continue;
+            }
+
+            for (const std::pair<ui, ui> &violation : violations) // The rows that disproved a candidate often disprove others like it
+            {
+                this->compareRows(violation.first, violation.second);
+            }
+
+            this->efficiencyThreshold /= 2;
+            ++this->samplingRoundCount;
+
+            this->sample();
+            this->induce();
+        }
+
+        std::vector<functional::FunctionalDependency> dependencies;
+
+        for (const functional::FunctionalDependency &candidate : this->candidates.getDependencies()) // A candidate added after a larger one can generalize it
+        {
+            const attribute::AttributeSet &determinant = candidate.getDeterminant();
+            const us dependent = candidate.getDependent().findFirst();
+            bool isMinimal = true;
+
+            for (us column = determinant.findFirst(); column < determinant.getAttributeCount() && isMinimal; column = determinant.findNext(column))
+            {
+                attribute::AttributeSet generalization = determinant;
+                generalization.removeAttribute(column);
+
+                isMinimal = !this->candidates.containsGeneralization(generalization, dependent);
+            }
+
+            if (isMinimal)
+            {
+                dependencies.push_back(candidate);
+            }
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+
+        return dependencies;
+    }
+
+    void HybridDiscoverer::sample()
+    {
+        while (!this->efficiencies.empty())
+        {
+            const us column = static_cast<us>(std::max_element(this->efficiencies.begin(), this->efficiencies.end()) - this->efficiencies.begin());
+
+            if (this->efficiencies[column] < this->efficiencyThreshold)
+            {
+                return;
+            }
+
+            ++this->windows[column];
+            this->efficiencies[column] = this->compareWindow(column, this->windows[column]);
+        }
+    }
+
+    double HybridDiscoverer::compareWindow(const us column, const ui window)
+    {
+        const std::vector<ui> &rows = this->partitions[column].getRows();
+        const std::vector<ui> &classOffsets = this->partitions[column].getClassOffsets();
+        ul comparisons = 0;
+        ul newCount = 0;
+
+        for (std::size_t group = 0; group + 1 < classOffsets.size(); ++group)
+        {
+            for (ui i = classOffsets[group]; i + window < classOffsets[group + 1]; ++i)
+            {
+                ++comparisons;
+
+                if (this->compareRows(rows[i], rows[i + window]))
+                {
+                    ++newCount;
+                }
+            }
+        }
+
+        return comparisons == 0 ? 0 : static_cast<double>(newCount) / static_cast<double>(comparisons);
+    }
+
+    bool HybridDiscoverer::compareRows(const ui first, const ui second)
+    {
+        attribute::AttributeSet agreeSet = this->dictionary.createEmptySet();
+
+        ++this->comparisonCount;
+
+        for (us column = 0; column < this->dictionary.getAttributeCount(); ++column)
+        {
+            const std::vector<ui> &values = this->instance.getColumn(column);
+
+            if (values[first] == values[second])
+            {
+                agreeSet.addAttribute(column);
+            }
+        }
+
+        if (agreeSet.count() == this->dictionary.getAttributeCount()) // Equal rows disprove nothing
+        {
+            return false;
+        }
+
+        if (!this->agreeSets.insert(agreeSet).second)
+        {
+            return false;
+        }
+
+        this->newAgreeSets.push_back(agreeSet);
+
+        return true;
+    }
+
+    void HybridDiscoverer::induce()
+    {
+        std::sort(this->newAgreeSets.begin(), this->newAgreeSets.end(), [](const attribute::AttributeSet &first, const attribute::AttributeSet &second)
+                  { return first.count() > second.count(); }); // The largest agree sets remove the most candidates at once
+
+        for (const attribute::AttributeSet &agreeSet : this->newAgreeSets)
+        {
+            for (us dependent = 0; dependent < this->dictionary.getAttributeCount(); ++dependent)
+            {
+                if (agreeSet.containsAttribute(dependent))
+                {
+                    continue;
+                }
+
+                attribute::AttributeSet excluded = agreeSet;
+                excluded.addAttribute(dependent);
+
+                for (const attribute::AttributeSet &determinant : this->candidates.removeGeneralizations(agreeSet, dependent))
+                {
+                    this->specialize(determinant, dependent, excluded);
+                }
+            }
+        }
+
+        this->newAgreeSets.clear();
+    }
+
+    void HybridDiscoverer::specialize(const attribute::AttributeSet &determinant, const us dependent, const attribute::AttributeSet &excluded)
+    {
+        for (us column = 0; column < this->dictionary.getAttributeCount(); ++column)
+        {
+            if (excluded.containsAttribute(column))
+            {
+                continue;
+            }
+
+            attribute::AttributeSet specialization = determinant;
+            specialization.addAttribute(column);
+
+            if (!this->candidates.containsGeneralization(specialization, dependent))
+            {
+                this->candidates.addDependency(specialization, dependent);
+            }
+        }
+    }
+
+    std::vector<std::pair<ui, ui>> HybridDiscoverer::validateLevel(const us level, ul &failedCount)
+    {
+        const std::vector<std::pair<attribute::AttributeSet, attribute::AttributeSet>> levelCandidates = this->candidates.getLevel(level);
+        std::vector<attribute::AttributeSet> failedDependents(levelCandidates.size(), this->dictionary.createEmptySet());
+        std::vector<std::vector<std::pair<ui, ui>>> violations(levelCandidates.size());
+
+        parallel::ParallelRunner::run(levelCandidates.size(), DISCOVERY_NODES_PER_THREAD, [this, &levelCandidates, &failedDependents, &violations](const std::size_t begin, const std::size_t end)
+                                      {
+                                          std::vector<ui> groupRows;
+
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              const attribute::AttributeSet &determinant = levelCandidates[i].first;
+                                              std::vector<us> dependents = levelCandidates[i].second.getAttributes();
+
+                                              if (determinant.isEmpty()) // ∅ -> A holds only if A has one value
+                                              {
+                                                  for (const us dependent : dependents)
+                                                  {
+                                                      const std::vector<ui> &values = this->instance.getColumn(dependent);
+                                                      const auto differentRow = std::find_if(values.begin(), values.end(), [&values](const ui value)
+                                                                                             { return value != values.front(); });
+
+                                                      if (differentRow != values.end())
+                                                      {
+                                                          failedDependents[i].addAttribute(dependent);
+                                                          violations[i].push_back({0, static_cast<ui>(differentRow - values.begin())});
+                                                      }
+                                                  }
+
+                                                  continue;
+                                              }
+
+                                              us pivot = determinant.findFirst(); // The column with the fewest rows in groups has the least to check
+
+                                              for (us column = determinant.findNext(pivot); column < determinant.getAttributeCount(); column = determinant.findNext(column))
+                                              {
+                                                  if (this->partitions[column].getRows().size() < this->partitions[pivot].getRows().size())
+                                                  {
+                                                      pivot = column;
+                                                  }
+                                              }
+
+                                              std::vector<const std::vector<ui> *> otherColumns;
+
+                                              for (us column = determinant.findFirst(); column < determinant.getAttributeCount(); column = determinant.findNext(column))
+                                              {
+                                                  if (column != pivot)
+                                                  {
+                                                      otherColumns.push_back(&this->instance.getColumn(column));
+                                                  }
+                                              }
+
+                                              const std::vector<ui> &rows = this->partitions[pivot].getRows();
+                                              const std::vector<ui> &classOffsets = this->partitions[pivot].getClassOffsets();
+
+                                              for (std::size_t group = 0; group + 1 < classOffsets.size() && !dependents.empty(); ++group)
+                                              {
+                                                  groupRows.assign(rows.begin() + classOffsets[group], rows.begin() + classOffsets[group + 1]);
+
+                                                  std::sort(groupRows.begin(), groupRows.end(), [&otherColumns](const ui first, const ui second)
+                                                            {
+                                                                for (const std::vector<ui> *values : otherColumns)
+                                                                {
+                                                                    if ((*values)[first] != (*values)[second])
+                                                                    {
+                                                                        return (*values)[first] < (*values)[second];
+                                                                    }
+                                                                }
+
+                                                                return false; }); // Rows that agree on the whole left hand side end up next to each other
+
+                                                  std::size_t representative = 0;
+
+                                                  for (std::size_t j = 1; j < groupRows.size() && !dependents.empty(); ++j)
+                                                  {
+                                                      const bool sameDeterminant = std::all_of(otherColumns.begin(), otherColumns.end(), [&groupRows, representative, j](const std::vector<ui> *values)
+                                                                                               { return (*values)[groupRows[representative]] == (*values)[groupRows[j]]; });
+
+                                                      if (!sameDeterminant)
+                                                      {
+                                                          representative = j;
+                                                          continue;
+                                                      }
+
+                                                      for (std::size_t k = dependents.size(); k-- > 0;)
+                                                      {
+                                                          const std::vector<ui> &values = this->instance.getColumn(dependents[k]);
+
+                                                          if (values[groupRows[representative]] != values[groupRows[j]])
+                                                          {
+                                                              failedDependents[i].addAttribute(dependents[k]);
+                                                              violations[i].push_back({groupRows[representative], groupRows[j]});
+                                                              dependents.erase(dependents.begin() + static_cast<std::ptrdiff_t>(k));
+                                                          }
+                                                      }
+                                                  }
+                                              }
+                                          } });
+
+        std::vector<std::pair<ui, ui>> allViolations;
+
+        for (std::size_t i = 0; i < levelCandidates.size(); ++i)
+        {
+            this->validationCount += levelCandidates[i].second.count();
+            failedCount += failedDependents[i].count();
+
+            for (us dependent = failedDependents[i].findFirst(); dependent < failedDependents[i].getAttributeCount(); dependent = failedDependents[i].findNext(dependent))
+            {
+                this->candidates.removeDependency(levelCandidates[i].first, dependent);
+            }
+
+            allViolations.insert(allViolations.end(), violations[i].begin(), violations[i].end());
+        }
+
+        for (std::size_t i = 0; i < levelCandidates.size(); ++i) // Every failed candidate of the level is removed first, so none of them hides a specialization of another
+        {
+            const attribute::AttributeSet &determinant = levelCandidates[i].first;
+
+            for (us dependent = failedDependents[i].findFirst(); dependent < failedDependents[i].getAttributeCount(); dependent = failedDependents[i].findNext(dependent))
+            {
+                attribute::AttributeSet excluded = determinant;
+                excluded.addAttribute(dependent);
+
+                this->specialize(determinant, dependent, excluded);
+            }
+        }
+
+        return allViolations;
+    }
+}
@@ -0,0 +1,205 @@
+/*! \file multivaluedDiscoverer.cpp
+    \brief C++ file for discovering the multi valued dependencies that hold on the rows of a table.
+    \details Contains the function definitions for finding the multi valued dependencies of a table instance that its functional dependencies do not already imply
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/multivaluedDiscoverer.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    MultivaluedDiscoverer::MultivaluedDiscoverer(const table::instance::TableInstance &inInstance, const std::vector<functional::FunctionalDependency> &inFunctionalDependencies) : instance(inInstance), functionalDependencies(inFunctionalDependencies), testCount(0)
+    {
+        for (const std::string &columnName : this->instance.getColumnNames())
+        {
+            this->dictionary.addAttribute(columnName);
+        }
+    }
+
+    /* Getters and Setters */
+
+    const attribute::AttributeDictionary &MultivaluedDiscoverer::getAttributeDictionary() const
+    {
+        return this->dictionary;
+    }
+
+    ul MultivaluedDiscoverer::getTestCount() const
+    {
+        return this->testCount;
+    }
+
+    /* Member Functions */
+
+    std::vector<multivalued::MultivaluedDependency> MultivaluedDiscoverer::discover()
+    {
+        const us attributeCount = this->dictionary.getAttributeCount();
+        const closure::ClosureCalculator calculator(this->functionalDependencies, attributeCount);
+        const attribute::AttributeSet fullSet = this->dictionary.createFullSet();
+
+        std::vector<std::pair<us, us>> candidates;
+
+        for (us determinant = 0; determinant < attributeCount; ++determinant)
+        {
+            attribute::AttributeSet determinantSet = this->dictionary.createEmptySet();
+            determinantSet.addAttribute(determinant);
+
+            const attribute::AttributeSet undetermined = fullSet - calculator.computeClosure(determinantSet);
+
+            if (undetermined.count() < 2) // Superkeys multi-determine everything, and with one column left A ->> B only restates that A determines the rest
+            {
+                continue;
+            }
+
+            for (us dependent = undetermined.findFirst(); dependent < undetermined.getAttributeCount(); dependent = undetermined.findNext(dependent))
+            {
+                candidates.push_back({determinant, dependent});
+            }
+        }
+
+        this->testCount = candidates.size();
+
+        if (candidates.empty())
+        {
+            return {};
+        }
+
+        std::vector<std::vector<ui>> suffixRows(attributeCount + 1, std::vector<ui>(this->instance.getRowCount(), 0)); // The rows without the columns before each column, so every tuple without one column is one combination away
+
+        for (us column = attributeCount; column-- > 0;)
+        {
+            suffixRows[column] = this->combineIdentifiers(this->instance.getColumn(column), suffixRows[column + 1]);
+        }
+
+        std::vector<ui> prefixRows(this->instance.getRowCount(), 0);
+
+        this->rowsWithout.assign(attributeCount, {});
+
+        for (us column = 0; column < attributeCount; ++column)
+        {
+            this->rowsWithout[column] = this->combineIdentifiers(prefixRows, suffixRows[column + 1]);
+            prefixRows = this->combineIdentifiers(prefixRows, this->instance.getColumn(column));
+        }
+
+        this->wholeRows = std::move(prefixRows);
+
+        std::vector<StrippedPartition> partitions(attributeCount);
+
+        for (const std::pair<us, us> &candidate : candidates)
+        {
+            if (partitions[candidate.first].getRowCount() == 0)
+            {
+                partitions[candidate.first] = StrippedPartition(this->instance.getColumn(candidate.first), this->instance.getDistinctCount(candidate.first));
+            }
+        }
+
+        std::vector<char> holding(candidates.size(), 0);
+
+        parallel::ParallelRunner::run(candidates.size(), DISCOVERY_NODES_PER_THREAD, [this, &candidates, &partitions, &holding](const std::size_t begin, const std::size_t end)
+                                      {
+                                          std::vector<std::vector<ui>> seenStamps(3, std::vector<ui>(this->instance.getRowCount(), 0));
+                                          ui stamp = 0;
+
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              holding[i] = this->holds(partitions[candidates[i].first], candidates[i].second, seenStamps, stamp);
+                                          } });
+
+        std::vector<multivalued::MultivaluedDependency> multivaluedDependencies;
+
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (!holding[i])
+            {
+                continue;
+            }
+
+            attribute::AttributeSet determinant = this->dictionary.createEmptySet();
+            attribute::AttributeSet dependent = this->dictionary.createEmptySet();
+
+            determinant.addAttribute(candidates[i].first);
+            dependent.addAttribute(candidates[i].second);
+
+            multivaluedDependencies.push_back({determinant, dependent});
+        }
+
+        return multivaluedDependencies;
+    }
+
+    std::vector<ui> MultivaluedDiscoverer::combineIdentifiers(const std::vector<ui> &first, const std::vector<ui> &second) const
+    {
+        std::vector<ui> combined(first.size());
+        std::unordered_map<ul, ui> identifiers;
+
+        identifiers.reserve(first.size());
+
+        for (std::size_t row = 0; row < first.size(); ++row)
+        {
+            const ul key = static_cast<ul>(first[row]) * first.size() + second[row]; // Both are below the number of rows, so every pair has its own key
+
+            combined[row] = identifiers.emplace(key, static_cast<ui>(identifiers.size())).first->second;
+        }
+
+        return combined;
+    }
+
+    bool MultivaluedDiscoverer::holds(const StrippedPartition &determinant, const us dependent, std::vector<std::vector<ui>> &seenStamps, ui &stamp) const
+    {
+        const std::vector<ui> &rows = determinant.getRows();
+        const std::vector<ui> &classOffsets = determinant.getClassOffsets();
+        const std::vector<ui> &dependentValues = this->instance.getColumn(dependent);
+        const std::vector<ui> &otherRows = this->rowsWithout[dependent];
+
+        for (std::size_t group = 0; group + 1 < classOffsets.size(); ++group)
+        {
+            if (stamp == std::numeric_limits<ui>::max())
+            {
+                for (std::vector<ui> &seen : seenStamps)
+                {
+                    std::fill(seen.begin(), seen.end(), 0);
+                }
+
+                stamp = 0;
+            }
+
+            ++stamp;
+
+            ul dependentCount = 0;
+            ul otherCount = 0;
+            ul wholeCount = 0;
+
+            for (ui i = classOffsets[group]; i < classOffsets[group + 1]; ++i)
+            {
+                const ui row = rows[i];
+
+                if (seenStamps[0][dependentValues[row]] != stamp)
+                {
+                    seenStamps[0][dependentValues[row]] = stamp;
+                    ++dependentCount;
+                }
+
+                if (seenStamps[1][otherRows[row]] != stamp)
+                {
+                    seenStamps[1][otherRows[row]] = stamp;
+                    ++otherCount;
+                }
+
+                if (seenStamps[2][this->wholeRows[row]] != stamp)
+                {
+                    seenStamps[2][this->wholeRows[row]] = stamp;
+                    ++wholeCount;
+                }
+            }
+
+            if (wholeCount != dependentCount * otherCount) // A missing combination of B and Z means the group is not their cross product
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
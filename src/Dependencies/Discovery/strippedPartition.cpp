@@ -0,0 +1,205 @@
+/*! \file strippedPartition.cpp
+    \brief C++ file for the stripped partition of the rows of a table.
+    \details Contains the function definitions for grouping the rows of a table that agree on a set of attributes, leaving out the rows that agree with no other row
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/strippedPartition.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    StrippedPartition::StrippedPartition(const ui count) : classOffsets(1, 0), rowCount(count)
+    {
+        if (count < 2)
+        {
+            return;
+        }
+
+        for (ui row = 0; row < count; ++row)
+        {
+            this->rows.push_back(row);
+        }
+
+        this->classOffsets.push_back(count);
+    }
+
+    StrippedPartition::StrippedPartition(const std::vector<ui> &column, const ui distinctCount) : classOffsets(1, 0), rowCount(static_cast<ui>(column.size()))
+    {
+        std::vector<ui> valueOffsets(distinctCount + 1, 0);
+
+        for (const ui value : column)
+        {
+            ++valueOffsets[value + 1];
+        }
+
+        for (ui value = 0; value < distinctCount; ++value)
+        {
+            valueOffsets[value + 1] += valueOffsets[value];
+        }
+
+        std::vector<ui> sortedRows(column.size());
+        std::vector<ui> nextSlot(valueOffsets.begin(), valueOffsets.end() - 1);
+
+        for (ui row = 0; row < this->rowCount; ++row) // Rows stay in ascending order within each value
+        {
+            sortedRows[nextSlot[column[row]]++] = row;
+        }
+
+        for (ui value = 0; value < distinctCount; ++value)
+        {
+            if (valueOffsets[value + 1] - valueOffsets[value] < 2)
+            {
+                continue;
+            }
+
+            this->rows.insert(this->rows.end(), sortedRows.begin() + valueOffsets[value], sortedRows.begin() + valueOffsets[value + 1]);
+            this->classOffsets.push_back(static_cast<ui>(this->rows.size()));
+        }
+    }
+
+    /* Getters and Setters */
+
+    ui StrippedPartition::getRowCount() const
+    {
+        return this->rowCount;
+    }
+
+    ui StrippedPartition::getClassCount() const
+    {
+        return static_cast<ui>(this->classOffsets.size() - 1);
+    }
+
+    const std::vector<ui> &StrippedPartition::getRows() const
+    {
+        return this->rows;
+    }
+
+    const std::vector<ui> &StrippedPartition::getClassOffsets() const
+    {
+        return this->classOffsets;
+    }
+
+    ui StrippedPartition::getErrorCount() const
+    {
+        return static_cast<ui>(this->rows.size()) - this->getClassCount();
+    }
+
+    /* Member Functions */
+
+    bool StrippedPartition::isUnique() const
+    {
+        return this->rows.empty();
+    }
+
+    StrippedPartition StrippedPartition::multiply(const StrippedPartition &other, std::vector<ui> &probeTable) const
+    {
+        StrippedPartition product;
+        product.rowCount = this->rowCount;
+
+        for (ui group = 0; group < this->getClassCount(); ++group)
+        {
+            for (ui i = this->classOffsets[group]; i < this->classOffsets[group + 1]; ++i)
+            {
+                probeTable[this->rows[i]] = group;
+            }
+        }
+
+        std::vector<ui> groupSlots(this->getClassCount(), 0); // How many rows of otherGroup fall in each group of this partition, then where the next of them goes
+        std::vector<ui> touchedGroups;
+
+        for (ui otherGroup = 0; otherGroup < other.getClassCount(); ++otherGroup)
+        {
+            touchedGroups.clear();
+
+            for (ui i = other.classOffsets[otherGroup]; i < other.classOffsets[otherGroup + 1]; ++i)
+            {
+                const ui group = probeTable[other.rows[i]];
+
+                if (group != NO_CLASS && groupSlots[group]++ == 0)
+                {
+                    touchedGroups.push_back(group);
+                }
+            }
+
+            for (const ui group : touchedGroups) // The rows in both otherGroup and a group of this partition agree in both, so they become a group of the product unless they are alone
+            {
+                const ui size = groupSlots[group];
+
+                if (size < 2)
+                {
+                    groupSlots[group] = NO_CLASS;
+                    continue;
+                }
+
+                groupSlots[group] = static_cast<ui>(product.rows.size());
+                product.rows.resize(product.rows.size() + size);
+                product.classOffsets.push_back(static_cast<ui>(product.rows.size()));
+            }
+
+            for (ui i = other.classOffsets[otherGroup]; i < other.classOffsets[otherGroup + 1]; ++i)
+            {
+                const ui row = other.rows[i];
+                const ui group = probeTable[row];
+
+                if (group != NO_CLASS && groupSlots[group] != NO_CLASS)
+                {
+                    product.rows[groupSlots[group]++] = row;
+                }
+            }
+
+            for (const ui group : touchedGroups)
+            {
+                groupSlots[group] = 0;
+            }
+        }
+
+        for (const ui row : this->rows)
+        {
+            probeTable[row] = NO_CLASS;
+        }
+
+        return product;
+    }
+
+    ui StrippedPartition::countViolations(const StrippedPartition &refined, std::vector<ui> &probeTable) const
+    {
+        for (ui group = 0; group < refined.getClassCount(); ++group)
+        {
+            for (ui i = refined.classOffsets[group]; i < refined.classOffsets[group + 1]; ++i)
+            {
+                probeTable[refined.rows[i]] = group;
+            }
+        }
+
+        std::vector<ui> groupSizes(refined.getClassCount(), 0);
+        ui violationCount = 0;
+
+        for (ui group = 0; group < this->getClassCount(); ++group)
+        {
+            ui largestSize = 1; // A row in no group of the refined partition is a group of one
+
+            for (ui i = this->classOffsets[group]; i < this->classOffsets[group + 1]; ++i)
+            {
+                const ui refinedGroup = probeTable[this->rows[i]];
+
+                if (refinedGroup != NO_CLASS)
+                {
+                    largestSize = std::max(largestSize, ++groupSizes[refinedGroup]);
+                }
+            }
+
+            violationCount += this->classOffsets[group + 1] - this->classOffsets[group] - largestSize;
+        }
+
+        for (const ui row : refined.rows)
+        {
+            probeTable[row] = NO_CLASS;
+        }
+
+        return violationCount;
+    }
+}
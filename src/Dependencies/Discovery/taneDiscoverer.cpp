@@ -0,0 +1,298 @@
+/*! \file taneDiscoverer.cpp
+    \brief C++ file for discovering the functional dependencies that hold on the rows of a table.
+    \details Contains the function definitions for finding every minimal functional dependency of a table instance with a level by level search of its attribute sets
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Discovery/taneDiscoverer.h"
+
+namespace normalizer::dependencies::discovery
+{
+    /* Constructors and Destructors */
+
+    TaneDiscoverer::TaneDiscoverer(const table::instance::TableInstance &inInstance, const double inMaxError) : instance(inInstance), maxError(inMaxError), levelCount(0)
+    {
+        for (const std::string &columnName : this->instance.getColumnNames())
+        {
+            this->dictionary.addAttribute(columnName);
+        }
+    }
+
+    /* Getters and Setters */
+
+    const attribute::AttributeDictionary &TaneDiscoverer::getAttributeDictionary() const
+    {
+        return this->dictionary;
+    }
+
+    us TaneDiscoverer::getLevelCount() const
+    {
+        return this->levelCount;
+    }
+
+    ui TaneDiscoverer::getViolationCount(const functional::FunctionalDependency &dependency) const
+    {
+        const auto found = this->violationCounts.find(dependency);
+
+        return found == this->violationCounts.end() ? 0 : found->second;
+    }
+
+    /* Member Functions */
+
+    std::vector<functional::FunctionalDependency> TaneDiscoverer::discover()
+    {
+        DependencyTree dependencies(this->dictionary.getAttributeCount());
+
+        this->levelCount = 0;
+        this->violationCounts.clear();
+
+        LatticeNode emptyNode;
+        emptyNode.attributes = this->dictionary.createEmptySet();
+        emptyNode.partition = StrippedPartition(this->instance.getRowCount());
+        emptyNode.errorCount = emptyNode.partition.getErrorCount();
+        emptyNode.rhsCandidates = this->dictionary.createFullSet();
+
+        std::vector<LatticeNode> previousLevel = {emptyNode};
+        std::vector<LatticeNode> level(this->dictionary.getAttributeCount());
+
+        parallel::ParallelRunner::run(level.size(), DISCOVERY_NODES_PER_THREAD, [this, &level](const std::size_t begin, const std::size_t end)
+                                      {
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              const us column = static_cast<us>(i);
+
+                                              level[i].attributes = this->dictionary.createEmptySet();
+                                              level[i].attributes.addAttribute(column);
+                                              level[i].partition = StrippedPartition(this->instance.getColumn(column), this->instance.getDistinctCount(column));
+                                              level[i].errorCount = level[i].partition.getErrorCount();
+                                          } });
+
+        while (!level.empty())
+        {
+            ++this->levelCount;
+
+            std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> previousIndex;
+
+            for (std::size_t i = 0; i < previousLevel.size(); ++i)
+            {
+                previousIndex.emplace(previousLevel[i].attributes, i);
+            }
+
+            this->computeDependencies(level, previousLevel, previousIndex);
+
+            for (LatticeNode &node : previousLevel) // Only the error counts and C+ are needed once the violations of this level are counted
+            {
+                node.partition = StrippedPartition();
+            }
+
+            for (LatticeNode &node : level)
+            {
+                for (const std::pair<functional::FunctionalDependency, ui> &found : node.found)
+                {
+                    dependencies.addDependency(found.first.getDeterminant(), found.first.getDependent().findFirst());
+                    this->violationCounts[found.first] = found.second;
+                }
+
+                node.found.clear();
+            }
+
+            this->prune(level, dependencies);
+
+            std::vector<LatticeNode> nextLevel = this->generateNextLevel(level);
+
+            previousLevel = std::move(level);
+            level = std::move(nextLevel);
+        }
+
+        std::vector<functional::FunctionalDependency> minimalDependencies = dependencies.getDependencies();
+
+        std::sort(minimalDependencies.begin(), minimalDependencies.end());
+
+        return minimalDependencies;
+    }
+
+    void TaneDiscoverer::computeDependencies(std::vector<LatticeNode> &level, const std::vector<LatticeNode> &previousLevel, const std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> &previousIndex) const
+    {
+        const attribute::AttributeSet fullSet = this->dictionary.createFullSet();
+        const ui maxViolationCount = static_cast<ui>(this->maxError * this->instance.getRowCount());
+
+        parallel::ParallelRunner::run(level.size(), DISCOVERY_NODES_PER_THREAD, [&](const std::size_t begin, const std::size_t end)
+                                      {
+                                          std::vector<ui> probeTable; // Only allocated once a dependency needs its violations counted
+
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              LatticeNode &node = level[i];
+                                              const std::vector<us> attributes = node.attributes.getAttributes();
+
+                                              node.rhsCandidates = fullSet;
+
+                                              for (const us column : attributes)
+                                              {
+                                                  attribute::AttributeSet subset = node.attributes;
+                                                  subset.removeAttribute(column);
+
+                                                  node.rhsCandidates &= previousLevel[previousIndex.at(subset)].rhsCandidates;
+                                              }
+
+                                              for (const us column : attributes)
+                                              {
+                                                  if (!node.rhsCandidates.containsAttribute(column))
+                                                  {
+                                                      continue;
+                                                  }
+
+                                                  attribute::AttributeSet subset = node.attributes;
+                                                  subset.removeAttribute(column);
+
+                                                  const LatticeNode &subsetNode = previousLevel[previousIndex.at(subset)];
+                                                  attribute::AttributeSet dependent = this->dictionary.createEmptySet();
+                                                  dependent.addAttribute(column);
+
+                                                  if (subsetNode.errorCount == node.errorCount) // No group of the subset is split by adding the attribute, so the subset determines it
+                                                  {
+                                                      node.found.push_back({{subset, dependent}, 0});
+                                                      node.rhsCandidates.removeAttribute(column);
+                                                      node.rhsCandidates -= fullSet - node.attributes; // A superset of the subset could only give non minimal dependencies
+                                                      continue;
+                                                  }
+
+                                                  if (subsetNode.errorCount - node.errorCount > maxViolationCount) // Each extra group a split makes needs at least one row removed
+                                                  {
+                                                      continue;
+                                                  }
+
+                                                  if (probeTable.empty())
+                                                  {
+                                                      probeTable.assign(this->instance.getRowCount(), StrippedPartition::NO_CLASS);
+                                                  }
+
+                                                  const ui violationCount = subsetNode.partition.countViolations(node.partition, probeTable);
+
+                                                  if (violationCount <= maxViolationCount) // Only the attribute itself is removed from C+, as supersets of the subset may still hold with fewer violations
+                                                  {
+                                                      node.found.push_back({{subset, dependent}, violationCount});
+                                                      node.rhsCandidates.removeAttribute(column);
+                                                  }
+                                              }
+                                          } });
+    }
+
+    void TaneDiscoverer::prune(std::vector<LatticeNode> &level, DependencyTree &dependencies)
+    {
+        std::vector<char> kept(level.size(), 1);
+
+        for (std::size_t i = 0; i < level.size(); ++i)
+        {
+            const LatticeNode &node = level[i];
+
+            if (node.rhsCandidates.isEmpty())
+            {
+                kept[i] = 0;
+                continue;
+            }
+
+            if (!node.partition.isUnique())
+            {
+                continue;
+            }
+
+            const attribute::AttributeSet candidates = node.rhsCandidates - node.attributes;
+
+            for (us column = candidates.findFirst(); column < candidates.getAttributeCount(); column = candidates.findNext(column))
+            {
+                if (!dependencies.containsGeneralization(node.attributes, column)) // Every dependency with a smaller left hand side is already found, while C+(X ∪ {A} - {B}) is lost when that set was never built
+                {
+                    attribute::AttributeSet dependent = this->dictionary.createEmptySet();
+                    dependent.addAttribute(column);
+
+                    dependencies.addDependency(node.attributes, column);
+                    this->violationCounts[{node.attributes, dependent}] = 0;
+                }
+            }
+
+            kept[i] = 0; // Every superset of a superkey is one too
+        }
+
+        std::size_t keptCount = 0;
+
+        for (std::size_t i = 0; i < level.size(); ++i)
+        {
+            if (kept[i])
+            {
+                level[keptCount++] = std::move(level[i]);
+            }
+        }
+
+        level.resize(keptCount);
+    }
+
+    std::vector<TaneDiscoverer::LatticeNode> TaneDiscoverer::generateNextLevel(const std::vector<LatticeNode> &level) const
+    {
+        std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> levelIndex;
+        std::vector<std::vector<us>> attributeLists;
+
+        for (std::size_t i = 0; i < level.size(); ++i)
+        {
+            levelIndex.emplace(level[i].attributes, i);
+            attributeLists.push_back(level[i].attributes.getAttributes());
+        }
+
+        std::vector<LatticeNode> nextLevel;
+        std::vector<std::pair<std::size_t, std::size_t>> parents;
+
+        for (std::size_t blockStart = 0; blockStart < level.size();) // The level is in lexicographic order, so the sets sharing a prefix are next to each other
+        {
+            std::size_t blockEnd = blockStart + 1;
+
+            while (blockEnd < level.size() && std::equal(attributeLists[blockStart].begin(), attributeLists[blockStart].end() - 1, attributeLists[blockEnd].begin()))
+            {
+                ++blockEnd;
+            }
+
+            for (std::size_t first = blockStart; first < blockEnd; ++first)
+            {
+                for (std::size_t second = first + 1; second < blockEnd; ++second)
+                {
+                    const attribute::AttributeSet candidate = level[first].attributes | level[second].attributes;
+                    bool allSubsetsKept = true;
+
+                    for (us removed = candidate.findFirst(); removed < candidate.getAttributeCount() && allSubsetsKept; removed = candidate.findNext(removed))
+                    {
+                        attribute::AttributeSet subset = candidate;
+                        subset.removeAttribute(removed);
+
+                        allSubsetsKept = levelIndex.count(subset) > 0;
+                    }
+
+                    if (allSubsetsKept)
+                    {
+                        LatticeNode node;
+                        node.attributes = candidate;
+
+                        nextLevel.push_back(node);
+                        parents.push_back({first, second});
+                    }
+                }
+            }
+
+            blockStart = blockEnd;
+        }
+
+        const ui rowCount = this->instance.getRowCount();
+
+        parallel::ParallelRunner::run(nextLevel.size(), DISCOVERY_NODES_PER_THREAD, [&](const std::size_t begin, const std::size_t end)
+                                      {
+                                          std::vector<ui> probeTable(rowCount, StrippedPartition::NO_CLASS);
+
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              nextLevel[i].partition = level[parents[i].first].partition.multiply(level[parents[i].second].partition, probeTable);
+                                              nextLevel[i].errorCount = nextLevel[i].partition.getErrorCount();
+                                          } });
+
+        return nextLevel;
+    }
+}
@@ -0,0 +1,88 @@
+/*! \file functionalDependency.cpp
+    \brief C++ file for creating a functional dependency.
+    \details Contains the function definitions for creating a functional dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+
+namespace normalizer::dependencies::functional
+{
+    /* Constructors and Destructors */
+
+    FunctionalDependency::FunctionalDependency(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs) : determinant(lhs), dependent(rhs) {}
+
+    FunctionalDependency::FunctionalDependency(const FunctionalDependency &other) : determinant(other.determinant), dependent(other.dependent) {}
+
+    /* Getters and Setters */
+
+    const attribute::AttributeSet &FunctionalDependency::getDeterminant() const
+    {
+        return this->determinant;
+    }
+
+    const attribute::AttributeSet &FunctionalDependency::getDependent() const
+    {
+        return this->dependent;
+    }
+
+    /* Member Functions */
+
+    std::string FunctionalDependency::toString(const attribute::AttributeDictionary &dictionary) const
+    {
+        return dictionary.toString(this->determinant) + " -> " + dictionary.toString(this->dependent);
+    }
+
+    /* Operator Overloads */
+
+    FunctionalDependency &FunctionalDependency::operator=(const FunctionalDependency &other)
+    {
+        this->determinant = other.determinant;
+        this->dependent = other.dependent;
+
+        return *this;
+    }
+
+    bool FunctionalDependency::operator==(const FunctionalDependency &other) const
+    {
+        return this->determinant == other.determinant && this->dependent == other.dependent;
+    }
+
+    bool FunctionalDependency::operator<(const FunctionalDependency &other) const
+    {
+        const us count = this->determinant.count();
+        const us otherCount = other.determinant.count();
+
+        if (count != otherCount)
+        {
+            return count < otherCount;
+        }
+
+        const std::pair<us, us> firstDifference = FunctionalDependency::findFirstDifference(this->determinant, other.determinant); // Walking the bits avoids building a vector per comparison while sorting
+
+        if (firstDifference.first != firstDifference.second)
+        {
+            return firstDifference.first < firstDifference.second;
+        }
+
+        const std::pair<us, us> dependentDifference = FunctionalDependency::findFirstDifference(this->dependent, other.dependent);
+
+        return dependentDifference.first < dependentDifference.second;
+    }
+
+    std::pair<us, us> FunctionalDependency::findFirstDifference(const attribute::AttributeSet &first, const attribute::AttributeSet &second)
+    {
+        us firstAttribute = first.findFirst();
+        us secondAttribute = second.findFirst();
+
+        while (firstAttribute == secondAttribute && firstAttribute < first.getAttributeCount())
+        {
+            firstAttribute = first.findNext(firstAttribute);
+            secondAttribute = second.findNext(secondAttribute);
+        }
+
+        return {firstAttribute, secondAttribute};
+    }
+}
@@ -0,0 +1,164 @@
+/*! \file dependencyGraph.cpp
+    \brief C++ file for the attribute graph of a set of functional dependencies.
+    \details Contains the function definitions for building a directed graph between attributes from functional dependencies and condensing it into groups of attributes that determine each other
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Graph/dependencyGraph.h"
+
+namespace normalizer::dependencies::graph
+{
+    /* Constructors and Destructors */
+
+    DependencyGraph::DependencyGraph(const store::DependencyStore &store) : edgeOffsets(static_cast<std::size_t>(store.getAttributeCount()) + 1, 0), attributeCount(store.getAttributeCount())
+    {
+        for (ui index = 0; index < store.getDependencyCount(); ++index) // Count the edges of each attribute first
+        {
+            const std::span<const us> determinant = store.getDeterminant(index);
+
+            if (determinant.size() == 1)
+            {
+                this->edgeOffsets[determinant.front() + 1] += static_cast<ui>(store.getDependent(index).size());
+            }
+        }
+
+        for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId)
+        {
+            this->edgeOffsets[attributeId + 1] += this->edgeOffsets[attributeId];
+        }
+
+        this->edges.resize(this->edgeOffsets.back());
+
+        std::vector<ui> positions(this->edgeOffsets.begin(), this->edgeOffsets.end() - 1);
+
+        for (ui index = 0; index < store.getDependencyCount(); ++index)
+        {
+            const std::span<const us> determinant = store.getDeterminant(index);
+
+            if (determinant.size() == 1)
+            {
+                for (const us dependentId : store.getDependent(index))
+                {
+                    this->edges[positions[determinant.front()]++] = dependentId;
+                }
+            }
+        }
+
+        this->findComponents();
+    }
+
+    /* Getters and Setters */
+
+    us DependencyGraph::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    const std::vector<attribute::AttributeSet> &DependencyGraph::getComponents() const
+    {
+        return this->components;
+    }
+
+    std::span<const us> DependencyGraph::getSuccessors(const us attributeId) const
+    {
+        return std::span<const us>(this->edges).subspan(this->edgeOffsets[attributeId], this->edgeOffsets[attributeId + 1] - this->edgeOffsets[attributeId]);
+    }
+
+    /* Member Functions */
+
+    ui DependencyGraph::getComponentIndex(const us attributeId) const
+    {
+        return this->componentIndexes[attributeId];
+    }
+
+    const attribute::AttributeSet &DependencyGraph::getEquivalentAttributes(const us attributeId) const
+    {
+        return this->components[this->componentIndexes[attributeId]];
+    }
+
+    bool DependencyGraph::hasCycles() const
+    {
+        return this->components.size() < this->attributeCount;
+    }
+
+    void DependencyGraph::findComponents()
+    {
+        const ui UNVISITED = std::numeric_limits<ui>::max();
+
+        std::vector<ui> visitOrder(this->attributeCount, UNVISITED);
+        std::vector<ui> lowLinks(this->attributeCount, 0);
+        std::vector<bool> onStack(this->attributeCount, false);
+        std::vector<us> stack;
+        std::vector<std::pair<us, ui>> callStack; // Each attribute being visited, with the next of its edges to follow
+        ui visitCount = 0;
+
+        this->componentIndexes.assign(this->attributeCount, 0);
+
+        for (us start = 0; start < this->attributeCount; ++start)
+        {
+            if (visitOrder[start] != UNVISITED)
+            {
+                continue;
+            }
+
+            visitOrder[start] = lowLinks[start] = visitCount++;
+            stack.push_back(start);
+            onStack[start] = true;
+            callStack.push_back({start, this->edgeOffsets[start]});
+
+            while (!callStack.empty())
+            {
+                const us attributeId = callStack.back().first;
+                ui &nextEdge = callStack.back().second;
+
+                if (nextEdge < this->edgeOffsets[attributeId + 1])
+                {
+                    const us successor = this->edges[nextEdge++];
+
+                    if (visitOrder[successor] == UNVISITED) // Visit the successor before coming back to this attribute
+                    {
+                        visitOrder[successor] = lowLinks[successor] = visitCount++;
+                        stack.push_back(successor);
+                        onStack[successor] = true;
+                        callStack.push_back({successor, this->edgeOffsets[successor]});
+                    }
+                    else if (onStack[successor])
+                    {
+                        lowLinks[attributeId] = std::min(lowLinks[attributeId], visitOrder[successor]);
+                    }
+
+                    continue;
+                }
+
+                if (lowLinks[attributeId] == visitOrder[attributeId]) // The attribute is the root of a component, which is everything above it on the stack
+                {
+                    attribute::AttributeSet component(this->attributeCount);
+                    us member = 0;
+
+                    do
+                    {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+
+                        component.addAttribute(member);
+                        this->componentIndexes[member] = static_cast<ui>(this->components.size());
+                    } while (member != attributeId);
+
+                    this->components.push_back(component);
+                }
+
+                callStack.pop_back();
+
+                if (!callStack.empty())
+                {
+                    const us parent = callStack.back().first;
+
+                    lowLinks[parent] = std::min(lowLinks[parent], lowLinks[attributeId]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*! \file joinDependency.cpp
+    \brief C++ file for creating a join dependency.
+    \details Contains the function definitions for creating a join dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/JoinDependency/joinDependency.h"
+
+namespace normalizer::dependencies::join
+{
+    /* Constructors and Destructors */
+
+    JoinDependency::JoinDependency(const std::vector<attribute::AttributeSet> &inComponents) : components(inComponents)
+    {
+        if (!this->components.empty())
+        {
+            this->attributes = attribute::AttributeSet(this->components.front().getAttributeCount());
+        }
+
+        for (const attribute::AttributeSet &component : this->components)
+        {
+            this->attributes |= component;
+        }
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<attribute::AttributeSet> &JoinDependency::getComponents() const
+    {
+        return this->components;
+    }
+
+    const attribute::AttributeSet &JoinDependency::getAttributes() const
+    {
+        return this->attributes;
+    }
+
+    /* Member Functions */
+
+    bool JoinDependency::isTrivial() const
+    {
+        for (const attribute::AttributeSet &component : this->components)
+        {
+            if (component == this->attributes)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string JoinDependency::toString(const attribute::AttributeDictionary &dictionary) const
+    {
+        std::string returnValue = "JOIN: ";
+
+        for (std::size_t i = 0; i < this->components.size(); ++i)
+        {
+            if (i > 0)
+            {
+                returnValue += ", ";
+            }
+
+            returnValue += "(";
+
+            const std::vector<std::string> rowNames = dictionary.toRowNames(this->components[i]);
+
+            for (std::size_t j = 0; j < rowNames.size(); ++j)
+            {
+                returnValue += (j > 0 ? ", " : "") + rowNames[j];
+            }
+
+            returnValue += ")";
+        }
+
+        return returnValue;
+    }
+
+    /* Operator Overloads */
+
+    bool JoinDependency::operator==(const JoinDependency &other) const
+    {
+        return this->components == other.components;
+    }
+}
@@ -0,0 +1,188 @@
+/*! \file candidateKeyFinder.cpp
+    \brief C++ file for finding the candidate keys of a relation.
+    \details Contains the function definitions for enumerating the candidate keys of a relation from its functional dependencies
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Keys/candidateKeyFinder.h"
+
+namespace normalizer::dependencies::keys
+{
+    /* Constructors and Destructors */
+
+    CandidateKeyFinder::CandidateKeyFinder(closure::ClosureCache &inClosureCache) : closureCache(inClosureCache), dependencyGraph(inClosureCache.getCalculator().getDependencyStore()) {}
+
+    /* Member Functions */
+
+    std::vector<attribute::AttributeSet> CandidateKeyFinder::findCandidateKeys()
+    {
+        const us attributeCount = this->closureCache.getCalculator().getAttributeCount();
+
+        attribute::AttributeSet schema(attributeCount);
+
+        for (us attributeId = 0; attributeId < attributeCount; ++attributeId)
+        {
+            schema.addAttribute(attributeId);
+        }
+
+        return this->findCandidateKeys(schema, this->closureCache.getCalculator().getFunctionalDependencies());
+    }
+
+    std::vector<attribute::AttributeSet> CandidateKeyFinder::findCandidateKeys(const attribute::AttributeSet &relation, const std::vector<functional::FunctionalDependency> &relationDependencies)
+    {
+        const attribute::AttributeSet condensedRelation = this->condense(relation, relation);
+
+        if (condensedRelation == relation) // No attributes of the relation determine each other
+        {
+            return this->enumerateKeys(relation, relationDependencies, {this->minimizeSuperkey(relation, relation)});
+        }
+
+        std::vector<functional::FunctionalDependency> condensedDependencies;
+
+        for (const functional::FunctionalDependency &dependency : relationDependencies)
+        {
+            condensedDependencies.push_back({this->condense(dependency.getDeterminant(), relation), this->condense(dependency.getDependent() & relation, relation)});
+        }
+
+        std::vector<attribute::AttributeSet> candidateKeys;
+
+        for (const attribute::AttributeSet &condensedKey : this->enumerateKeys(condensedRelation, condensedDependencies, {this->minimizeSuperkey(condensedRelation, condensedRelation)}))
+        {
+            std::vector<attribute::AttributeSet> expandedKeys = {condensedKey};
+
+            for (us attributeId = condensedKey.findFirst(); attributeId < condensedKey.getAttributeCount(); attributeId = condensedKey.findNext(attributeId))
+            {
+                const attribute::AttributeSet members = this->dependencyGraph.getEquivalentAttributes(attributeId) & relation;
+                const std::size_t expandedCount = expandedKeys.size();
+
+                for (us member = members.findFirst(); member < members.getAttributeCount(); member = members.findNext(member))
+                {
+                    if (member == attributeId)
+                    {
+                        continue;
+                    }
+
+                    for (std::size_t i = 0; i < expandedCount; ++i) // Every key found so far, with the member in place of the attribute
+                    {
+                        attribute::AttributeSet expandedKey = expandedKeys[i];
+                        expandedKey.removeAttribute(attributeId);
+                        expandedKey.addAttribute(member);
+
+                        expandedKeys.push_back(expandedKey);
+                    }
+                }
+            }
+
+            candidateKeys.insert(candidateKeys.end(), expandedKeys.begin(), expandedKeys.end());
+        }
+
+        return candidateKeys;
+    }
+
+    std::vector<attribute::AttributeSet> CandidateKeyFinder::completeCandidateKeys(const std::vector<attribute::AttributeSet> &superkeys)
+    {
+        const us attributeCount = this->closureCache.getCalculator().getAttributeCount();
+
+        attribute::AttributeSet schema(attributeCount);
+
+        for (us attributeId = 0; attributeId < attributeCount; ++attributeId)
+        {
+            schema.addAttribute(attributeId);
+        }
+
+        std::vector<attribute::AttributeSet> candidateKeys;
+
+        for (const attribute::AttributeSet &superkey : superkeys)
+        {
+            const attribute::AttributeSet candidateKey = this->minimizeSuperkey(superkey, schema);
+
+            if (std::find(candidateKeys.begin(), candidateKeys.end(), candidateKey) == candidateKeys.end()) // Two superkeys can shrink into the same key
+            {
+                candidateKeys.push_back(candidateKey);
+            }
+        }
+
+        if (candidateKeys.empty())
+        {
+            candidateKeys.push_back(this->minimizeSuperkey(schema, schema));
+        }
+
+        return this->enumerateKeys(schema, this->closureCache.getCalculator().getFunctionalDependencies(), candidateKeys);
+    }
+
+    std::vector<attribute::AttributeSet> CandidateKeyFinder::enumerateKeys(const attribute::AttributeSet &relation, const std::vector<functional::FunctionalDependency> &relationDependencies, std::vector<attribute::AttributeSet> candidateKeys)
+    {
+        for (std::size_t i = 0; i < candidateKeys.size(); ++i) // New keys are appended, so they are expanded in turn
+        {
+            for (const functional::FunctionalDependency &dependency : relationDependencies)
+            {
+                const attribute::AttributeSet superkey = ((dependency.getDeterminant() | (candidateKeys[i] - dependency.getDependent())) & relation);
+
+                bool holdsKnownKey = false;
+
+                for (const attribute::AttributeSet &candidateKey : candidateKeys)
+                {
+                    if (candidateKey.isSubsetOf(superkey))
+                    {
+                        holdsKnownKey = true;
+                        break;
+                    }
+                }
+
+                if (!holdsKnownKey)
+                {
+                    candidateKeys.push_back(this->minimizeSuperkey(superkey, relation));
+                }
+            }
+        }
+
+        return candidateKeys;
+    }
+
+    bool CandidateKeyFinder::isSuperkey(const attribute::AttributeSet &attributes, const attribute::AttributeSet &relation)
+    {
+        return relation.isSubsetOf(this->closureCache.getClosure(attributes));
+    }
+
+    attribute::AttributeSet CandidateKeyFinder::minimizeSuperkey(const attribute::AttributeSet &superkey, const attribute::AttributeSet &relation)
+    {
+        attribute::AttributeSet key = superkey;
+
+        for (const us attributeId : superkey.getAttributes())
+        {
+            key.removeAttribute(attributeId);
+
+            if (!this->isSuperkey(key, relation)) // The attribute is needed
+            {
+                key.addAttribute(attributeId);
+            }
+        }
+
+        return key;
+    }
+
+    attribute::AttributeSet CandidateKeyFinder::condense(const attribute::AttributeSet &attributes, const attribute::AttributeSet &relation) const
+    {
+        attribute::AttributeSet condensed = attributes;
+
+        for (us attributeId = attributes.findFirst(); attributeId < attributes.getAttributeCount(); attributeId = attributes.findNext(attributeId))
+        {
+            if (!relation.containsAttribute(attributeId))
+            {
+                continue;
+            }
+
+            const us standIn = (this->dependencyGraph.getEquivalentAttributes(attributeId) & relation).findFirst();
+
+            if (standIn != attributeId)
+            {
+                condensed.removeAttribute(attributeId);
+                condensed.addAttribute(standIn);
+            }
+        }
+
+        return condensed;
+    }
+}
@@ -0,0 +1,140 @@
+/*! \file primeAttributeService.cpp
+    \brief C++ file for answering prime attribute and superkey queries.
+    \details Contains the function definitions for finding the prime attributes of a schema and testing many attribute sets for being superkeys at once
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Keys/primeAttributeService.h"
+
+namespace normalizer::dependencies::keys
+{
+    /* Constructors and Destructors */
+
+    PrimeAttributeService::PrimeAttributeService(closure::ClosureCache &inClosureCache) : PrimeAttributeService(inClosureCache, CandidateKeyFinder(inClosureCache).findCandidateKeys()) {}
+
+    PrimeAttributeService::PrimeAttributeService(closure::ClosureCache &inClosureCache, const std::vector<attribute::AttributeSet> &inCandidateKeys) : dependencyStore(inClosureCache.getCalculator().getDependencyStore()), candidateKeys(inCandidateKeys)
+    {
+        const us attributeCount = inClosureCache.getCalculator().getAttributeCount();
+
+        this->primeAttributes = attribute::AttributeSet(attributeCount);
+        this->schema = attribute::AttributeSet(attributeCount);
+
+        for (us attributeId = 0; attributeId < attributeCount; ++attributeId)
+        {
+            this->schema.addAttribute(attributeId);
+        }
+
+        for (const attribute::AttributeSet &candidateKey : this->candidateKeys)
+        {
+            this->primeAttributes |= candidateKey;
+        }
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<attribute::AttributeSet> &PrimeAttributeService::getCandidateKeys() const
+    {
+        return this->candidateKeys;
+    }
+
+    const attribute::AttributeSet &PrimeAttributeService::getPrimeAttributes() const
+    {
+        return this->primeAttributes;
+    }
+
+    /* Member Functions */
+
+    bool PrimeAttributeService::isPrime(const us attributeId) const
+    {
+        return this->primeAttributes.containsAttribute(attributeId);
+    }
+
+    std::vector<bool> PrimeAttributeService::areSuperkeys(const std::vector<attribute::AttributeSet> &queries) const
+    {
+        return this->areSuperkeys(queries, this->schema);
+    }
+
+    std::vector<bool> PrimeAttributeService::areSuperkeys(const std::vector<attribute::AttributeSet> &queries, const attribute::AttributeSet &relation) const
+    {
+        std::vector<bool> superkeys(queries.size(), false);
+
+        for (std::size_t first = 0; first < queries.size(); first += SUPERKEY_BATCH_SIZE)
+        {
+            const std::size_t count = std::min<std::size_t>(SUPERKEY_BATCH_SIZE, queries.size() - first);
+            const ul batch = this->findSuperkeyBatch(queries, first, count, relation);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                superkeys[first + i] = (batch >> i) & 1;
+            }
+        }
+
+        return superkeys;
+    }
+
+    ul PrimeAttributeService::findSuperkeyBatch(const std::vector<attribute::AttributeSet> &queries, const std::size_t first, const std::size_t count, const attribute::AttributeSet &relation) const
+    {
+        const ul activeLanes = count == SUPERKEY_BATCH_SIZE ? ~static_cast<ul>(0) : (static_cast<ul>(1) << count) - 1;
+
+        std::vector<ul> reachedBy(this->dependencyStore.getAttributeCount(), 0); // Bit i of an attribute's word is set once query first + i reaches it
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const attribute::AttributeSet &query = queries[first + i];
+
+            for (us attributeId = query.findFirst(); attributeId < query.getAttributeCount() && attributeId < reachedBy.size(); attributeId = query.findNext(attributeId))
+            {
+                reachedBy[attributeId] |= static_cast<ul>(1) << i;
+            }
+        }
+
+        const ui dependencyCount = this->dependencyStore.getDependencyCount();
+
+        bool changed = true;
+
+        while (changed)
+        {
+            changed = false;
+
+            for (ui dependencyIndex = 0; dependencyIndex < dependencyCount; ++dependencyIndex)
+            {
+                ul firing = activeLanes;
+
+                for (const us attributeId : this->dependencyStore.getDeterminant(dependencyIndex))
+                {
+                    firing &= reachedBy[attributeId];
+
+                    if (firing == 0) // No query of the batch has the whole left hand side yet
+                    {
+                        break;
+                    }
+                }
+
+                if (firing == 0)
+                {
+                    continue;
+                }
+
+                for (const us attributeId : this->dependencyStore.getDependent(dependencyIndex))
+                {
+                    if ((firing & ~reachedBy[attributeId]) != 0)
+                    {
+                        reachedBy[attributeId] |= firing;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        ul superkeys = activeLanes;
+
+        for (us attributeId = relation.findFirst(); attributeId < relation.getAttributeCount() && superkeys != 0; attributeId = relation.findNext(attributeId))
+        {
+            superkeys &= attributeId < reachedBy.size() ? reachedBy[attributeId] : 0;
+        }
+
+        return superkeys;
+    }
+}
@@ -0,0 +1,52 @@
+/*! \file multivaluedDependency.cpp
+    \brief C++ file for creating a multi valued dependency.
+    \details Contains the function definitions for creating a multi valued dependency over attribute identifiers
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+
+namespace normalizer::dependencies::multivalued
+{
+    /* Constructors and Destructors */
+
+    MultivaluedDependency::MultivaluedDependency(const attribute::AttributeSet &lhs, const attribute::AttributeSet &rhs) : determinant(lhs), dependent(rhs) {}
+
+    MultivaluedDependency::MultivaluedDependency(const MultivaluedDependency &other) : determinant(other.determinant), dependent(other.dependent) {}
+
+    /* Getters and Setters */
+
+    const attribute::AttributeSet &MultivaluedDependency::getDeterminant() const
+    {
+        return this->determinant;
+    }
+
+    const attribute::AttributeSet &MultivaluedDependency::getDependent() const
+    {
+        return this->dependent;
+    }
+
+    /* Member Functions */
+
+    std::string MultivaluedDependency::toString(const attribute::AttributeDictionary &dictionary) const
+    {
+        return dictionary.toString(this->determinant) + " ->> " + dictionary.toString(this->dependent);
+    }
+
+    /* Operator Overloads */
+
+    MultivaluedDependency &MultivaluedDependency::operator=(const MultivaluedDependency &other)
+    {
+        this->determinant = other.determinant;
+        this->dependent = other.dependent;
+
+        return *this;
+    }
+
+    bool MultivaluedDependency::operator==(const MultivaluedDependency &other) const
+    {
+        return this->determinant == other.determinant && this->dependent == other.dependent;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*! \file dependencyProjector.cpp
+    \brief C++ file for projecting functional dependencies onto a sub-schema.
+    \details Contains the function definitions for finding the functional dependencies that hold on a subset of a table's rows
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Projection/dependencyProjector.h"
+
+namespace normalizer::dependencies::projection
+{
+    /* Constructors and Destructors */
+
+    DependencyProjector::DependencyProjector(closure::ClosureCache &inClosureCache) : closureCache(inClosureCache), determinantAttributes(inClosureCache.getCalculator().getAttributeCount())
+    {
+        for (const functional::FunctionalDependency &dependency : this->closureCache.getCalculator().getFunctionalDependencies())
+        {
+            this->determinantAttributes |= dependency.getDeterminant();
+        }
+    }
+
+    /* Getters and Setters */
+
+    std::size_t DependencyProjector::getCachedClosureCount() const
+    {
+        return this->closureCache.getSize();
+    }
+
+    /* Member Functions */
+
+    std::vector<functional::FunctionalDependency> DependencyProjector::project(const attribute::AttributeSet &subSchema)
+    {
+        std::vector<functional::FunctionalDependency> projectedDependencies;
+
+        const attribute::AttributeSet candidates = subSchema & this->determinantAttributes; // An attribute that determines nothing can never add to a closure
+        const us attributeCount = this->closureCache.getCalculator().getAttributeCount();
+
+        std::vector<attribute::AttributeSet> currentLevel;
+
+        for (const us attributeId : candidates.getAttributes())
+        {
+            attribute::AttributeSet single(attributeCount);
+            single.addAttribute(attributeId);
+
+            currentLevel.push_back(single);
+        }
+
+        while (!currentLevel.empty())
+        {
+            std::vector<attribute::AttributeSet> nextLevel;
+
+            for (const attribute::AttributeSet &determinant : currentLevel)
+            {
+                if (this->hasRedundantAttribute(determinant)) // Any dependency found from here is implied by a smaller left hand side, and so is any superset
+                {
+                    continue;
+                }
+
+                const attribute::AttributeSet closure = this->getClosure(determinant) & subSchema;
+                const attribute::AttributeSet gained = closure - determinant;
+
+                if (!gained.isEmpty())
+                {
+                    projectedDependencies.push_back({determinant, gained});
+                }
+
+                if (subSchema.isSubsetOf(closure)) // A key of the sub-schema, so every superset is implied by it
+                {
+                    continue;
+                }
+
+                const std::vector<us> determinantIds = determinant.getAttributes();
+
+                for (us next = candidates.findNext(determinantIds.back()); next < candidates.getAttributeCount(); next = candidates.findNext(next))
+                {
+                    if (closure.containsAttribute(next)) // Adding an attribute already in the closure makes the set redundant
+                    {
+                        continue;
+                    }
+
+                    attribute::AttributeSet extended = determinant;
+                    extended.addAttribute(next);
+
+                    nextLevel.push_back(extended);
+                }
+            }
+
+            currentLevel = nextLevel;
+        }
+
+        return cover::MinimalCover::compute(projectedDependencies, attributeCount);
+    }
+
+    const attribute::AttributeSet &DependencyProjector::getClosure(const attribute::AttributeSet &attributes)
+    {
+        return this->closureCache.getClosure(attributes);
+    }
+
+    bool DependencyProjector::hasRedundantAttribute(const attribute::AttributeSet &attributes)
+    {
+        if (attributes.count() < 2)
+        {
+            return false;
+        }
+
+        for (const us attributeId : attributes.getAttributes())
+        {
+            attribute::AttributeSet rest = attributes;
+            rest.removeAttribute(attributeId);
+
+            if (this->getClosure(rest).containsAttribute(attributeId))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
\ No newline at end of file
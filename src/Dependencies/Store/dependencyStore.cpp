@@ -0,0 +1,173 @@
+/*! \file dependencyStore.cpp
+    \brief C++ file for creating a flat functional dependency store.
+    \details Contains the function definitions for storing functional dependencies in contiguous arrays of attribute identifiers, indexed by attribute
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Store/dependencyStore.h"
+
+namespace normalizer::dependencies::store
+{
+    /* Constructors and Destructors */
+
+    DependencyStore::DependencyStore() : determinantOffsets(1, 0), dependentOffsets(1, 0), determinantIndexOffsets(1, 0), mentionIndexOffsets(1, 0), attributeCount(0) {}
+
+    DependencyStore::DependencyStore(const std::vector<functional::FunctionalDependency> &dependencies, const us count) : determinantOffsets(1, 0), dependentOffsets(1, 0), attributeCount(count)
+    {
+        this->determinantOffsets.reserve(dependencies.size() + 1);
+        this->dependentOffsets.reserve(dependencies.size() + 1);
+
+        for (const functional::FunctionalDependency &dependency : dependencies)
+        {
+            for (const us attributeId : dependency.getDeterminant().getAttributes())
+            {
+                if (attributeId < this->attributeCount)
+                {
+                    this->determinantAttributes.push_back(attributeId);
+                }
+            }
+
+            for (const us attributeId : dependency.getDependent().getAttributes())
+            {
+                if (attributeId < this->attributeCount)
+                {
+                    this->dependentAttributes.push_back(attributeId);
+                }
+            }
+
+            this->determinantOffsets.push_back(static_cast<ui>(this->determinantAttributes.size()));
+            this->dependentOffsets.push_back(static_cast<ui>(this->dependentAttributes.size()));
+        }
+
+        this->buildIndexes();
+    }
+
+    /* Getters and Setters */
+
+    us DependencyStore::getAttributeCount() const
+    {
+        return this->attributeCount;
+    }
+
+    ui DependencyStore::getDependencyCount() const
+    {
+        return static_cast<ui>(this->determinantOffsets.size() - 1);
+    }
+
+    std::span<const us> DependencyStore::getDeterminant(const ui index) const
+    {
+        return std::span<const us>(this->determinantAttributes.data() + this->determinantOffsets[index], this->determinantOffsets[index + 1] - this->determinantOffsets[index]);
+    }
+
+    std::span<const us> DependencyStore::getDependent(const ui index) const
+    {
+        return std::span<const us>(this->dependentAttributes.data() + this->dependentOffsets[index], this->dependentOffsets[index + 1] - this->dependentOffsets[index]);
+    }
+
+    std::span<const ui> DependencyStore::getDependenciesWithDeterminant(const us attributeId) const
+    {
+        return std::span<const ui>(this->determinantIndex.data() + this->determinantIndexOffsets[attributeId], this->determinantIndexOffsets[attributeId + 1] - this->determinantIndexOffsets[attributeId]);
+    }
+
+    std::span<const ui> DependencyStore::getDependenciesMentioning(const us attributeId) const
+    {
+        return std::span<const ui>(this->mentionIndex.data() + this->mentionIndexOffsets[attributeId], this->mentionIndexOffsets[attributeId + 1] - this->mentionIndexOffsets[attributeId]);
+    }
+
+    std::span<const ui> DependencyStore::getDependenciesWithEmptyDeterminant() const
+    {
+        return std::span<const ui>(this->emptyDeterminantIndex.data(), this->emptyDeterminantIndex.size());
+    }
+
+    /* Member Functions */
+
+    functional::FunctionalDependency DependencyStore::toFunctionalDependency(const ui index) const
+    {
+        attribute::AttributeSet determinant(this->attributeCount);
+        attribute::AttributeSet dependent(this->attributeCount);
+
+        for (const us attributeId : this->getDeterminant(index))
+        {
+            determinant.addAttribute(attributeId);
+        }
+
+        for (const us attributeId : this->getDependent(index))
+        {
+            dependent.addAttribute(attributeId);
+        }
+
+        return {determinant, dependent};
+    }
+
+    void DependencyStore::buildIndexes()
+    {
+        const ui dependencyCount = this->getDependencyCount();
+
+        std::vector<ui> lastMention(this->attributeCount, 0); // One past the last dependency counted for each attribute, so an attribute on both sides is only counted once
+
+        this->determinantIndexOffsets.assign(this->attributeCount + 1U, 0);
+        this->mentionIndexOffsets.assign(this->attributeCount + 1U, 0);
+
+        for (ui i = 0; i < dependencyCount; ++i) // Count the entries of each attribute
+        {
+            for (const us attributeId : this->getDeterminant(i))
+            {
+                ++this->determinantIndexOffsets[attributeId + 1U];
+
+                lastMention[attributeId] = i + 1;
+                ++this->mentionIndexOffsets[attributeId + 1U];
+            }
+
+            for (const us attributeId : this->getDependent(i))
+            {
+                if (lastMention[attributeId] != i + 1)
+                {
+                    lastMention[attributeId] = i + 1;
+                    ++this->mentionIndexOffsets[attributeId + 1U];
+                }
+            }
+        }
+
+        for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId) // Turn the counts into offsets
+        {
+            this->determinantIndexOffsets[attributeId + 1U] += this->determinantIndexOffsets[attributeId];
+            this->mentionIndexOffsets[attributeId + 1U] += this->mentionIndexOffsets[attributeId];
+        }
+
+        this->determinantIndex.resize(this->determinantIndexOffsets.back());
+        this->mentionIndex.resize(this->mentionIndexOffsets.back());
+
+        std::vector<ui> determinantCursors(this->determinantIndexOffsets.begin(), this->determinantIndexOffsets.end() - 1);
+        std::vector<ui> mentionCursors(this->mentionIndexOffsets.begin(), this->mentionIndexOffsets.end() - 1);
+
+        lastMention.assign(this->attributeCount, 0);
+        this->emptyDeterminantIndex.clear();
+
+        for (ui i = 0; i < dependencyCount; ++i) // Fill in the entries in dependency order, so each attribute's entries are ascending
+        {
+            if (this->getDeterminant(i).empty())
+            {
+                this->emptyDeterminantIndex.push_back(i);
+            }
+
+            for (const us attributeId : this->getDeterminant(i))
+            {
+                this->determinantIndex[determinantCursors[attributeId]++] = i;
+
+                lastMention[attributeId] = i + 1;
+                this->mentionIndex[mentionCursors[attributeId]++] = i;
+            }
+
+            for (const us attributeId : this->getDependent(i))
+            {
+                if (lastMention[attributeId] != i + 1)
+                {
+                    lastMention[attributeId] = i + 1;
+                    this->mentionIndex[mentionCursors[attributeId]++] = i;
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
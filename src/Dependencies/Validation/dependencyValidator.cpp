@@ -0,0 +1,189 @@
+/*! \file dependencyValidator.cpp
+    \brief C++ file for checking declared functional dependencies against the rows of a table.
+    \details Contains the function definitions for finding the functional dependencies of a dependency file that the rows of a table break, with a pair of rows that shows it
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Validation/dependencyValidator.h"
+
+namespace normalizer::dependencies::validation
+{
+    /* Constructors and Destructors */
+
+    DependencyValidator::DependencyValidator(const table::instance::TableInstance &inInstance, const attribute::AttributeDictionary &dictionary) : instance(inInstance)
+    {
+        const std::vector<std::string> &columnNames = this->instance.getColumnNames();
+
+        for (us attribute = 0; attribute < dictionary.getAttributeCount(); ++attribute)
+        {
+            const std::string name = dictionary.getAttributeName(attribute);
+            const auto found = std::find(columnNames.begin(), columnNames.end(), name);
+
+            if (found == columnNames.end())
+            {
+                throw std::invalid_argument(table::MISSING_DATA_COLUMN + name);
+            }
+
+            this->columns.push_back(static_cast<us>(found - columnNames.begin()));
+        }
+    }
+
+    /* Getters and Setters */
+
+    us DependencyValidator::getColumn(const us attribute) const
+    {
+        return this->columns[attribute];
+    }
+
+    /* Member Functions */
+
+    std::vector<DependencyViolation> DependencyValidator::validate(const std::vector<functional::FunctionalDependency> &dependencies) const
+    {
+        std::vector<attribute::AttributeSet> determinants;
+        std::vector<std::vector<std::size_t>> determinantDependencies;
+        std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> determinantIndices;
+
+        for (std::size_t i = 0; i < dependencies.size(); ++i)
+        {
+            const auto inserted = determinantIndices.emplace(dependencies[i].getDeterminant(), determinants.size());
+
+            if (inserted.second)
+            {
+                determinants.push_back(dependencies[i].getDeterminant());
+                determinantDependencies.emplace_back();
+            }
+
+            determinantDependencies[inserted.first->second].push_back(i);
+        }
+
+        std::vector<ul> groupCounts(dependencies.size(), 0);
+        std::vector<std::pair<ui, ui>> rowPairs(dependencies.size(), {0, 0});
+
+        parallel::ParallelRunner::run(determinants.size(), 1, [this, &dependencies, &determinants, &determinantDependencies, &groupCounts, &rowPairs](const std::size_t begin, const std::size_t end)
+                                      {
+                                          const ui noRow = std::numeric_limits<ui>::max();
+
+                                          std::vector<ui> firstRows;
+                                          std::vector<char> broken;
+
+                                          for (std::size_t determinant = begin; determinant < end; ++determinant)
+                                          {
+                                              ui groupCount = 0;
+                                              const std::vector<ui> groups = this->groupRows(determinants[determinant], groupCount);
+
+                                              for (const std::size_t dependency : determinantDependencies[determinant])
+                                              {
+                                                  std::vector<const std::vector<ui> *> dependentColumns;
+                                                  const attribute::AttributeSet &dependent = dependencies[dependency].getDependent();
+
+                                                  for (us attribute = dependent.findFirst(); attribute < dependent.getAttributeCount(); attribute = dependent.findNext(attribute))
+                                                  {
+                                                      dependentColumns.push_back(&this->instance.getColumn(this->columns[attribute]));
+                                                  }
+
+                                                  firstRows.assign(groupCount, noRow);
+                                                  broken.assign(groupCount, 0);
+
+                                                  for (ui row = 0; row < groups.size(); ++row)
+                                                  {
+                                                      const ui group = groups[row];
+
+                                                      if (firstRows[group] == noRow)
+                                                      {
+                                                          firstRows[group] = row;
+                                                          continue;
+                                                      }
+
+                                                      if (broken[group])
+                                                      {
+                                                          continue;
+                                                      }
+
+                                                      const ui firstRow = firstRows[group];
+                                                      const bool agrees = std::all_of(dependentColumns.begin(), dependentColumns.end(), [firstRow, row](const std::vector<ui> *column)
+                                                                                      { return (*column)[firstRow] == (*column)[row]; });
+
+                                                      if (agrees)
+                                                      {
+                                                          continue;
+                                                      }
+
+                                                      broken[group] = 1;
+
+                                                      if (groupCounts[dependency]++ == 0) // The first rows that break the dependency show it
+                                                      {
+                                                          rowPairs[dependency] = {firstRow, row};
+                                                      }
+                                                  }
+                                              }
+                                          } });
+
+        std::vector<DependencyViolation> violations;
+
+        for (std::size_t i = 0; i < dependencies.size(); ++i)
+        {
+            if (groupCounts[i] == 0)
+            {
+                continue;
+            }
+
+            std::vector<std::string> firstValues;
+            std::vector<std::string> secondValues;
+
+            for (const us attribute : (dependencies[i].getDeterminant() | dependencies[i].getDependent()).getAttributes())
+            {
+                firstValues.push_back(this->instance.getValue(rowPairs[i].first, this->columns[attribute]));
+                secondValues.push_back(this->instance.getValue(rowPairs[i].second, this->columns[attribute]));
+            }
+
+            violations.push_back({dependencies[i], groupCounts[i], rowPairs[i].first, rowPairs[i].second, firstValues, secondValues});
+        }
+
+        return violations;
+    }
+
+    ui DependencyValidator::countGroups(const attribute::AttributeSet &determinant) const
+    {
+        ui groupCount = 0;
+        this->groupRows(determinant, groupCount);
+
+        return groupCount;
+    }
+
+    std::vector<ui> DependencyValidator::groupRows(const attribute::AttributeSet &determinant, ui &groupCount) const
+    {
+        const ui rowCount = this->instance.getRowCount();
+
+        std::vector<ui> groups(rowCount, 0);
+        groupCount = rowCount > 0 ? 1 : 0; // With no determinant, every row is in one group
+
+        us attribute = determinant.findFirst();
+
+        if (attribute < determinant.getAttributeCount()) // The value identifiers of a column already number its groups densely
+        {
+            groups = this->instance.getColumn(this->columns[attribute]);
+            groupCount = this->instance.getDistinctCount(this->columns[attribute]);
+            attribute = determinant.findNext(attribute);
+        }
+
+        for (; attribute < determinant.getAttributeCount(); attribute = determinant.findNext(attribute))
+        {
+            const std::vector<ui> &values = this->instance.getColumn(this->columns[attribute]);
+            const ul distinctCount = this->instance.getDistinctCount(this->columns[attribute]);
+
+            std::unordered_map<ul, ui> combined;
+            combined.reserve(std::min<ul>(static_cast<ul>(groupCount) * distinctCount, rowCount));
+
+            for (ui row = 0; row < rowCount; ++row)
+            {
+                groups[row] = combined.emplace(groups[row] * distinctCount + values[row], static_cast<ui>(combined.size())).first->second;
+            }
+
+            groupCount = static_cast<ui>(combined.size());
+        }
+
+        return groups;
+    }
+}
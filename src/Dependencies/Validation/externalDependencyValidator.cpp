@@ -0,0 +1,111 @@
+/*! \file externalDependencyValidator.cpp
+    \brief C++ file for checking declared functional dependencies against the rows of a CSV data file larger than memory.
+    \details Contains the function definitions for finding the functional dependencies that the rows of a CSV data file break, one partition of the rows at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Validation/externalDependencyValidator.h"
+
+namespace normalizer::dependencies::validation
+{
+    /* Member Functions */
+
+    std::vector<DependencyViolation> ExternalDependencyValidator::validate(const std::vector<functional::FunctionalDependency> &dependencies) const
+    {
+        std::vector<attribute::AttributeSet> determinants;
+        std::vector<std::vector<std::size_t>> determinantDependencies;
+        std::unordered_map<attribute::AttributeSet, std::size_t, attribute::AttributeSetHash> determinantIndices;
+
+        for (std::size_t i = 0; i < dependencies.size(); ++i)
+        {
+            const auto inserted = determinantIndices.emplace(dependencies[i].getDeterminant(), determinants.size());
+
+            if (inserted.second)
+            {
+                determinants.push_back(dependencies[i].getDeterminant());
+                determinantDependencies.emplace_back();
+            }
+
+            determinantDependencies[inserted.first->second].push_back(i);
+        }
+
+        std::vector<DependencyViolation> found;
+
+        for (const functional::FunctionalDependency &dependency : dependencies)
+        {
+            found.push_back({dependency, 0, 0, 0, {}, {}});
+        }
+
+        for (std::size_t determinant = 0; determinant < determinants.size(); ++determinant)
+        {
+            attribute::AttributeSet attributes = determinants[determinant];
+
+            for (const std::size_t dependency : determinantDependencies[determinant])
+            {
+                attributes |= dependencies[dependency].getDependent();
+            }
+
+            const std::vector<std::string> columnNames = this->dictionary.toRowNames(attributes);
+
+            attribute::AttributeDictionary partitionDictionary; // Over only the columns read, in the same order as the full dictionary
+            std::vector<us> keyColumns;
+
+            for (us column = 0; column < columnNames.size(); ++column)
+            {
+                partitionDictionary.addAttribute(columnNames[column]);
+
+                if (determinants[determinant].containsAttribute(this->dictionary.getAttributeId(columnNames[column])))
+                {
+                    keyColumns.push_back(column);
+                }
+            }
+
+            std::vector<functional::FunctionalDependency> partitionDependencies;
+
+            for (const std::size_t dependency : determinantDependencies[determinant])
+            {
+                partitionDependencies.push_back({partitionDictionary.toAttributeSet(this->dictionary.toRowNames(dependencies[dependency].getDeterminant())), partitionDictionary.toAttributeSet(this->dictionary.toRowNames(dependencies[dependency].getDependent()))});
+            }
+
+            this->partitioner.forEachPartition(columnNames, keyColumns, [&determinantDependencies, determinant, &partitionDictionary, &partitionDependencies, &found](const table::instance::TableInstance &instance, const std::vector<ul> &rows)
+                                               {
+                                                   const DependencyValidator validator(instance, partitionDictionary);
+
+                                                   std::size_t next = 0;
+
+                                                   for (const DependencyViolation &violation : validator.validate(partitionDependencies))
+                                                   {
+                                                       while (!(partitionDependencies[next] == violation.dependency)) // The violations come in the order of the dependencies
+                                                       {
+                                                           ++next;
+                                                       }
+
+                                                       DependencyViolation &merged = found[determinantDependencies[determinant][next++]];
+
+                                                       merged.groupCount += violation.groupCount;
+
+                                                       if (merged.groupCount == violation.groupCount || rows[violation.secondRow] < merged.secondRow) // A check of every row at once stops at the first row that breaks the dependency
+                                                       {
+                                                           merged.firstRow = rows[violation.firstRow];
+                                                           merged.secondRow = rows[violation.secondRow];
+                                                           merged.firstValues = violation.firstValues;
+                                                           merged.secondValues = violation.secondValues;
+                                                       }
+                                                   } });
+        }
+
+        std::vector<DependencyViolation> violations;
+
+        for (DependencyViolation &violation : found)
+        {
+            if (violation.groupCount > 0)
+            {
+                violations.push_back(std::move(violation));
+            }
+        }
+
+        return violations;
+    }
+}
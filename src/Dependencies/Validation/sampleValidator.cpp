@@ -0,0 +1,92 @@
+/*! \file sampleValidator.cpp
+    \brief C++ file for checking functional dependencies against a uniform sample of the rows of a table.
+    \details Contains the function definitions for finding the functional dependencies that a sample of rows breaks, and bounding how often the rest of the rows could break the ones it does not
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/Validation/sampleValidator.h"
+
+namespace normalizer::dependencies::validation
+{
+    /* Member Functions */
+
+    std::vector<DependencyEstimate> SampleValidator::estimate(const std::vector<functional::FunctionalDependency> &dependencies, const std::size_t keyCount) const
+    {
+        const std::vector<DependencyViolation> violations = this->validator.validate(dependencies);
+
+        std::unordered_map<attribute::AttributeSet, ui, attribute::AttributeSetHash> groupCounts;
+        std::vector<DependencyEstimate> estimates;
+        std::size_t next = 0;
+
+        for (std::size_t i = 0; i < dependencies.size(); ++i)
+        {
+            const functional::FunctionalDependency &dependency = dependencies[i];
+
+            auto groupCount = groupCounts.find(dependency.getDeterminant());
+
+            if (groupCount == groupCounts.end())
+            {
+                groupCount = groupCounts.emplace(dependency.getDeterminant(), this->validator.countGroups(dependency.getDeterminant())).first;
+            }
+
+            DependencyEstimate estimate = {{dependency, 0, 0, 0, {}, {}}, this->sampleCount - groupCount->second, 0, 0};
+
+            if (next < violations.size() && violations[next].dependency == dependency) // The violations come in the order of the dependencies
+            {
+                estimate.violation = violations[next++];
+                estimate.violation.firstRow = this->rowNumbers[estimate.violation.firstRow];
+                estimate.violation.secondRow = this->rowNumbers[estimate.violation.secondRow];
+            }
+            else
+            {
+                estimate.brokenShareBound = this->boundBrokenShare(estimate.repeatedRows);
+
+                if (i >= dependencies.size() - keyCount) // Only a key is broken by single pairs of rows
+                {
+                    estimate.brokenPairBound = this->boundBrokenPairs();
+                }
+            }
+
+            estimates.push_back(std::move(estimate));
+        }
+
+        return estimates;
+    }
+
+    double SampleValidator::boundBrokenShare(const ul repeatedRows) const
+    {
+        if (this->sampleCount >= this->rowCount)
+        {
+            return 0;
+        }
+
+        if (repeatedRows == 0)
+        {
+            return 1;
+        }
+
+        return 1 - std::pow(1 - SAMPLE_CONFIDENCE, 1 / static_cast<double>(repeatedRows));
+    }
+
+    ul SampleValidator::boundBrokenPairs() const
+    {
+        if (this->sampleCount >= this->rowCount)
+        {
+            return 0;
+        }
+
+        const double sampled = static_cast<double>(this->sampleCount);
+        const double rows = static_cast<double>(this->rowCount);
+        const double pairCount = rows * (rows - 1) / 2;
+        const double pairShare = sampled * (sampled - 1) / (rows * (rows - 1)); // The chance that a pair of rows is in the sample
+
+        if (pairShare <= 0)
+        {
+            return static_cast<ul>(pairCount);
+        }
+
+        return static_cast<ul>(std::min(std::ceil(std::log(1 - SAMPLE_CONFIDENCE) / std::log1p(-pairShare)), pairCount));
+    }
+}
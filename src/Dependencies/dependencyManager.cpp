@@ -12,15 +12,85 @@ namespace normalizer::dependencies
 {
     /* Getters and Setters */
 
-    std::vector<row::DependencyRow> DependencyManager::getDependencyRows() const
+    const std::vector<row::DependencyRow> &DependencyManager::getDependencyRows() const
     {
         return this->dependencyRows;
     }
 
+    const std::vector<std::vector<std::vector<std::string>>> &DependencyManager::getJoinDependencyRows() const
+    {
+        return this->joinDependencyRows;
+    }
+
     /* Member Functions */
 
     void DependencyManager::addDependency(const row::DependencyRow &row)
     {
         this->dependencyRows.push_back(row);
     }
+
+    void DependencyManager::addJoinDependency(const std::vector<std::vector<std::string>> &components)
+    {
+        this->joinDependencyRows.push_back(components);
+    }
+
+    std::vector<functional::FunctionalDependency> DependencyManager::getFunctionalDependencies(const attribute::AttributeDictionary &dictionary) const
+    {
+        std::vector<functional::FunctionalDependency> functionalDependencies;
+
+        for (const row::DependencyRow &row : this->dependencyRows)
+        {
+            if (row.getSingleDependencies().size() == 0)
+            {
+                continue;
+            }
+
+            attribute::AttributeSet determinant = dictionary.createEmptySet();
+            determinant.addAttribute(dictionary.getAttributeId(row.getRowName()));
+
+            functionalDependencies.push_back({determinant, dictionary.toAttributeSet(row.getSingleDependencies())});
+        }
+
+        return functionalDependencies;
+    }
+
+    std::vector<multivalued::MultivaluedDependency> DependencyManager::getMultivaluedDependencies(const attribute::AttributeDictionary &dictionary) const
+    {
+        std::vector<multivalued::MultivaluedDependency> multivaluedDependencies;
+
+        for (const row::DependencyRow &row : this->dependencyRows)
+        {
+            attribute::AttributeSet determinant = dictionary.createEmptySet();
+            determinant.addAttribute(dictionary.getAttributeId(row.getRowName()));
+
+            for (const std::string &multiValued : row.getMultiDependencies())
+            {
+                attribute::AttributeSet dependent = dictionary.createEmptySet();
+                dependent.addAttribute(dictionary.getAttributeId(multiValued));
+
+                multivaluedDependencies.push_back({determinant, dependent});
+            }
+        }
+
+        return multivaluedDependencies;
+    }
+
+    std::vector<join::JoinDependency> DependencyManager::getJoinDependencies(const attribute::AttributeDictionary &dictionary) const
+    {
+        std::vector<join::JoinDependency> joinDependencies;
+
+        for (const std::vector<std::vector<std::string>> &componentRows : this->joinDependencyRows)
+        {
+            std::vector<attribute::AttributeSet> components;
+
+            for (const std::vector<std::string> &rowNames : componentRows)
+            {
+                components.push_back(dictionary.toAttributeSet(rowNames));
+            }
+
+            joinDependencies.push_back(join::JoinDependency(components));
+        }
+
+        return joinDependencies;
+    }
 }
\ No newline at end of file
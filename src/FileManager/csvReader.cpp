@@ -0,0 +1,419 @@
+/*! \file csvReader.cpp
+    \brief C++ file for reading the rows of a CSV data file.
+    \details Contains the function definitions for reading a CSV file with a header row into the rows of data of a table
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "FileManager/csvReader.h"
+
+namespace normalizer::file
+{
+    /* Getters and Setters */
+
+    std::string CsvReader::getPath() const
+    {
+        return this->fileManager.getFOrdPath();
+    }
+
+    /* Member Functions */
+
+    table::instance::TableInstance CsvReader::read() const
+    {
+        std::size_t length = 0;
+        const char *data = this->mapFile(length);
+
+        if (data == nullptr) // Nothing to map, and no header row
+        {
+            return table::instance::TableInstance();
+        }
+
+        madvise(const_cast<char *>(data), length, MADV_SEQUENTIAL); // Each thread reads its chunk front to back
+
+        try
+        {
+            table::instance::TableInstance instance = CsvReader::parseText(data, length, CSV_CHUNK_BYTES);
+
+            munmap(const_cast<char *>(data), length);
+
+            return instance;
+        }
+        catch (...)
+        {
+            munmap(const_cast<char *>(data), length);
+            throw;
+        }
+    }
+
+    table::instance::TableInstance CsvReader::read(const table::Table &table) const
+    {
+        std::vector<std::string> names;
+
+        for (const table::row::TableRow &row : table.getTableRows())
+        {
+            names.push_back(row.getRowName());
+        }
+
+        return this->read().selectColumns(names);
+    }
+
+    std::vector<std::string> CsvReader::readColumnNames() const
+    {
+        std::size_t length = 0;
+        const char *data = this->mapFile(length);
+
+        std::vector<std::string> columnNames;
+
+        if (data != nullptr)
+        {
+            CsvReader::readRow(data, 0, length, columnNames);
+            munmap(const_cast<char *>(data), length);
+        }
+
+        return columnNames;
+    }
+
+    void CsvReader::scan(const std::size_t chunksPerWindow, const std::function<void(std::size_t, const std::vector<std::string> &)> &visitRow, const std::function<void(std::size_t)> &endWindow) const
+    {
+        std::size_t length = 0;
+        const char *data = this->mapFile(length);
+
+        if (data == nullptr)
+        {
+            return;
+        }
+
+        madvise(const_cast<char *>(data), length, MADV_SEQUENTIAL);
+
+        try
+        {
+            std::vector<std::string> columnNames;
+            std::size_t position = CsvReader::readRow(data, 0, length, columnNames);
+            std::size_t releasedBytes = 0;
+
+            const std::size_t columnCount = columnNames.size();
+            const std::size_t windowBytes = std::max<std::size_t>(chunksPerWindow, 1) * CSV_CHUNK_BYTES;
+            const std::size_t pageBytes = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+            while (columnCount > 0 && position < length)
+            {
+                const std::vector<std::size_t> chunkStarts = CsvReader::splitChunks(data, position, std::min(position + windowBytes, length), length, CSV_CHUNK_BYTES);
+                const std::size_t chunkCount = chunkStarts.size() - 1;
+
+                parallel::ParallelRunner::run(chunkCount, 1, [data, columnCount, &chunkStarts, &visitRow](const std::size_t begin, const std::size_t end)
+                                              {
+                                                  std::vector<std::string> values;
+
+                                                  for (std::size_t chunk = begin; chunk < end; ++chunk)
+                                                  {
+                                                      for (std::size_t rowStart = chunkStarts[chunk]; rowStart < chunkStarts[chunk + 1];)
+                                                      {
+                                                          rowStart = CsvReader::readRow(data, rowStart, chunkStarts[chunk + 1], values);
+
+                                                          if (values.empty())
+                                                          {
+                                                              continue;
+                                                          }
+
+                                                          if (values.size() != columnCount)
+                                                          {
+                                                              throw std::invalid_argument(table::ROW_WIDTH_MISMATCH);
+                                                          }
+
+                                                          visitRow(chunk, values);
+                                                      }
+                                                  } }); // A row of the wrong width stops its thread, and the one of the earliest chunk is rethrown
+
+                endWindow(chunkCount);
+
+                position = chunkStarts[chunkCount];
+
+                const std::size_t releaseEnd = position / pageBytes * pageBytes;
+
+                if (releaseEnd > releasedBytes) // The pages of the file stay counted against the process until released
+                {
+                    madvise(const_cast<char *>(data) + releasedBytes, releaseEnd - releasedBytes, MADV_DONTNEED);
+                    releasedBytes = releaseEnd;
+                }
+            }
+
+            munmap(const_cast<char *>(data), length);
+        }
+        catch (...)
+        {
+            munmap(const_cast<char *>(data), length);
+            throw;
+        }
+    }
+
+    table::instance::TableInstance CsvReader::parse(const std::string &contents, const std::size_t chunkBytes)
+    {
+        return CsvReader::parseText(contents.data(), contents.length(), chunkBytes);
+    }
+
+    table::instance::TableInstance CsvReader::parseText(const char *data, const std::size_t length, const std::size_t chunkBytes)
+    {
+        std::vector<std::string> columnNames;
+        const std::size_t bodyStart = CsvReader::readRow(data, 0, length, columnNames);
+
+        if (columnNames.empty())
+        {
+            return table::instance::TableInstance();
+        }
+
+        const std::size_t columnCount = columnNames.size();
+        const std::vector<std::size_t> chunkStarts = CsvReader::splitChunks(data, bodyStart, length, length, chunkBytes);
+        const std::size_t chunkCount = chunkStarts.size() - 1;
+
+        std::vector<ParsedChunk> chunks(chunkCount);
+
+        parallel::ParallelRunner::run(chunkCount, 1, [data, columnCount, &chunkStarts, &chunks](const std::size_t begin, const std::size_t end)
+                                      {
+                                          std::vector<std::string> values;
+
+                                          for (std::size_t chunk = begin; chunk < end; ++chunk)
+                                          {
+                                              ParsedChunk &parsed = chunks[chunk];
+                                              std::vector<std::unordered_map<std::string, ui>> valueIds(columnCount);
+
+                                              parsed.columns.assign(columnCount, {});
+                                              parsed.columnValues.assign(columnCount, {});
+
+                                              for (std::size_t position = chunkStarts[chunk]; position < chunkStarts[chunk + 1];)
+                                              {
+                                                  position = CsvReader::readRow(data, position, chunkStarts[chunk + 1], values);
+
+                                                  if (values.empty()) // Only blank lines were left
+                                                  {
+                                                      continue;
+                                                  }
+
+                                                  if (values.size() != columnCount)
+                                                  {
+                                                      throw std::invalid_argument(table::ROW_WIDTH_MISMATCH);
+                                                  }
+
+                                                  for (std::size_t column = 0; column < columnCount; ++column)
+                                                  {
+                                                      const auto inserted = valueIds[column].emplace(values[column], static_cast<ui>(parsed.columnValues[column].size()));
+
+                                                      if (inserted.second) // First row of the chunk with this value
+                                                      {
+                                                          parsed.columnValues[column].push_back(values[column]);
+                                                      }
+
+                                                      parsed.columns[column].push_back(inserted.first->second);
+                                                  }
+                                              }
+                                          } });
+
+        std::size_t rowCount = 0;
+
+        for (const ParsedChunk &parsed : chunks)
+        {
+            rowCount += parsed.columns[0].size();
+        }
+
+        std::vector<std::vector<ui>> columns(columnCount);
+        std::vector<std::vector<std::string>> columnValues(columnCount);
+
+        parallel::ParallelRunner::run(columnCount, 1, [rowCount, &chunks, &columns, &columnValues](const std::size_t begin, const std::size_t end)
+                                      {
+                                          for (std::size_t column = begin; column < end; ++column)
+                                          {
+                                              std::unordered_map<std::string, ui> valueIds;
+                                              std::size_t chunkValueCount = 0;
+
+                                              for (const ParsedChunk &parsed : chunks)
+                                              {
+                                                  chunkValueCount += parsed.columnValues[column].size();
+                                              }
+
+                                              valueIds.reserve(chunkValueCount); // At most the values of every chunk, so the merge never rehashes
+                                              columns[column].reserve(rowCount);
+
+                                              for (const ParsedChunk &parsed : chunks) // Merging the chunks in order keeps every identifier in the order its value first appears
+                                              {
+                                                  const std::vector<std::string> &chunkValues = parsed.columnValues[column];
+                                                  std::vector<ui> globalIds(chunkValues.size(), 0);
+
+                                                  for (std::size_t id = 0; id < chunkValues.size(); ++id)
+                                                  {
+                                                      const auto inserted = valueIds.emplace(chunkValues[id], static_cast<ui>(columnValues[column].size()));
+
+                                                      if (inserted.second)
+                                                      {
+                                                          columnValues[column].push_back(chunkValues[id]);
+                                                      }
+
+                                                      globalIds[id] = inserted.first->second;
+                                                  }
+
+                                                  for (const ui id : parsed.columns[column])
+                                                  {
+                                                      columns[column].push_back(globalIds[id]);
+                                                  }
+                                              }
+                                          } });
+
+        return table::instance::TableInstance(columnNames, std::move(columns), std::move(columnValues));
+    }
+
+    const char *CsvReader::mapFile(std::size_t &length) const
+    {
+        const std::string path = this->getPath();
+        const int descriptor = open(path.c_str(), O_RDONLY);
+
+        if (descriptor < 0)
+        {
+            throw std::filesystem::filesystem_error(FILE_DID_NOT_OPEN, path, std::error_code(errno, std::generic_category()));
+        }
+
+        struct stat status;
+
+        if (fstat(descriptor, &status) != 0)
+        {
+            const int error = errno;
+
+            close(descriptor);
+            throw std::filesystem::filesystem_error(FILE_DID_NOT_OPEN, path, std::error_code(error, std::generic_category()));
+        }
+
+        length = static_cast<std::size_t>(status.st_size);
+
+        if (length == 0)
+        {
+            close(descriptor);
+            return nullptr;
+        }
+
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        const int error = errno;
+
+        close(descriptor); // The mapping outlives the descriptor
+
+        if (mapping == MAP_FAILED)
+        {
+            throw std::filesystem::filesystem_error(FILE_DID_NOT_OPEN, path, std::error_code(error, std::generic_category()));
+        }
+
+        return static_cast<const char *>(mapping);
+    }
+
+    std::vector<std::size_t> CsvReader::splitChunks(const char *data, const std::size_t begin, const std::size_t end, const std::size_t length, const std::size_t chunkBytes)
+    {
+        const std::size_t chunkSize = std::max<std::size_t>(chunkBytes, 1);
+        const std::size_t chunkCount = std::max<std::size_t>((end - begin + chunkSize - 1) / chunkSize, 1);
+
+        std::vector<std::size_t> chunkStarts(chunkCount + 1, end);
+
+        for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            chunkStarts[chunk] = std::min(begin + chunk * chunkSize, end);
+        }
+
+        std::vector<char> oddQuotes(chunkCount, 0);
+
+        parallel::ParallelRunner::run(chunkCount, 1, [data, &chunkStarts, &oddQuotes](const std::size_t first, const std::size_t last)
+                                      {
+                                          for (std::size_t chunk = first; chunk < last; ++chunk)
+                                          {
+                                              oddQuotes[chunk] = std::count(data + chunkStarts[chunk], data + chunkStarts[chunk + 1], CSV_QUOTE) % 2 != 0;
+                                          } });
+
+        bool inQuotes = false; // The first chunk starts a row
+
+        for (std::size_t chunk = 1; chunk <= chunkCount; ++chunk) // The end of the last chunk moves too, unless it is the end of the text
+        {
+            inQuotes = inQuotes != static_cast<bool>(oddQuotes[chunk - 1]);
+            chunkStarts[chunk] = CsvReader::findRowStart(data, chunkStarts[chunk], length, inQuotes);
+        }
+
+        return chunkStarts;
+    }
+
+    std::size_t CsvReader::readRow(const char *data, std::size_t position, const std::size_t end, std::vector<std::string> &values)
+    {
+        std::string value;
+        bool inQuotes = false;
+        bool rowHasText = false;
+
+        values.clear();
+
+        for (; position < end; ++position)
+        {
+            const char character = data[position];
+
+            if (inQuotes)
+            {
+                if (character != CSV_QUOTE)
+                {
+                    value += character;
+                }
+                else if (position + 1 < end && data[position + 1] == CSV_QUOTE) // A quote written twice is part of the value
+                {
+                    value += CSV_QUOTE;
+                    ++position;
+                }
+                else
+                {
+                    inQuotes = false;
+                }
+
+                continue;
+            }
+
+            switch (character)
+            {
+            case CSV_QUOTE:
+                inQuotes = true;
+                rowHasText = true;
+                break;
+            case CSV_SEPARATOR:
+                values.push_back(value);
+                value.clear();
+                rowHasText = true;
+                break;
+            case '\n':
+                if (rowHasText) // Blank lines hold no row
+                {
+                    values.push_back(value);
+                    return position + 1;
+                }
+
+                break;
+            case '\r': // Line breaks written as \r\n
+                break;
+            default:
+                value += character;
+                rowHasText = true;
+                break;
+            }
+        }
+
+        if (rowHasText)
+        {
+            values.push_back(value);
+        }
+
+        return position;
+    }
+
+    std::size_t CsvReader::findRowStart(const char *data, std::size_t position, const std::size_t end, bool inQuotes)
+    {
+        for (; position < end; ++position)
+        {
+            if (data[position] == CSV_QUOTE)
+            {
+                inQuotes = !inQuotes;
+            }
+            else if (data[position] == '\n' && !inQuotes)
+            {
+                return position + 1;
+            }
+        }
+
+        return end;
+    }
+}
@@ -0,0 +1,52 @@
+/*! \file temporaryDirectory.cpp
+    \brief C++ file for creating a temporary directory.
+    \details Contains the function definitions for creating a uniquely named directory that is removed along with everything in it once it is no longer needed
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "FileManager/temporaryDirectory.h"
+
+namespace normalizer::file
+{
+    /* Constructors and Destructors */
+
+    TemporaryDirectory::TemporaryDirectory(const std::string &parentPath)
+    {
+        const FileManager parentManager(parentPath, true);
+
+        const std::string name = (std::filesystem::path(parentManager.getFOrdPath()) / TEMPORARY_DIRECTORY_TEMPLATE).string();
+        std::vector<char> buffer(name.begin(), name.end());
+
+        buffer.push_back('\0');
+
+        if (mkdtemp(buffer.data()) == nullptr)
+        {
+            throw std::filesystem::filesystem_error(DIRECTORY_DOES_NOT_EXIST, name, std::error_code(errno, std::generic_category()));
+        }
+
+        this->path = buffer.data();
+    }
+
+    TemporaryDirectory::~TemporaryDirectory()
+    {
+        std::error_code error;
+
+        std::filesystem::remove_all(this->path, error); // A destructor must not throw, and the files are only scratch space
+    }
+
+    /* Getters and Setters */
+
+    std::string TemporaryDirectory::getPath() const
+    {
+        return this->path.string();
+    }
+
+    /* Member Functions */
+
+    std::string TemporaryDirectory::createFilePath(const std::string &name) const
+    {
+        return (this->path / name).string();
+    }
+}
@@ -75,7 +75,7 @@ namespace normalizer::interpreter
         return this->table;
     }
 
-    normalizer::dependencies::DependencyManager parser::Parser::getDependencyManager() const
+    const normalizer::dependencies::DependencyManager &parser::Parser::getDependencyManager() const
     {
         return this->dependencyManager;
     }
@@ -106,6 +106,9 @@ namespace normalizer::interpreter
                     ParserValidator::validatePrimaryKey(currentToken, this->splitTextContent[currentToken.getLineNumber()], this->table);
                     this->parseKey();
                     break;
+                case token::TokenConstants::T_JOIN: // For parsing the join dependencies of the table
+                    this->parseJoinDependency();
+                    break;
                 default:
                     // Don't need to specify T_UNKNOWN as a case here as default will catch it
                     ParserValidator::throwUknownToken(currentToken, this->splitTextContent[currentToken.getLineNumber()]);
@@ -659,6 +662,99 @@ namespace normalizer::interpreter
         }
     }
 
+    void parser::Parser::parseJoinDependency()
+    {
+        token::LiteralToken currentToken = this->getNextToken();
+
+        switch (currentToken.getTokenType())
+        {
+        case token::TokenConstants::T_COLON:
+            break;
+        case token::TokenConstants::T_UNKNOWN:
+            ParserValidator::throwUknownToken(currentToken, this->splitTextContent[currentToken.getLineNumber()]);
+            break;
+        default:
+            ParserValidator::throwUnexpectedToken(currentToken, this->splitTextContent[currentToken.getLineNumber()], ":");
+            break;
+        }
+
+        std::vector<std::vector<std::string>> components;
+
+        while (true)
+        {
+            currentToken = this->getNextToken();
+
+            switch (currentToken.getTokenType())
+            {
+            case token::TokenConstants::T_LPAREN:
+                components.push_back(this->parseJoinComponent());
+                break;
+            case token::TokenConstants::T_UNKNOWN:
+                ParserValidator::throwUknownToken(currentToken, this->splitTextContent[currentToken.getLineNumber()]);
+                break;
+            default:
+                ParserValidator::throwUnexpectedToken(currentToken, this->splitTextContent[currentToken.getLineNumber()], "(");
+                break;
+            }
+
+            if (!this->hasMoreTokens())
+            {
+                break;
+            }
+
+            if (this->getNextToken().getTokenType() != token::TokenConstants::T_COMMA) // The component list ends at the first component not followed by a comma
+            {
+                this->goBackToPreviousToken();
+                break;
+            }
+        }
+
+        ParserValidator::validateJoinDependency(currentToken, this->splitTextContent[currentToken.getLineNumber()], components);
+
+        this->dependencyManager.addJoinDependency(components);
+    }
+
+    std::vector<std::string> parser::Parser::parseJoinComponent()
+    {
+        std::vector<std::string> component;
+
+        while (true)
+        {
+            token::LiteralToken currentToken = this->getNextToken();
+
+            switch (currentToken.getTokenType())
+            {
+            case token::TokenConstants::T_IDENTIFIER:
+                ParserValidator::validateRowName(currentToken, this->splitTextContent[currentToken.getLineNumber()], this->table);
+
+                component.push_back(currentToken.getTokenValue());
+                break;
+            case token::TokenConstants::T_UNKNOWN:
+                ParserValidator::throwUknownToken(currentToken, this->splitTextContent[currentToken.getLineNumber()]);
+                break;
+            default:
+                ParserValidator::throwUnexpectedToken(currentToken, this->splitTextContent[currentToken.getLineNumber()], "row_name");
+                break;
+            }
+
+            currentToken = this->getNextToken();
+
+            switch (currentToken.getTokenType())
+            {
+            case token::TokenConstants::T_COMMA:
+                break;
+            case token::TokenConstants::T_RPAREN:
+                return component;
+            case token::TokenConstants::T_UNKNOWN:
+                ParserValidator::throwUknownToken(currentToken, this->splitTextContent[currentToken.getLineNumber()]);
+                break;
+            default:
+                ParserValidator::throwUnexpectedToken(currentToken, this->splitTextContent[currentToken.getLineNumber()], ", or )");
+                break;
+            }
+        }
+    }
+
     void parser::Parser::addDependencyRowIfNotExists(const std::string &rowName)
     {
         for (const normalizer::dependencies::row::DependencyRow &row : this->dependencyRows)
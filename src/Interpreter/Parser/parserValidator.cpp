@@ -82,6 +82,18 @@ namespace normalizer::interpreter::parser
         }
     }
 
+    void ParserValidator::validateJoinDependency(const normalizer::interpreter::token::LiteralToken &token, const std::string &textLine, const std::vector<std::vector<std::string>> &components)
+    {
+        std::string errorString = ParserValidator::constructBasicErrorMessage(token, textLine);
+
+        errorString += "On line number " + std::to_string(token.getLineNumber() + 1) + " there was a join dependency with fewer than two components found.\n";
+
+        if (components.size() < 2)
+        {
+            throw std::invalid_argument(errorString);
+        }
+    }
+
     void ParserValidator::validateSingleDependencyExists(const normalizer::interpreter::token::LiteralToken &token, const std::string &textLine, const std::vector<normalizer::dependencies::row::DependencyRow> &dependencyRows, const std::string &currentRowName)
     {
         std::string errorString = ParserValidator::constructBasicDependencyMessage(token, textLine, false);
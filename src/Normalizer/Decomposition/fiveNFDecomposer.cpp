@@ -0,0 +1,180 @@
+/*! \file fiveNFDecomposer.cpp
+    \brief C++ file for decomposing relations into 5NF.
+    \details Contains the function definitions for finding the join dependencies that violate 5NF and splitting a relation on them
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Decomposition/fiveNFDecomposer.h"
+
+namespace normalizer::decomposition
+{
+    /* Constructors and Destructors */
+
+    FiveNFDecomposer::FiveNFDecomposer(dependencies::closure::ClosureCache &inClosureCache, const std::vector<dependencies::join::JoinDependency> &inJoinDependencies) : closureCache(inClosureCache)
+    {
+        for (const dependencies::join::JoinDependency &dependency : inJoinDependencies)
+        {
+            if (!dependency.isTrivial() && std::find(this->joinDependencies.begin(), this->joinDependencies.end(), dependency) == this->joinDependencies.end())
+            {
+                this->joinDependencies.push_back(dependency);
+            }
+        }
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<dependencies::join::JoinDependency> &FiveNFDecomposer::getJoinDependencies() const
+    {
+        return this->joinDependencies;
+    }
+
+    /* Member Functions */
+
+    std::vector<dependencies::join::JoinDependency> FiveNFDecomposer::findViolations(const dependencies::attribute::AttributeSet &relation)
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> candidates;
+
+        for (std::size_t i = 0; i < this->joinDependencies.size(); ++i)
+        {
+            if (this->joinDependencies[i].getAttributes() == relation)
+            {
+                candidates.push_back(std::make_pair(0, i));
+            }
+        }
+
+        const std::vector<char> violating = this->findViolatingCandidates({relation}, candidates);
+
+        std::vector<dependencies::join::JoinDependency> violations;
+
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (violating[i])
+            {
+                violations.push_back(this->joinDependencies[candidates[i].second]);
+            }
+        }
+
+        return violations;
+    }
+
+    bool FiveNFDecomposer::isImpliedByKeys(const dependencies::join::JoinDependency &dependency, const dependencies::attribute::AttributeSet &relation)
+    {
+        const us attributeCount = this->closureCache.getCalculator().getAttributeCount();
+
+        dependencies::attribute::AttributeSet outside(attributeCount);
+
+        for (us attributeId = 0; attributeId < attributeCount; ++attributeId)
+        {
+            if (!relation.containsAttribute(attributeId))
+            {
+                outside.addAttribute(attributeId);
+            }
+        }
+
+        std::vector<dependencies::attribute::AttributeSet> rows;
+
+        for (const dependencies::attribute::AttributeSet &component : dependency.getComponents())
+        {
+            rows.push_back(component | outside); // Columns outside of the relation are distinguished everywhere so they never decide the chase
+        }
+
+        dependencies::projection::DependencyProjector projector(this->closureCache);
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+        std::vector<dependencies::functional::FunctionalDependency> keyDependencies;
+
+        for (const dependencies::attribute::AttributeSet &key : keyFinder.findCandidateKeys(relation, projector.project(relation)))
+        {
+            keyDependencies.push_back({key, relation});
+        }
+
+        dependencies::chase::ChaseTableau tableau(rows, attributeCount);
+
+        return tableau.chase(keyDependencies, {}, tableau.getRowCount()); // Key dependencies only equate symbols, so the tableau never grows
+    }
+
+    std::vector<std::vector<dependencies::attribute::AttributeSet>> FiveNFDecomposer::decompose(const std::vector<dependencies::attribute::AttributeSet> &relations)
+    {
+        std::vector<std::vector<dependencies::attribute::AttributeSet>> components(relations.size());
+
+        std::vector<std::size_t> pendingOwners;
+        std::vector<dependencies::attribute::AttributeSet> pending = relations;
+
+        for (std::size_t i = 0; i < relations.size(); ++i)
+        {
+            pendingOwners.push_back(i);
+        }
+
+        while (!pending.empty())
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> candidates;
+
+            for (std::size_t i = 0; i < pending.size(); ++i)
+            {
+                for (std::size_t j = 0; j < this->joinDependencies.size(); ++j)
+                {
+                    if (this->joinDependencies[j].getAttributes() == pending[i])
+                    {
+                        candidates.push_back(std::make_pair(i, j));
+                    }
+                }
+            }
+
+            const std::vector<char> violating = this->findViolatingCandidates(pending, candidates);
+
+            std::vector<const dependencies::join::JoinDependency *> splitOn(pending.size(), nullptr);
+
+            for (std::size_t i = 0; i < candidates.size(); ++i)
+            {
+                if (violating[i] && splitOn[candidates[i].first] == nullptr) // Split on the first declared violation only
+                {
+                    splitOn[candidates[i].first] = &this->joinDependencies[candidates[i].second];
+                }
+            }
+
+            std::vector<std::size_t> nextOwners;
+            std::vector<dependencies::attribute::AttributeSet> next;
+
+            for (std::size_t i = 0; i < pending.size(); ++i)
+            {
+                if (splitOn[i] == nullptr)
+                {
+                    components[pendingOwners[i]].push_back(pending[i]);
+                    continue;
+                }
+
+                for (const dependencies::attribute::AttributeSet &component : splitOn[i]->getComponents())
+                {
+                    nextOwners.push_back(pendingOwners[i]);
+                    next.push_back(component);
+                }
+            }
+
+            pendingOwners = nextOwners;
+            pending = next;
+        }
+
+        return components;
+    }
+
+    std::vector<char> FiveNFDecomposer::findViolatingCandidates(const std::vector<dependencies::attribute::AttributeSet> &relations, const std::vector<std::pair<std::size_t, std::size_t>> &candidates)
+    {
+        const std::size_t candidateCount = candidates.size();
+
+        std::vector<char> violating(candidateCount, 0); // Not std::vector<bool>, as every thread writes to its own elements
+
+        auto checkRange = [&](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                violating[i] = this->isImpliedByKeys(this->joinDependencies[candidates[i].second], relations[candidates[i].first]) ? 0 : 1;
+            }
+        };
+
+        parallel::ParallelRunner::run(candidateCount, JOIN_CANDIDATES_PER_THREAD, checkRange);
+
+        return violating;
+    }
+}
@@ -0,0 +1,122 @@
+/*! \file fourNFDecomposer.cpp
+    \brief C++ file for decomposing relations into 4NF.
+    \details Contains the function definitions for finding the multi valued dependencies that violate 4NF and splitting a relation on them
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Decomposition/fourNFDecomposer.h"
+
+namespace normalizer::decomposition
+{
+    /* Constructors and Destructors */
+
+    FourNFDecomposer::FourNFDecomposer(dependencies::basis::DependencyBasisCalculator &inBasisCalculator, const std::vector<dependencies::attribute::AttributeSet> &inDeterminants) : basisCalculator(inBasisCalculator)
+    {
+        for (const dependencies::attribute::AttributeSet &determinant : inDeterminants)
+        {
+            if (std::find(this->determinants.begin(), this->determinants.end(), determinant) == this->determinants.end())
+            {
+                this->determinants.push_back(determinant);
+            }
+        }
+    }
+
+    /* Member Functions */
+
+    std::vector<dependencies::multivalued::MultivaluedDependency> FourNFDecomposer::findViolations(const dependencies::attribute::AttributeSet &relation)
+    {
+        std::vector<dependencies::multivalued::MultivaluedDependency> violations;
+
+        for (const dependencies::attribute::AttributeSet &determinant : this->determinants)
+        {
+            if (!determinant.isSubsetOf(relation) || relation.isSubsetOf(this->basisCalculator.computeClosure(determinant))) // Not in the relation, or a superkey of it
+            {
+                continue;
+            }
+
+            const std::vector<dependencies::attribute::AttributeSet> pieces = this->getPieces(determinant, relation, determinant);
+
+            if (pieces.size() > 1) // With one piece, X ->> R - X is trivial
+            {
+                violations.push_back({determinant, pieces.front()});
+            }
+        }
+
+        return violations;
+    }
+
+    std::vector<dependencies::multivalued::MultivaluedDependency> FourNFDecomposer::findMultivaluedViolations(const dependencies::attribute::AttributeSet &relation)
+    {
+        std::vector<dependencies::multivalued::MultivaluedDependency> violations;
+
+        for (const dependencies::attribute::AttributeSet &determinant : this->determinants)
+        {
+            if (!determinant.isSubsetOf(relation))
+            {
+                continue;
+            }
+
+            const dependencies::attribute::AttributeSet closure = this->basisCalculator.computeClosure(determinant);
+
+            if (relation.isSubsetOf(closure))
+            {
+                continue;
+            }
+
+            const std::vector<dependencies::attribute::AttributeSet> pieces = this->getPieces(determinant, relation, closure);
+
+            if (pieces.size() > 1)
+            {
+                violations.push_back({determinant, pieces.front()});
+            }
+        }
+
+        return violations;
+    }
+
+    std::vector<dependencies::attribute::AttributeSet> FourNFDecomposer::decompose(const dependencies::attribute::AttributeSet &relation)
+    {
+        std::vector<dependencies::attribute::AttributeSet> components;
+        std::vector<dependencies::attribute::AttributeSet> pending = {relation};
+
+        while (!pending.empty())
+        {
+            const dependencies::attribute::AttributeSet current = pending.back();
+            pending.pop_back();
+
+            const std::vector<dependencies::multivalued::MultivaluedDependency> violations = this->findViolations(current);
+
+            if (violations.empty())
+            {
+                components.push_back(current);
+                continue;
+            }
+
+            const dependencies::multivalued::MultivaluedDependency &violation = violations.front();
+
+            pending.push_back(current - violation.getDependent());
+            pending.push_back(violation.getDeterminant() | violation.getDependent()); // Split off first, so the parts come out in the order they were split
+        }
+
+        return components;
+    }
+
+    std::vector<dependencies::attribute::AttributeSet> FourNFDecomposer::getPieces(const dependencies::attribute::AttributeSet &determinant, const dependencies::attribute::AttributeSet &relation, const dependencies::attribute::AttributeSet &excluded)
+    {
+        std::vector<dependencies::attribute::AttributeSet> pieces;
+
+        for (const dependencies::attribute::AttributeSet &block : this->basisCalculator.getBasis(determinant))
+        {
+            dependencies::attribute::AttributeSet piece = block & relation;
+
+            if (!piece.isEmpty() && !piece.isSubsetOf(excluded))
+            {
+                pieces.push_back(piece);
+            }
+        }
+
+        return pieces;
+    }
+}
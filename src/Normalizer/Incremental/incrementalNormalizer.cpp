@@ -0,0 +1,195 @@
+/*! \file incrementalNormalizer.cpp
+    \brief C++ file for incrementally re-normalizing a decomposition.
+    \details Contains the function definitions for keeping the closures, keys and decomposition of a normalization in memory while functional dependencies are added and retracted
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Incremental/incrementalNormalizer.h"
+
+namespace normalizer::incremental
+{
+    /* Constructors and Destructors */
+
+    IncrementalNormalizer::IncrementalNormalizer(const dependencies::attribute::AttributeDictionary &inDictionary, const dependencies::closure::ClosureCache &inClosureCache, const std::vector<dependencies::attribute::AttributeSet> &inComponents) : dictionary(inDictionary), closureCache(inClosureCache), components(inComponents), componentDependencies(inComponents.size()), recomputedClosureCount(0)
+    {
+        for (ui i = 0; i < this->components.size(); ++i)
+        {
+            this->affectedComponents.push_back(i);
+        }
+
+        this->refreshAffectedComponents();
+
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+        this->candidateKeys = keyFinder.findCandidateKeys();
+    }
+
+    IncrementalNormalizer::IncrementalNormalizer(const IncrementalNormalizer &other) : dictionary(other.dictionary), closureCache(other.closureCache), components(other.components), componentDependencies(other.componentDependencies), candidateKeys(other.candidateKeys), affectedComponents(other.affectedComponents), recomputedClosureCount(other.recomputedClosureCount) {}
+
+    /* Getters and Setters */
+
+    const std::vector<dependencies::functional::FunctionalDependency> &IncrementalNormalizer::getFunctionalDependencies() const
+    {
+        return this->closureCache.getCalculator().getFunctionalDependencies();
+    }
+
+    const std::vector<dependencies::attribute::AttributeSet> &IncrementalNormalizer::getCandidateKeys() const
+    {
+        return this->candidateKeys;
+    }
+
+    const std::vector<dependencies::attribute::AttributeSet> &IncrementalNormalizer::getComponents() const
+    {
+        return this->components;
+    }
+
+    const std::vector<std::vector<dependencies::functional::FunctionalDependency>> &IncrementalNormalizer::getComponentDependencies() const
+    {
+        return this->componentDependencies;
+    }
+
+    const std::vector<ui> &IncrementalNormalizer::getAffectedComponents() const
+    {
+        return this->affectedComponents;
+    }
+
+    ul IncrementalNormalizer::getRecomputedClosureCount() const
+    {
+        return this->recomputedClosureCount;
+    }
+
+    /* Member Functions */
+
+    std::vector<dependencies::functional::FunctionalDependency> IncrementalNormalizer::parseDependencies(const std::string &text) const
+    {
+        table::Table schema;
+
+        for (us attributeId = 0; attributeId < this->dictionary.getAttributeCount(); ++attributeId)
+        {
+            schema.addTableRow({this->dictionary.getAttributeName(attributeId), table::row::GenericRowDefinition()});
+        }
+
+        interpreter::parser::Parser dependencyParser(text, schema);
+
+        dependencyParser.parse();
+
+        return dependencyParser.getDependencyManager().getFunctionalDependencies(this->dictionary);
+    }
+
+    bool IncrementalNormalizer::addDependency(const dependencies::functional::FunctionalDependency &dependency)
+    {
+        const std::vector<dependencies::functional::FunctionalDependency> &functionalDependencies = this->getFunctionalDependencies();
+
+        if (std::find(functionalDependencies.begin(), functionalDependencies.end(), dependency) != functionalDependencies.end())
+        {
+            return false;
+        }
+
+        this->findAffectedComponents(dependency);
+
+        this->recomputedClosureCount = this->closureCache.addDependency(dependency);
+
+        this->refreshAffectedComponents();
+
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+        this->candidateKeys = keyFinder.completeCandidateKeys(this->candidateKeys); // Closures only grow, so every key is still a superkey
+
+        return true;
+    }
+
+    bool IncrementalNormalizer::retractDependency(const dependencies::functional::FunctionalDependency &dependency)
+    {
+        const std::vector<dependencies::functional::FunctionalDependency> &functionalDependencies = this->getFunctionalDependencies();
+
+        if (std::find(functionalDependencies.begin(), functionalDependencies.end(), dependency) == functionalDependencies.end())
+        {
+            return false;
+        }
+
+        this->findAffectedComponents(dependency);
+
+        std::vector<bool> usedDependency;
+
+        for (const dependencies::attribute::AttributeSet &candidateKey : this->candidateKeys)
+        {
+            usedDependency.push_back(dependency.getDeterminant().isSubsetOf(this->closureCache.getClosure(candidateKey)));
+        }
+
+        this->recomputedClosureCount = this->closureCache.retractDependency(dependency);
+
+        this->refreshAffectedComponents();
+
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+        const dependencies::attribute::AttributeSet schema = this->dictionary.createFullSet();
+
+        std::vector<dependencies::attribute::AttributeSet> superkeys;
+
+        for (std::size_t i = 0; i < this->candidateKeys.size(); ++i)
+        {
+            if (!usedDependency[i] || keyFinder.isSuperkey(this->candidateKeys[i], schema)) // A closure that never reached the left hand side is unchanged
+            {
+                superkeys.push_back(this->candidateKeys[i]);
+            }
+        }
+
+        this->candidateKeys = keyFinder.completeCandidateKeys(superkeys);
+
+        return true;
+    }
+
+    bool IncrementalNormalizer::isComponentInBCNF(const ui index)
+    {
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+        for (const dependencies::functional::FunctionalDependency &dependency : this->componentDependencies[index])
+        {
+            if (!keyFinder.isSuperkey(dependency.getDeterminant(), this->components[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void IncrementalNormalizer::findAffectedComponents(const dependencies::functional::FunctionalDependency &dependency)
+    {
+        this->affectedComponents.clear();
+
+        for (ui i = 0; i < this->components.size(); ++i)
+        {
+            if (dependency.getDeterminant().isSubsetOf(this->closureCache.getClosure(this->components[i]))) // Otherwise no subset of the table can reach the left hand side, before or after the change
+            {
+                this->affectedComponents.push_back(i);
+            }
+        }
+    }
+
+    void IncrementalNormalizer::refreshAffectedComponents()
+    {
+        dependencies::projection::DependencyProjector projector(this->closureCache);
+
+        for (const ui index : this->affectedComponents)
+        {
+            this->componentDependencies[index] = projector.project(this->components[index]);
+        }
+    }
+
+    /* Operator Overloads */
+
+    IncrementalNormalizer &IncrementalNormalizer::operator=(const IncrementalNormalizer &other)
+    {
+        this->dictionary = other.dictionary;
+        this->closureCache = other.closureCache;
+        this->components = other.components;
+        this->componentDependencies = other.componentDependencies;
+        this->candidateKeys = other.candidateKeys;
+        this->affectedComponents = other.affectedComponents;
+        this->recomputedClosureCount = other.recomputedClosureCount;
+
+        return *this;
+    }
+}
\ No newline at end of file
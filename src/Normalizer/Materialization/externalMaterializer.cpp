@@ -0,0 +1,91 @@
+/*! \file externalMaterializer.cpp
+    \brief C++ file for filling the normalized tables with the rows of a CSV data file larger than memory.
+    \details Contains the function definitions for projecting the rows of a CSV data file onto each normalized table one partition at a time, and writing them as INSERT statements or CSV files
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Materialization/externalMaterializer.h"
+
+namespace normalizer::materialization
+{
+    /* Constructors and Destructors */
+
+    ExternalMaterializer::ExternalMaterializer(table::external::ExternalPartitioner &inPartitioner, const std::vector<table::Table> &inTables) : partitioner(inPartitioner), tables(inTables), columns(ExternalMaterializer::collectColumnNames(inTables)), layout(columns, inTables), rowCounts(inTables.size(), 0)
+    {
+        this->layout.materialize(); // With no rows, so only the headers are written
+    }
+
+    /* Getters and Setters */
+
+    ul ExternalMaterializer::getRowCount(const std::size_t table) const
+    {
+        return this->rowCounts[table];
+    }
+
+    /* Member Functions */
+
+    void ExternalMaterializer::writeInserts(std::ostream &outputStream)
+    {
+        for (const std::size_t table : this->layout.getLoadOrder())
+        {
+            this->materializeTable(table, [&outputStream](const TableMaterializer &partition)
+                                   { partition.writeInserts(0, outputStream); });
+
+            outputStream << std::endl;
+        }
+    }
+
+    void ExternalMaterializer::writeCsv(const std::size_t table, std::ostream &outputStream)
+    {
+        this->layout.writeCsv(table, outputStream);
+
+        this->materializeTable(table, [&outputStream](const TableMaterializer &partition)
+                               { partition.writeCsv(0, outputStream, false); });
+    }
+
+    std::string ExternalMaterializer::createLoadScript(const std::vector<std::string> &csvPaths) const
+    {
+        return this->layout.createLoadScript(csvPaths);
+    }
+
+    void ExternalMaterializer::materializeTable(const std::size_t table, const std::function<void(const TableMaterializer &)> &write)
+    {
+        const std::vector<table::Table> partitionTables = {this->tables[table]};
+        const std::vector<std::string> columnNames = ExternalMaterializer::collectColumnNames(partitionTables);
+
+        std::vector<us> keyColumns(columnNames.size(), 0);
+        std::iota(keyColumns.begin(), keyColumns.end(), 0);
+
+        this->rowCounts[table] = 0;
+
+        this->partitioner.forEachPartition(columnNames, keyColumns, [this, table, &partitionTables, &write](const table::instance::TableInstance &instance, const std::vector<ul> &)
+                                           {
+                                               TableMaterializer partition(instance, partitionTables);
+
+                                               partition.materialize();
+
+                                               this->rowCounts[table] += partition.getSourceRows(0).size();
+
+                                               write(partition); });
+    }
+
+    std::vector<std::string> ExternalMaterializer::collectColumnNames(const std::vector<table::Table> &normalizedTables)
+    {
+        std::vector<std::string> columnNames;
+
+        for (const table::Table &normalizedTable : normalizedTables)
+        {
+            for (const table::row::TableRow &row : normalizedTable.getTableRows())
+            {
+                if (std::find(columnNames.begin(), columnNames.end(), row.getRowName()) == columnNames.end())
+                {
+                    columnNames.push_back(row.getRowName());
+                }
+            }
+        }
+
+        return columnNames;
+    }
+}
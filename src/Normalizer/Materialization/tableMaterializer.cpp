@@ -0,0 +1,355 @@
+/*! \file tableMaterializer.cpp
+    \brief C++ file for filling the normalized tables with the rows of the input table.
+    \details Contains the function definitions for projecting the rows of the input table onto each normalized table, removing their duplicates and writing them as INSERT statements or CSV files
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Materialization/tableMaterializer.h"
+
+namespace normalizer::materialization
+{
+    /* Constructors and Destructors */
+
+    TableMaterializer::TableMaterializer(const table::instance::TableInstance &inInstance, const std::vector<table::Table> &inTables) : instance(inInstance), tables(inTables), sourceRows(inTables.size())
+    {
+        std::unordered_map<std::string, us> columnIndices;
+
+        for (us column = 0; column < this->instance.getColumnCount(); ++column)
+        {
+            columnIndices.emplace(this->instance.getColumnNames()[column], column);
+        }
+
+        for (const table::Table &normalizedTable : this->tables)
+        {
+            std::vector<us> columns;
+
+            for (const table::row::TableRow &row : normalizedTable.getTableRows())
+            {
+                const auto found = columnIndices.find(row.getRowName());
+
+                if (found == columnIndices.end())
+                {
+                    throw std::invalid_argument(table::MISSING_DATA_COLUMN + row.getRowName());
+                }
+
+                columns.push_back(found->second);
+            }
+
+            this->tableColumns.push_back(columns);
+        }
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<ui> &TableMaterializer::getSourceRows(const std::size_t table) const
+    {
+        return this->sourceRows[table];
+    }
+
+    std::size_t TableMaterializer::getTableCount() const
+    {
+        return this->tables.size();
+    }
+
+    const std::vector<us> &TableMaterializer::getTableColumns(const std::size_t table) const
+    {
+        return this->tableColumns[table];
+    }
+
+    std::vector<std::size_t> TableMaterializer::getLoadOrder() const
+    {
+        std::unordered_map<std::string, std::size_t> tableIndices;
+
+        for (std::size_t i = 0; i < this->tables.size(); ++i)
+        {
+            tableIndices.emplace(this->tables[i].getTableName(), i);
+        }
+
+        std::vector<std::size_t> order;
+        std::vector<char> visited(this->tables.size(), 0);
+
+        std::function<void(std::size_t)> visit = [this, &tableIndices, &order, &visited, &visit](const std::size_t table)
+        {
+            if (visited[table])
+            {
+                return;
+            }
+
+            visited[table] = 1; // Marked before the referenced tables, so a cycle of foreign keys ends
+
+            for (const table::foreign::ForeignKey &foreignKey : this->tables[table].getForeignKeys())
+            {
+                const auto referenced = tableIndices.find(foreignKey.getReferencedTableName());
+
+                if (referenced != tableIndices.end())
+                {
+                    visit(referenced->second);
+                }
+            }
+
+            order.push_back(table);
+        };
+
+        for (std::size_t i = 0; i < this->tables.size(); ++i)
+        {
+            visit(i);
+        }
+
+        return order;
+    }
+
+    /* Member Functions */
+
+    void TableMaterializer::materialize()
+    {
+        for (std::size_t i = 0; i < this->tables.size(); ++i)
+        {
+            this->sourceRows[i] = this->deduplicate(this->tableColumns[i]);
+        }
+    }
+
+    void TableMaterializer::writeInserts(std::ostream &outputStream) const
+    {
+        for (const std::size_t table : this->getLoadOrder())
+        {
+            this->writeInserts(table, outputStream);
+
+            outputStream << std::endl;
+        }
+    }
+
+    void TableMaterializer::writeInserts(const std::size_t table, std::ostream &outputStream) const
+    {
+        const std::vector<ui> &rows = this->sourceRows[table];
+        const std::string header = "INSERT INTO " + this->tables[table].getTableName() + " (" + this->getColumnList(table) + ") VALUES";
+
+        for (std::size_t batchStart = 0; batchStart < rows.size(); batchStart += MATERIALIZE_INSERT_BATCH_SIZE)
+        {
+            const std::size_t batchEnd = std::min<std::size_t>(batchStart + MATERIALIZE_INSERT_BATCH_SIZE, rows.size());
+
+            outputStream << header;
+
+            for (std::size_t i = batchStart; i < batchEnd; ++i)
+            {
+                outputStream << (i == batchStart ? "\n\t(" : ",\n\t(");
+
+                for (std::size_t column = 0; column < this->tableColumns[table].size(); ++column)
+                {
+                    outputStream << (column == 0 ? "" : ", ") << TableMaterializer::quoteSqlValue(this->instance.getValue(rows[i], this->tableColumns[table][column]));
+                }
+
+                outputStream << ")";
+            }
+
+            outputStream << ";" << std::endl;
+        }
+    }
+
+    void TableMaterializer::writeCsv(const std::size_t table, std::ostream &outputStream, const bool writeHeader) const
+    {
+        const std::vector<us> &columns = this->tableColumns[table];
+
+        if (writeHeader)
+        {
+            for (std::size_t column = 0; column < columns.size(); ++column)
+            {
+                outputStream << (column == 0 ? "" : std::string(1, file::CSV_SEPARATOR)) << TableMaterializer::quoteCsvValue(this->instance.getColumnNames()[columns[column]]);
+            }
+
+            outputStream << "\n";
+        }
+
+        for (const ui row : this->sourceRows[table])
+        {
+            for (std::size_t column = 0; column < columns.size(); ++column)
+            {
+                outputStream << (column == 0 ? "" : std::string(1, file::CSV_SEPARATOR)) << TableMaterializer::quoteCsvValue(this->instance.getValue(row, columns[column]));
+            }
+
+            outputStream << "\n";
+        }
+    }
+
+    std::string TableMaterializer::createLoadScript(const std::vector<std::string> &csvPaths) const
+    {
+        std::string script;
+
+        for (const std::size_t table : this->getLoadOrder())
+        {
+            script += "LOAD DATA LOCAL INFILE " + TableMaterializer::quoteSqlValue(csvPaths[table]) + " INTO TABLE " + this->tables[table].getTableName() + " FIELDS TERMINATED BY " + TableMaterializer::quoteSqlValue(std::string(1, file::CSV_SEPARATOR)) + " OPTIONALLY ENCLOSED BY " + TableMaterializer::quoteSqlValue(std::string(1, file::CSV_QUOTE)) + " ESCAPED BY '' LINES TERMINATED BY '\\n' IGNORE 1 LINES (" + this->getColumnList(table) + ");\n"; // A quote written twice inside a quoted value is read as one quote, as the CSV reader does
+        }
+
+        return script;
+    }
+
+    std::vector<ui> TableMaterializer::deduplicate(const std::vector<us> &columns) const
+    {
+        const ui rowCount = this->instance.getRowCount();
+        const std::size_t blockCount = (rowCount + MATERIALIZE_ROWS_PER_THREAD - 1) / MATERIALIZE_ROWS_PER_THREAD;
+
+        std::vector<ul> hashes(rowCount, 0);
+        std::vector<std::vector<ui>> blockCounts(blockCount, std::vector<ui>(MATERIALIZE_PARTITION_COUNT, 0));
+
+        parallel::ParallelRunner::run(blockCount, 1, [this, rowCount, &columns, &hashes, &blockCounts](const std::size_t begin, const std::size_t end) noexcept
+                                      {
+                                          for (std::size_t block = begin; block < end; ++block)
+                                          {
+                                              const ui blockEnd = static_cast<ui>(std::min<std::size_t>((block + 1) * MATERIALIZE_ROWS_PER_THREAD, rowCount));
+
+                                              for (ui row = static_cast<ui>(block * MATERIALIZE_ROWS_PER_THREAD); row < blockEnd; ++row)
+                                              {
+                                                  ul seed = 0;
+
+                                                  for (const us column : columns)
+                                                  {
+                                                      seed ^= std::hash<ul>{}(this->instance.getColumn(column)[row]) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+                                                  }
+
+                                                  hashes[row] = seed;
+                                                  ++blockCounts[block][seed % MATERIALIZE_PARTITION_COUNT];
+                                              }
+                                          } });
+
+        std::vector<std::size_t> partitionOffsets(MATERIALIZE_PARTITION_COUNT + 1, 0);
+        std::vector<std::vector<std::size_t>> blockOffsets(blockCount, std::vector<std::size_t>(MATERIALIZE_PARTITION_COUNT, 0));
+
+        for (us partition = 0; partition < MATERIALIZE_PARTITION_COUNT; ++partition) // Each block writes its rows of a partition after the rows of the blocks before it, so every partition stays in row order
+        {
+            std::size_t offset = partitionOffsets[partition];
+
+            for (std::size_t block = 0; block < blockCount; ++block)
+            {
+                blockOffsets[block][partition] = offset;
+                offset += blockCounts[block][partition];
+            }
+
+            partitionOffsets[partition + 1] = offset;
+        }
+
+        std::vector<ui> partitionedRows(rowCount, 0);
+
+        parallel::ParallelRunner::run(blockCount, 1, [rowCount, &hashes, &blockOffsets, &partitionedRows](const std::size_t begin, const std::size_t end) noexcept
+                                      {
+                                          for (std::size_t block = begin; block < end; ++block)
+                                          {
+                                              const ui blockEnd = static_cast<ui>(std::min<std::size_t>((block + 1) * MATERIALIZE_ROWS_PER_THREAD, rowCount));
+
+                                              for (ui row = static_cast<ui>(block * MATERIALIZE_ROWS_PER_THREAD); row < blockEnd; ++row)
+                                              {
+                                                  partitionedRows[blockOffsets[block][hashes[row] % MATERIALIZE_PARTITION_COUNT]++] = row;
+                                              }
+                                          } });
+
+        std::vector<std::vector<ui>> keptRows(MATERIALIZE_PARTITION_COUNT);
+
+        parallel::ParallelRunner::run(MATERIALIZE_PARTITION_COUNT, 1, [this, &columns, &hashes, &partitionOffsets, &partitionedRows, &keptRows](const std::size_t begin, const std::size_t end)
+                                      {
+                                          const ui emptySlot = std::numeric_limits<ui>::max();
+
+                                          for (std::size_t partition = begin; partition < end; ++partition)
+                                          {
+                                              std::size_t capacity = 1;
+
+                                              while (capacity < (partitionOffsets[partition + 1] - partitionOffsets[partition]) * 2) // At most half full, so probes stay short
+                                              {
+                                                  capacity <<= 1;
+                                              }
+
+                                              std::vector<ui> slots(capacity, emptySlot);
+
+                                              for (std::size_t i = partitionOffsets[partition]; i < partitionOffsets[partition + 1]; ++i)
+                                              {
+                                                  const ui row = partitionedRows[i];
+                                                  std::size_t slot = (hashes[row] / MATERIALIZE_PARTITION_COUNT) & (capacity - 1); // The low bits chose the partition, so the slot uses the bits above them
+
+                                                  while (slots[slot] != emptySlot && (hashes[slots[slot]] != hashes[row] || !this->rowsAgree(slots[slot], row, columns)))
+                                                  {
+                                                      slot = (slot + 1) & (capacity - 1);
+                                                  }
+
+                                                  if (slots[slot] == emptySlot) // The first row of the partition with this projection
+                                                  {
+                                                      slots[slot] = row;
+                                                      keptRows[partition].push_back(row);
+                                                  }
+                                              }
+                                          } });
+
+        std::vector<ui> rows;
+
+        for (const std::vector<ui> &partitionRows : keptRows)
+        {
+            rows.insert(rows.end(), partitionRows.begin(), partitionRows.end());
+        }
+
+        std::sort(rows.begin(), rows.end());
+
+        return rows;
+    }
+
+    bool TableMaterializer::rowsAgree(const ui first, const ui second, const std::vector<us> &columns) const
+    {
+        for (const us column : columns)
+        {
+            if (this->instance.getColumn(column)[first] != this->instance.getColumn(column)[second])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string TableMaterializer::getColumnList(const std::size_t table) const
+    {
+        std::string columnList;
+
+        for (const us column : this->tableColumns[table])
+        {
+            columnList += (columnList.empty() ? "" : ", ") + this->instance.getColumnNames()[column];
+        }
+
+        return columnList;
+    }
+
+    std::string TableMaterializer::quoteSqlValue(const std::string &value)
+    {
+        std::string quoted = "'";
+
+        for (const char character : value)
+        {
+            if (character == '\'' || character == '\\')
+            {
+                quoted += character;
+            }
+
+            quoted += character;
+        }
+
+        return quoted + "'";
+    }
+
+    std::string TableMaterializer::quoteCsvValue(const std::string &value)
+    {
+        if (value.find_first_of(std::string(1, file::CSV_SEPARATOR) + file::CSV_QUOTE + "\r\n") == std::string::npos)
+        {
+            return value;
+        }
+
+        std::string quoted(1, file::CSV_QUOTE);
+
+        for (const char character : value)
+        {
+            if (character == file::CSV_QUOTE)
+            {
+                quoted += file::CSV_QUOTE;
+            }
+
+            quoted += character;
+        }
+
+        return quoted + file::CSV_QUOTE;
+    }
+}
@@ -0,0 +1,113 @@
+/*! \file passManager.cpp
+    \brief C++ file for running the normalization passes.
+    \details Contains the function definitions for running normalization passes in order, computing the analyses they need and skipping the ones whose form already holds
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Pipeline/passManager.h"
+
+namespace normalizer::pipeline
+{
+    /* Constructors and Destructors */
+
+    PassManager::PassManager() : analysisComputers(static_cast<std::size_t>(Analysis::COUNT)), validAnalyses(static_cast<std::size_t>(Analysis::COUNT), false), computeCounts(static_cast<std::size_t>(Analysis::COUNT), 0) {}
+
+    /* Getters and Setters */
+
+    const std::vector<NormalizationForm> &PassManager::getSkippedPasses() const
+    {
+        return this->skippedPasses;
+    }
+
+    ui PassManager::getComputeCount(const Analysis analysis) const
+    {
+        return this->computeCounts[static_cast<std::size_t>(analysis)];
+    }
+
+    /* Member Functions */
+
+    void PassManager::addPass(const NormalizationPass &pass)
+    {
+        this->passes.push_back(pass);
+    }
+
+    void PassManager::registerAnalysis(const Analysis analysis, const std::function<void()> &compute, const bool valid)
+    {
+        this->analysisComputers[static_cast<std::size_t>(analysis)] = compute;
+        this->validAnalyses[static_cast<std::size_t>(analysis)] = valid;
+    }
+
+    bool PassManager::isValid(const Analysis analysis) const
+    {
+        return this->validAnalyses[static_cast<std::size_t>(analysis)];
+    }
+
+    void PassManager::invalidate(const Analysis analysis)
+    {
+        this->validAnalyses[static_cast<std::size_t>(analysis)] = false;
+    }
+
+    bool PassManager::hasPass(const NormalizationForm form) const
+    {
+        return std::any_of(this->passes.begin(), this->passes.end(), [form](const NormalizationPass &pass)
+                           { return pass.form == form; });
+    }
+
+    void PassManager::run(const NormalizationForm target, const std::function<void(NormalizationForm)> &onPassDone)
+    {
+        this->skippedPasses.clear();
+
+        for (const NormalizationPass &pass : this->passes)
+        {
+            for (const Analysis analysis : pass.requiredAnalyses)
+            {
+                this->require(analysis);
+            }
+
+            if (pass.isSatisfied && pass.isSatisfied())
+            {
+                this->skippedPasses.push_back(pass.form);
+            }
+            else if (pass.run())
+            {
+                for (std::size_t i = 0; i < this->validAnalyses.size(); ++i) // Everything the pass does not preserve has to be computed again
+                {
+                    if (std::find(pass.preservedAnalyses.begin(), pass.preservedAnalyses.end(), static_cast<Analysis>(i)) == pass.preservedAnalyses.end())
+                    {
+                        this->validAnalyses[i] = false;
+                    }
+                }
+            }
+
+            if (onPassDone)
+            {
+                onPassDone(pass.form);
+            }
+
+            if (pass.form == target)
+            {
+                return;
+            }
+        }
+    }
+
+    void PassManager::require(const Analysis analysis)
+    {
+        const std::size_t index = static_cast<std::size_t>(analysis);
+
+        if (this->validAnalyses[index])
+        {
+            return;
+        }
+
+        if (this->analysisComputers[index])
+        {
+            this->analysisComputers[index]();
+        }
+
+        this->validAnalyses[index] = true;
+        ++this->computeCounts[index];
+    }
+}
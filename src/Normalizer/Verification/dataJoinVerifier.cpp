@@ -0,0 +1,319 @@
+/*! \file dataJoinVerifier.cpp
+    \brief C++ file for verifying on the rows of a table that a decomposition is lossless.
+    \details Contains the function definitions for joining the rows of the normalized tables back together and comparing them to the rows they were filled from
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Verification/dataJoinVerifier.h"
+
+namespace normalizer::verification
+{
+    /* Constructors and Destructors */
+
+    DataJoinVerifier::DataJoinVerifier(const table::instance::TableInstance &inInstance, const materialization::TableMaterializer &inMaterializer) : instance(inInstance), materializer(inMaterializer), distinctChecksum(0), joinedCount(0)
+    {
+        this->planJoin();
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<us> &DataJoinVerifier::getUncoveredColumns() const
+    {
+        return this->uncoveredColumns;
+    }
+
+    ul DataJoinVerifier::getDistinctRowCount() const
+    {
+        return this->distinctRows.size();
+    }
+
+    ul DataJoinVerifier::getJoinedRowCount() const
+    {
+        return this->joinedCount;
+    }
+
+    const std::vector<std::vector<std::string>> &DataJoinVerifier::getSpuriousRows() const
+    {
+        return this->spuriousRows;
+    }
+
+    const std::vector<std::vector<std::string>> &DataJoinVerifier::getMissingRows() const
+    {
+        return this->missingRows;
+    }
+
+    /* Member Functions */
+
+    bool DataJoinVerifier::verify()
+    {
+        this->joinedCount = 0;
+        this->spuriousRows.clear();
+        this->missingRows.clear();
+
+        if (this->joinOrder.empty())
+        {
+            return false;
+        }
+
+        std::atomic<ul> totalCount(0);
+        std::atomic<ul> totalChecksum(0);
+
+        parallel::ParallelRunner::run(this->materializer.getSourceRows(this->joinOrder[0]).size(), DATA_JOIN_ROWS_PER_THREAD, [this, &totalCount, &totalChecksum](const std::size_t begin, const std::size_t end)
+                                      {
+                                          ul localCount = 0;
+                                          ul localChecksum = 0;
+
+                                          this->joinRows(begin, end, [this, &localCount, &localChecksum](const std::vector<ui> &values)
+                                                         {
+                                                             ++localCount;
+                                                             localChecksum += DataJoinVerifier::hashValues(values, this->coveredColumns);
+
+                                                             return localCount <= this->distinctRows.size(); // Past the rows of the data, the join is already lossy, and a lossy join can grow far larger
+                                                         });
+
+                                          totalCount += localCount;
+                                          totalChecksum += localChecksum; });
+
+        this->joinedCount = totalCount;
+
+        if (this->joinedCount == this->distinctRows.size() && totalChecksum == this->distinctChecksum)
+        {
+            return this->uncoveredColumns.empty();
+        }
+
+        std::vector<char> seen(this->distinctRows.size(), 0);
+        bool complete = true;
+
+        this->joinRows(0, this->materializer.getSourceRows(this->joinOrder[0]).size(), [this, &seen, &complete](const std::vector<ui> &values)
+                       {
+                           const std::size_t distinctRow = this->findDistinctRow(values, DataJoinVerifier::hashValues(values, this->coveredColumns));
+
+                           if (distinctRow < this->distinctRows.size())
+                           {
+                               seen[distinctRow] = 1;
+                               return true;
+                           }
+
+                           this->spuriousRows.push_back(this->describeRow(values));
+                           complete = this->spuriousRows.size() < DATA_JOIN_REPORTED_ROWS;
+
+                           return complete; });
+
+        std::vector<ui> values(this->instance.getColumnCount(), 0);
+
+        for (std::size_t i = 0; complete && i < this->distinctRows.size() && this->missingRows.size() < DATA_JOIN_REPORTED_ROWS; ++i) // Only a join that ran to the end knows which rows never came back
+        {
+            if (!seen[i])
+            {
+                this->loadRow(this->distinctRows[i], values);
+                this->missingRows.push_back(this->describeRow(values));
+            }
+        }
+
+        return false;
+    }
+
+    void DataJoinVerifier::planJoin()
+    {
+        const std::size_t tableCount = this->materializer.getTableCount();
+
+        std::vector<char> covered(this->instance.getColumnCount(), 0);
+        std::vector<char> joined(tableCount, 0);
+
+        for (std::size_t position = 0; position < tableCount; ++position)
+        {
+            std::size_t next = tableCount;
+            std::size_t nextShared = 0;
+
+            for (std::size_t table = 0; table < tableCount; ++table) // The first table is the one with the most rows, so the most work is split across threads, and each next one shares the most columns
+            {
+                if (joined[table])
+                {
+                    continue;
+                }
+
+                const std::vector<us> &columns = this->materializer.getTableColumns(table);
+                const std::size_t shared = static_cast<std::size_t>(std::count_if(columns.begin(), columns.end(), [&covered](const us column)
+                                                                                  { return covered[column] != 0; }));
+
+                if (next == tableCount || (position == 0 && this->materializer.getSourceRows(table).size() > this->materializer.getSourceRows(next).size()) || (position > 0 && shared > nextShared))
+                {
+                    next = table;
+                    nextShared = shared;
+                }
+            }
+
+            std::vector<us> keys;
+            std::vector<us> added;
+
+            for (const us column : this->materializer.getTableColumns(next))
+            {
+                if (covered[column])
+                {
+                    keys.push_back(column);
+                }
+                else
+                {
+                    added.push_back(column);
+                    covered[column] = 1;
+                }
+            }
+
+            std::unordered_map<ul, std::vector<ui>> index;
+            std::vector<ui> values(this->instance.getColumnCount(), 0);
+
+            if (position > 0)
+            {
+                for (const ui row : this->materializer.getSourceRows(next))
+                {
+                    this->loadRow(row, values);
+                    index[DataJoinVerifier::hashValues(values, keys)].push_back(row);
+                }
+            }
+
+            joined[next] = 1;
+            this->joinOrder.push_back(next);
+            this->keyColumns.push_back(keys);
+            this->newColumns.push_back(added);
+            this->indexes.push_back(std::move(index));
+        }
+
+        for (us column = 0; column < this->instance.getColumnCount(); ++column)
+        {
+            (covered[column] ? this->coveredColumns : this->uncoveredColumns).push_back(column);
+        }
+
+        std::vector<ui> values(this->instance.getColumnCount(), 0);
+
+        for (ui row = 0; row < this->instance.getRowCount(); ++row)
+        {
+            this->loadRow(row, values);
+
+            const ul hash = DataJoinVerifier::hashValues(values, this->coveredColumns);
+
+            if (this->findDistinctRow(values, hash) < this->distinctRows.size())
+            {
+                continue;
+            }
+
+            this->distinctRowsByHash[hash].push_back(static_cast<ui>(this->distinctRows.size()));
+            this->distinctRows.push_back(row);
+            this->distinctChecksum += hash;
+        }
+    }
+
+    ul DataJoinVerifier::hashValues(const std::vector<ui> &values, const std::vector<us> &columns)
+    {
+        ul seed = 0;
+
+        for (const us column : columns)
+        {
+            seed ^= std::hash<ul>{}(values[column]) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        return seed * 0xff51afd7ed558ccdULL; // Spreads the bits, since the hashes are added up rather than compared
+    }
+
+    void DataJoinVerifier::loadRow(const ui row, std::vector<ui> &values) const
+    {
+        for (us column = 0; column < this->instance.getColumnCount(); ++column)
+        {
+            values[column] = this->instance.getColumn(column)[row];
+        }
+    }
+
+    std::size_t DataJoinVerifier::findDistinctRow(const std::vector<ui> &values, const ul hash) const
+    {
+        const auto found = this->distinctRowsByHash.find(hash);
+
+        if (found == this->distinctRowsByHash.end())
+        {
+            return this->distinctRows.size();
+        }
+
+        for (const ui distinctRow : found->second)
+        {
+            const bool matches = std::all_of(this->coveredColumns.begin(), this->coveredColumns.end(), [this, &values, distinctRow](const us column)
+                                             { return this->instance.getColumn(column)[this->distinctRows[distinctRow]] == values[column]; });
+
+            if (matches)
+            {
+                return distinctRow;
+            }
+        }
+
+        return this->distinctRows.size();
+    }
+
+    void DataJoinVerifier::joinRows(const std::size_t begin, const std::size_t end, const std::function<bool(const std::vector<ui> &)> &visit) const
+    {
+        const std::vector<ui> &firstRows = this->materializer.getSourceRows(this->joinOrder[0]);
+
+        std::vector<ui> values(this->instance.getColumnCount(), 0);
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            for (const us column : this->newColumns[0])
+            {
+                values[column] = this->instance.getColumn(column)[firstRows[i]];
+            }
+
+            if (!this->extendRow(1, values, visit))
+            {
+                return;
+            }
+        }
+    }
+
+    bool DataJoinVerifier::extendRow(const std::size_t position, std::vector<ui> &values, const std::function<bool(const std::vector<ui> &)> &visit) const
+    {
+        if (position == this->joinOrder.size())
+        {
+            return visit(values);
+        }
+
+        const auto found = this->indexes[position].find(DataJoinVerifier::hashValues(values, this->keyColumns[position]));
+
+        if (found == this->indexes[position].end())
+        {
+            return true;
+        }
+
+        for (const ui row : found->second)
+        {
+            const bool matches = std::all_of(this->keyColumns[position].begin(), this->keyColumns[position].end(), [this, &values, row](const us column)
+                                             { return this->instance.getColumn(column)[row] == values[column]; });
+
+            if (!matches) // Another key with the same hash
+            {
+                continue;
+            }
+
+            for (const us column : this->newColumns[position])
+            {
+                values[column] = this->instance.getColumn(column)[row];
+            }
+
+            if (!this->extendRow(position + 1, values, visit))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<std::string> DataJoinVerifier::describeRow(const std::vector<ui> &values) const
+    {
+        std::vector<std::string> row;
+
+        for (const us column : this->coveredColumns)
+        {
+            row.push_back(this->instance.getDistinctValue(column, values[column]));
+        }
+
+        return row;
+    }
+}
@@ -0,0 +1,89 @@
+/*! \file dependencyPreservationVerifier.cpp
+    \brief C++ file for verifying that a decomposition preserves its dependencies.
+    \details Contains the function definitions for finding the functional dependencies that no longer follow from the tables of a decomposition
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Verification/dependencyPreservationVerifier.h"
+
+namespace normalizer::verification
+{
+    /* Constructors and Destructors */
+
+    DependencyPreservationVerifier::DependencyPreservationVerifier(dependencies::closure::ClosureCache &inClosureCache) : closureCache(inClosureCache) {}
+
+    /* Getters and Setters */
+
+    const std::vector<dependencies::functional::FunctionalDependency> &DependencyPreservationVerifier::getLostDependencies() const
+    {
+        return this->lostDependencies;
+    }
+
+    /* Member Functions */
+
+    bool DependencyPreservationVerifier::verify(const std::vector<dependencies::attribute::AttributeSet> &components)
+    {
+        const std::vector<dependencies::functional::FunctionalDependency> &functionalDependencies = this->closureCache.getCalculator().getFunctionalDependencies();
+        const std::size_t dependencyCount = functionalDependencies.size();
+
+        std::vector<char> preserved(dependencyCount, 1); // Not std::vector<bool>, as every thread writes to its own elements
+
+        auto checkRange = [&](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                preserved[i] = this->isPreserved(functionalDependencies[i], components) ? 1 : 0;
+            }
+        };
+
+        parallel::ParallelRunner::run(dependencyCount, PRESERVATION_DEPENDENCIES_PER_THREAD, checkRange);
+
+        this->lostDependencies.clear();
+
+        for (std::size_t i = 0; i < dependencyCount; ++i)
+        {
+            if (!preserved[i])
+            {
+                this->lostDependencies.push_back(functionalDependencies[i]);
+            }
+        }
+
+        return this->lostDependencies.empty();
+    }
+
+    bool DependencyPreservationVerifier::isPreserved(const dependencies::functional::FunctionalDependency &dependency, const std::vector<dependencies::attribute::AttributeSet> &components)
+    {
+        const dependencies::attribute::AttributeSet &dependent = dependency.getDependent();
+
+        dependencies::attribute::AttributeSet reached = dependency.getDeterminant();
+
+        bool changed = true;
+
+        while (changed && !dependent.isSubsetOf(reached))
+        {
+            changed = false;
+
+            for (const dependencies::attribute::AttributeSet &component : components)
+            {
+                const dependencies::attribute::AttributeSet known = reached & component;
+
+                if (known.isEmpty() && this->closureCache.getClosure(known).isEmpty()) // Only the closure of nothing can fire in a table that shares nothing with what is reached
+                {
+                    continue;
+                }
+
+                const dependencies::attribute::AttributeSet gained = (this->closureCache.getClosure(known) & component) - reached;
+
+                if (!gained.isEmpty())
+                {
+                    reached |= gained;
+                    changed = true;
+                }
+            }
+        }
+
+        return dependent.isSubsetOf(reached);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,574 @@
+/*! \file externalDataJoinVerifier.cpp
+    \brief C++ file for verifying on the rows of a CSV data file larger than memory that a decomposition is lossless.
+    \details Contains the function definitions for joining the rows of the normalized tables back together one partition at a time, and comparing them to the rows they were filled from
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Verification/externalDataJoinVerifier.h"
+
+namespace normalizer::verification
+{
+    /* Getters and Setters */
+
+    const std::vector<std::string> &ExternalDataJoinVerifier::getUncoveredColumns() const
+    {
+        return this->uncoveredColumns;
+    }
+
+    ul ExternalDataJoinVerifier::getDistinctRowCount() const
+    {
+        return this->distinctCount;
+    }
+
+    ul ExternalDataJoinVerifier::getJoinedRowCount() const
+    {
+        return this->joinedCount;
+    }
+
+    const std::vector<std::vector<std::string>> &ExternalDataJoinVerifier::getSpuriousRows() const
+    {
+        return this->spuriousRows;
+    }
+
+    const std::vector<std::vector<std::string>> &ExternalDataJoinVerifier::getMissingRows() const
+    {
+        return this->missingRows;
+    }
+
+    ul ExternalDataJoinVerifier::getPartitionCount() const
+    {
+        return this->partitionCount;
+    }
+
+    ul ExternalDataJoinVerifier::getSpilledBytes() const
+    {
+        return this->spilledBytes;
+    }
+
+    /* Member Functions */
+
+    bool ExternalDataJoinVerifier::verify()
+    {
+        this->distinctCount = 0;
+        this->joinedCount = 0;
+        this->partitionCount = 0;
+        this->spilledBytes = 0;
+        this->overflowed = false;
+        this->matched = true;
+        this->spuriousRows.clear();
+        this->missingRows.clear();
+
+        if (std::filesystem::file_size(this->dataPath) * table::EXTERNAL_MEMORY_FACTOR <= this->memoryLimit)
+        {
+            return this->verifyInMemory();
+        }
+
+        const file::TemporaryDirectory directory(this->temporaryPath);
+
+        std::vector<std::string> tablePaths;
+
+        for (std::size_t table = 0; table < this->tables.size(); ++table) // Also counts the rows of each table, which picks the first one to join
+        {
+            tablePaths.push_back(directory.createFilePath("table-" + std::to_string(table) + ".csv"));
+
+            std::ofstream tableFile = ExternalDataJoinVerifier::openFile(tablePaths.back());
+
+            this->materializer.writeCsv(table, tableFile);
+
+            ExternalDataJoinVerifier::closeFile(tableFile, tablePaths.back());
+        }
+
+        this->planJoin();
+
+        if (this->joinOrder.empty())
+        {
+            return false;
+        }
+
+        std::string header;
+        std::vector<std::string> headerValues = this->coveredColumns;
+
+        headerValues.push_back(DATA_JOIN_SIDE_COLUMN);
+        ExternalDataJoinVerifier::appendCsvRow(header, headerValues);
+
+        const std::string comparisonPath = directory.createFilePath("comparison.csv");
+
+        std::ofstream comparison = ExternalDataJoinVerifier::openFile(comparisonPath);
+
+        comparison << header;
+
+        const ul rowLimit = this->appendRows(this->dataPath, this->coveredColumns, DATA_JOIN_FIRST_SIDE, comparison);
+
+        if (this->joinOrder.size() == 1)
+        {
+            this->joinedCount = this->appendRows(tablePaths[this->joinOrder[0]], this->coveredColumns, DATA_JOIN_SECOND_SIDE, comparison);
+        }
+
+        std::string joinPath;
+
+        for (std::size_t position = 1; position < this->joinOrder.size() && !this->overflowed; ++position)
+        {
+            if (position == 1)
+            {
+                joinPath = directory.createFilePath("join-1.csv");
+
+                std::ofstream joinFile = ExternalDataJoinVerifier::openFile(joinPath);
+
+                header.clear();
+                headerValues = this->layouts[1];
+                headerValues.push_back(DATA_JOIN_SIDE_COLUMN);
+                ExternalDataJoinVerifier::appendCsvRow(header, headerValues);
+
+                joinFile << header;
+
+                this->appendRows(tablePaths[this->joinOrder[0]], this->layouts[1], DATA_JOIN_FIRST_SIDE, joinFile);
+                this->appendRows(tablePaths[this->joinOrder[1]], this->layouts[1], DATA_JOIN_SECOND_SIDE, joinFile);
+
+                ExternalDataJoinVerifier::closeFile(joinFile, joinPath);
+            }
+
+            if (position + 1 == this->joinOrder.size()) // The last table is joined straight into the rows compared to the data
+            {
+                this->joinStep(joinPath, position, comparison, rowLimit);
+                std::filesystem::remove(joinPath);
+                break;
+            }
+
+            const std::string nextPath = directory.createFilePath("join-" + std::to_string(position + 1) + ".csv");
+
+            std::ofstream nextFile = ExternalDataJoinVerifier::openFile(nextPath);
+
+            header.clear();
+            headerValues = this->layouts[position + 1];
+            headerValues.push_back(DATA_JOIN_SIDE_COLUMN);
+            ExternalDataJoinVerifier::appendCsvRow(header, headerValues);
+
+            nextFile << header;
+
+            this->joinStep(joinPath, position, nextFile, rowLimit);
+            this->appendRows(tablePaths[this->joinOrder[position + 1]], this->layouts[position + 1], DATA_JOIN_SECOND_SIDE, nextFile);
+
+            ExternalDataJoinVerifier::closeFile(nextFile, nextPath);
+            std::filesystem::remove(joinPath);
+
+            joinPath = nextPath;
+        }
+
+        ExternalDataJoinVerifier::closeFile(comparison, comparisonPath);
+
+        std::vector<std::string> comparisonColumns = this->coveredColumns;
+        std::vector<us> keys(this->coveredColumns.size(), 0);
+
+        comparisonColumns.push_back(DATA_JOIN_SIDE_COLUMN);
+        std::iota(keys.begin(), keys.end(), 0);
+
+        table::external::ExternalPartitioner partitioner(comparisonPath, this->temporaryPath, this->memoryLimit);
+
+        partitioner.forEachPartition(comparisonColumns, keys, [this](const table::instance::TableInstance &partition, const std::vector<ul> &)
+                                     { this->comparePartition(partition); });
+
+        this->partitionCount += partitioner.getPartitionCount();
+        this->spilledBytes += partitioner.getSpilledBytes();
+
+        return !this->overflowed && this->matched && this->uncoveredColumns.empty();
+    }
+
+    bool ExternalDataJoinVerifier::verifyInMemory()
+    {
+        const table::instance::TableInstance instance = file::CsvReader(this->dataPath).read().selectColumns(this->columnNames);
+
+        materialization::TableMaterializer tableMaterializer(instance, this->tables);
+
+        tableMaterializer.materialize();
+
+        DataJoinVerifier verifier(instance, tableMaterializer);
+
+        const bool lossless = verifier.verify();
+
+        for (const us column : verifier.getUncoveredColumns())
+        {
+            this->uncoveredColumns.push_back(instance.getColumnNames()[column]);
+        }
+
+        this->distinctCount = verifier.getDistinctRowCount();
+        this->joinedCount = verifier.getJoinedRowCount();
+        this->spuriousRows = verifier.getSpuriousRows();
+        this->missingRows = verifier.getMissingRows();
+
+        return lossless;
+    }
+
+    void ExternalDataJoinVerifier::planJoin()
+    {
+        this->coveredColumns.clear();
+        this->uncoveredColumns.clear();
+        this->joinOrder.clear();
+        this->keyColumns.clear();
+        this->layouts.clear();
+
+        std::vector<std::vector<std::string>> tableColumns;
+
+        for (const table::Table &normalizedTable : this->tables)
+        {
+            std::vector<std::string> columns;
+
+            for (const table::row::TableRow &row : normalizedTable.getTableRows())
+            {
+                if (std::find(columns.begin(), columns.end(), row.getRowName()) == columns.end())
+                {
+                    columns.push_back(row.getRowName());
+                }
+            }
+
+            tableColumns.push_back(std::move(columns));
+        }
+
+        std::vector<std::string> joined;
+        std::vector<char> used(this->tables.size(), 0);
+
+        for (std::size_t position = 0; position < this->tables.size(); ++position)
+        {
+            std::size_t next = this->tables.size();
+            std::size_t nextShared = 0;
+
+            for (std::size_t table = 0; table < this->tables.size(); ++table) // The first table is the one with the most rows, and each next one shares the most columns with the tables before it
+            {
+                if (used[table])
+                {
+                    continue;
+                }
+
+                const std::size_t shared = static_cast<std::size_t>(std::count_if(tableColumns[table].begin(), tableColumns[table].end(), [&joined](const std::string &column)
+                                                                                  { return std::find(joined.begin(), joined.end(), column) != joined.end(); }));
+
+                if (next == this->tables.size() || (position == 0 && this->materializer.getRowCount(table) > this->materializer.getRowCount(next)) || (position > 0 && shared > nextShared))
+                {
+                    next = table;
+                    nextShared = shared;
+                }
+            }
+
+            std::vector<std::string> keys;
+
+            for (const std::string &column : tableColumns[next])
+            {
+                if (std::find(joined.begin(), joined.end(), column) != joined.end())
+                {
+                    keys.push_back(column);
+                }
+                else
+                {
+                    joined.push_back(column);
+                }
+            }
+
+            used[next] = 1;
+            this->joinOrder.push_back(next);
+            this->keyColumns.push_back(std::move(keys));
+            this->layouts.push_back(joined);
+        }
+
+        for (const std::string &column : this->columnNames)
+        {
+            (std::find(joined.begin(), joined.end(), column) != joined.end() ? this->coveredColumns : this->uncoveredColumns).push_back(column);
+        }
+    }
+
+    void ExternalDataJoinVerifier::joinStep(const std::string &joinPath, const std::size_t position, std::ostream &output, const ul rowLimit)
+    {
+        const std::vector<std::string> &layout = this->layouts[position];
+        const std::size_t joinedWidth = this->layouts[position - 1].size(); // The columns before it come from the rows joined so far, and the rest from the next table
+        const bool last = position + 1 == this->joinOrder.size();
+        const us sideColumn = static_cast<us>(layout.size());
+
+        std::vector<std::string> partitionColumns = layout;
+        std::vector<us> keys;
+
+        partitionColumns.push_back(DATA_JOIN_SIDE_COLUMN);
+
+        for (const std::string &column : this->keyColumns[position])
+        {
+            keys.push_back(static_cast<us>(std::find(layout.begin(), layout.end(), column) - layout.begin()));
+        }
+
+        const std::vector<std::string> &outputLayout = last ? this->coveredColumns : this->layouts[position + 1];
+
+        std::vector<std::size_t> sources; // The column of the partition of each column written, or the width of the layout for a column of a table not joined yet
+
+        for (const std::string &column : outputLayout)
+        {
+            sources.push_back(static_cast<std::size_t>(std::find(layout.begin(), layout.end(), column) - layout.begin()));
+        }
+
+        table::external::ExternalPartitioner partitioner(joinPath, this->temporaryPath, this->memoryLimit);
+
+        ul joinedRows = 0;
+
+        partitioner.forEachPartition(partitionColumns, keys, [this, &output, &keys, &sources, &layout, joinedWidth, last, sideColumn, rowLimit, &joinedRows](const table::instance::TableInstance &partition, const std::vector<ul> &)
+                                     {
+                                         if (this->overflowed)
+                                         {
+                                             return;
+                                         }
+
+                                         std::unordered_map<ul, std::vector<ui>> nextRows;
+                                         std::vector<ui> joinedSoFar;
+
+                                         for (ui row = 0; row < partition.getRowCount(); ++row)
+                                         {
+                                             if (partition.getValue(row, sideColumn) == DATA_JOIN_SECOND_SIDE)
+                                             {
+                                                 nextRows[ExternalDataJoinVerifier::hashValues(partition, row, keys)].push_back(row);
+                                             }
+                                             else
+                                             {
+                                                 joinedSoFar.push_back(row);
+                                             }
+                                         }
+
+                                         std::vector<std::string> values(sources.size() + 1);
+                                         std::string text;
+
+                                         values.back() = last ? DATA_JOIN_SECOND_SIDE : DATA_JOIN_FIRST_SIDE;
+
+                                         for (const ui row : joinedSoFar)
+                                         {
+                                             const auto found = nextRows.find(ExternalDataJoinVerifier::hashValues(partition, row, keys));
+
+                                             if (found == nextRows.end())
+                                             {
+                                                 continue;
+                                             }
+
+                                             for (const ui nextRow : found->second)
+                                             {
+                                                 if (!ExternalDataJoinVerifier::rowsAgree(partition, row, nextRow, keys)) // Another key with the same hash
+                                                 {
+                                                     continue;
+                                                 }
+
+                                                 if (++joinedRows > rowLimit) // Past the rows of the data, the join is already lossy, and a lossy join can grow far larger
+                                                 {
+                                                     this->overflowed = true;
+                                                     this->joinedCount = joinedRows;
+                                                     return;
+                                                 }
+
+                                                 for (std::size_t i = 0; i < sources.size(); ++i)
+                                                 {
+                                                     values[i] = sources[i] == layout.size() ? std::string() : partition.getValue(sources[i] < joinedWidth ? row : nextRow, static_cast<us>(sources[i]));
+                                                 }
+
+                                                 text.clear();
+                                                 ExternalDataJoinVerifier::appendCsvRow(text, values);
+                                                 output << text;
+                                             }
+                                         } });
+
+        this->partitionCount += partitioner.getPartitionCount();
+        this->spilledBytes += partitioner.getSpilledBytes();
+
+        if (last && !this->overflowed)
+        {
+            this->joinedCount = joinedRows;
+        }
+    }
+
+    void ExternalDataJoinVerifier::comparePartition(const table::instance::TableInstance &partition)
+    {
+        const us sideColumn = static_cast<us>(this->coveredColumns.size());
+
+        std::vector<us> columns(this->coveredColumns.size(), 0);
+        std::iota(columns.begin(), columns.end(), 0);
+
+        std::unordered_map<ul, std::vector<ui>> dataRowsByHash;
+        std::vector<ui> dataRows;
+        std::vector<ui> joinedRows;
+        ul dataChecksum = 0;
+        ul joinedChecksum = 0;
+
+        const auto findDataRow = [&partition, &columns, &dataRowsByHash](const ui row, const ul hash)
+        {
+            const auto found = dataRowsByHash.find(hash);
+
+            if (found != dataRowsByHash.end())
+            {
+                for (const ui dataRow : found->second)
+                {
+                    if (ExternalDataJoinVerifier::rowsAgree(partition, row, dataRow, columns))
+                    {
+                        return dataRow;
+                    }
+                }
+            }
+
+            return std::numeric_limits<ui>::max();
+        };
+
+        for (ui row = 0; row < partition.getRowCount(); ++row)
+        {
+            const ul hash = ExternalDataJoinVerifier::hashValues(partition, row, columns);
+
+            if (partition.getValue(row, sideColumn) == DATA_JOIN_SECOND_SIDE) // Joined rows are distinct already, as every table only holds distinct rows
+            {
+                joinedRows.push_back(row);
+                joinedChecksum += hash;
+            }
+            else if (findDataRow(row, hash) == std::numeric_limits<ui>::max())
+            {
+                dataRowsByHash[hash].push_back(row);
+                dataRows.push_back(row);
+                dataChecksum += hash;
+            }
+        }
+
+        this->distinctCount += dataRows.size();
+
+        if (this->overflowed || (joinedRows.size() == dataRows.size() && joinedChecksum == dataChecksum))
+        {
+            return;
+        }
+
+        this->matched = false;
+
+        const auto describeRow = [&partition, &columns](const ui row)
+        {
+            std::vector<std::string> values;
+
+            for (const us column : columns)
+            {
+                values.push_back(partition.getValue(row, column));
+            }
+
+            return values;
+        };
+
+        std::unordered_set<ui> joinedBack;
+
+        for (const ui row : joinedRows)
+        {
+            const ui dataRow = findDataRow(row, ExternalDataJoinVerifier::hashValues(partition, row, columns));
+
+            if (dataRow != std::numeric_limits<ui>::max())
+            {
+                joinedBack.insert(dataRow);
+            }
+            else if (this->spuriousRows.size() < DATA_JOIN_REPORTED_ROWS)
+            {
+                this->spuriousRows.push_back(describeRow(row));
+            }
+        }
+
+        for (const ui row : dataRows)
+        {
+            if (!joinedBack.contains(row) && this->missingRows.size() < DATA_JOIN_REPORTED_ROWS)
+            {
+                this->missingRows.push_back(describeRow(row));
+            }
+        }
+    }
+
+    ul ExternalDataJoinVerifier::appendRows(const std::string &csvPath, const std::vector<std::string> &layout, const std::string &side, std::ostream &output) const
+    {
+        const file::CsvReader reader(csvPath);
+        const std::vector<std::string> fileColumnNames = reader.readColumnNames();
+
+        std::vector<std::size_t> sources; // The column of the file of each column of the layout, or the width of the file for a column it does not have
+
+        for (const std::string &column : layout)
+        {
+            sources.push_back(static_cast<std::size_t>(std::find(fileColumnNames.begin(), fileColumnNames.end(), column) - fileColumnNames.begin()));
+        }
+
+        const std::size_t chunksPerWindow = std::clamp<std::size_t>(this->memoryLimit / (table::EXTERNAL_MEMORY_FACTOR * file::CSV_CHUNK_BYTES), 1, std::max(std::thread::hardware_concurrency(), 1U));
+
+        std::vector<std::string> texts(chunksPerWindow);
+        std::vector<ul> chunkRows(chunksPerWindow, 0);
+        ul rowCount = 0;
+
+        reader.scan(
+            chunksPerWindow, [&sources, &side, &texts, &chunkRows](const std::size_t chunk, const std::vector<std::string> &fileValues)
+            {
+                std::vector<std::string> values;
+
+                for (const std::size_t source : sources)
+                {
+                    values.push_back(source < fileValues.size() ? fileValues[source] : std::string());
+                }
+
+                values.push_back(side);
+
+                ExternalDataJoinVerifier::appendCsvRow(texts[chunk], values);
+                ++chunkRows[chunk]; },
+            [&output, &texts, &chunkRows, &rowCount](const std::size_t chunkCount)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) // Written in the order of the chunks, so the rows keep their order
+                {
+                    output << texts[chunk];
+                    texts[chunk].clear();
+
+                    rowCount += chunkRows[chunk];
+                    chunkRows[chunk] = 0;
+                }
+            });
+
+        return rowCount;
+    }
+
+    ul ExternalDataJoinVerifier::hashValues(const table::instance::TableInstance &partition, const ui row, const std::vector<us> &columns)
+    {
+        ul seed = 0;
+
+        for (const us column : columns)
+        {
+            seed ^= std::hash<ul>{}(partition.getColumn(column)[row]) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        return seed * 0xff51afd7ed558ccdULL; // Spreads the bits, since the hashes are added up rather than compared
+    }
+
+    bool ExternalDataJoinVerifier::rowsAgree(const table::instance::TableInstance &partition, const ui first, const ui second, const std::vector<us> &columns)
+    {
+        return std::all_of(columns.begin(), columns.end(), [&partition, first, second](const us column)
+                           { return partition.getColumn(column)[first] == partition.getColumn(column)[second]; });
+    }
+
+    void ExternalDataJoinVerifier::appendCsvRow(std::string &text, const std::vector<std::string> &values)
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            if (i > 0)
+            {
+                text += file::CSV_SEPARATOR;
+            }
+
+            text += materialization::TableMaterializer::quoteCsvValue(values[i]);
+        }
+
+        text += '\n';
+    }
+
+    std::ofstream ExternalDataJoinVerifier::openFile(const std::string &path)
+    {
+        std::ofstream output(path, std::ios::binary);
+
+        if (!output.is_open())
+        {
+            throw std::filesystem::filesystem_error(file::FILE_DID_NOT_OPEN, path, std::make_error_code(std::errc::io_error));
+        }
+
+        return output;
+    }
+
+    void ExternalDataJoinVerifier::closeFile(std::ofstream &output, const std::string &path)
+    {
+        output.close();
+
+        if (output.fail()) // Most likely the disk filled up
+        {
+            throw std::filesystem::filesystem_error(file::FILE_NOT_WRITTEN, path, std::make_error_code(std::errc::io_error));
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*! \file losslessJoinVerifier.cpp
+    \brief C++ file for verifying that a decomposition is lossless.
+    \details Contains the function definitions for proving or refuting that the tables of a decomposition join back into the input table
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Normalizer/Verification/losslessJoinVerifier.h"
+
+namespace normalizer::verification
+{
+    /* Constructors and Destructors */
+
+    LosslessJoinVerifier::LosslessJoinVerifier(const std::vector<dependencies::functional::FunctionalDependency> &inFunctionalDependencies, const std::vector<dependencies::multivalued::MultivaluedDependency> &inMultivaluedDependencies, const us count, const std::vector<dependencies::join::JoinDependency> &inJoinDependencies, const ui inMaxRows) : functionalDependencies(inFunctionalDependencies), multivaluedDependencies(inMultivaluedDependencies), joinDependencies(inJoinDependencies), attributeCount(count), uncoveredAttributes(count), chaseRowCount(0), maxRows(inMaxRows) {}
+
+    /* Getters and Setters */
+
+    const dependencies::attribute::AttributeSet &LosslessJoinVerifier::getUncoveredAttributes() const
+    {
+        return this->uncoveredAttributes;
+    }
+
+    ui LosslessJoinVerifier::getChaseRowCount() const
+    {
+        return this->chaseRowCount;
+    }
+
+    /* Member Functions */
+
+    JoinResult LosslessJoinVerifier::verify(const std::vector<dependencies::attribute::AttributeSet> &components)
+    {
+        dependencies::attribute::AttributeSet covered(this->attributeCount);
+
+        for (const dependencies::attribute::AttributeSet &component : components)
+        {
+            covered |= component;
+        }
+
+        this->uncoveredAttributes = dependencies::attribute::AttributeSet(this->attributeCount);
+
+        for (us attributeId = 0; attributeId < this->attributeCount; ++attributeId)
+        {
+            if (!covered.containsAttribute(attributeId))
+            {
+                this->uncoveredAttributes.addAttribute(attributeId);
+            }
+        }
+
+        this->chaseRowCount = static_cast<ui>(components.size());
+
+        if (!this->uncoveredAttributes.isEmpty()) // No row can ever be distinguished on an attribute no table holds
+        {
+            return JoinResult::LOSSY;
+        }
+
+        dependencies::chase::ChaseTableau tableau(components, this->attributeCount);
+
+        const bool lossless = tableau.chase(this->functionalDependencies, this->multivaluedDependencies, this->joinDependencies, this->maxRows);
+
+        this->chaseRowCount = tableau.getRowCount();
+
+        if (lossless)
+        {
+            return JoinResult::LOSSLESS;
+        }
+
+        return tableau.isTruncated() ? JoinResult::INCONCLUSIVE : JoinResult::LOSSY;
+    }
+}
\ No newline at end of file
@@ -12,7 +12,7 @@ namespace normalizer
 {
     /* Constructors and Destructors */
 
-    Normalizer::Normalizer(const NormalizationForm &normalizeForm, const bool getNormalizedForm, const std::string &sqlFilePath, const std::string &dependencyFilePath) : normalizeTo(normalizeForm), getHighestForm(getNormalizedForm), hasPrimaryKey(true), hasNullableRows(false)
+    Normalizer::Normalizer(const NormalizationForm &normalizeForm, const bool getNormalizedForm, const std::string &sqlFilePath, const std::string &dependencyFilePath) : normalizeTo(normalizeForm), getHighestForm(getNormalizedForm), hasPrimaryKey(true), hasNullableRows(false), verifyDecomposition(false), joinResult(verification::JoinResult::LOSSY)
     {
         file::FileManager sqlManager(sqlFilePath, false);
 
@@ -40,6 +40,10 @@ namespace normalizer
         {
             this->table.addPrimaryKey(key);
         }
+
+        this->inputTable = this->table;
+
+        this->initializeDependencyAnalysis();
     }
 
     /* Getters and Setters */
@@ -49,35 +53,300 @@ namespace normalizer
         return this->normalizedTables;
     }
 
+    const table::Table &Normalizer::getInputTable() const
+    {
+        return this->inputTable;
+    }
+
+    std::vector<dependencies::functional::FunctionalDependency> Normalizer::getDeclaredDependencies() const
+    {
+        return this->dependencies.getFunctionalDependencies(this->attributeDictionary);
+    }
+
+    std::vector<dependencies::functional::FunctionalDependency> Normalizer::getTableDependencies(const table::Table &inTable)
+    {
+        dependencies::projection::DependencyProjector projector(this->closureCache);
+
+        return projector.project(this->attributeDictionary.getTableAttributes(inTable));
+    }
+
+    const dependencies::attribute::AttributeDictionary &Normalizer::getAttributeDictionary() const
+    {
+        return this->attributeDictionary;
+    }
+
+    void Normalizer::setVerifyDecomposition(const bool verify)
+    {
+        this->verifyDecomposition = verify;
+    }
+
+    verification::JoinResult Normalizer::getJoinResult() const
+    {
+        return this->joinResult;
+    }
+
+    const std::vector<dependencies::functional::FunctionalDependency> &Normalizer::getLostDependencies() const
+    {
+        return this->lostDependencies;
+    }
+
+    const dependencies::closure::ClosureCache &Normalizer::getClosureCache() const
+    {
+        return this->closureCache;
+    }
+
+    const dependencies::attribute::AttributeSet &Normalizer::getPrimeAttributes() const
+    {
+        return this->primeAttributes;
+    }
+
     /* Member Functions */
 
     void Normalizer::normalize()
     {
-        switch (this->normalizeTo)
+        this->normalize({this->normalizeTo});
+    }
+
+    std::map<NormalizationForm, std::vector<table::Table>> Normalizer::normalize(const std::vector<NormalizationForm> &targetForms)
+    {
+        std::map<NormalizationForm, std::vector<table::Table>> decompositions;
+
+        if (targetForms.empty())
+        {
+            return decompositions;
+        }
+
+        if (this->getHighestForm)
+        {
+            this->analyze(); // Shares the closures with the passes, and is the same as after them since they start from a copy of the input table
+        }
+
+        pipeline::PassManager passManager = this->createPassManager();
+
+        for (const NormalizationForm targetForm : targetForms)
         {
-        case NormalizationForm::ONE:
-            this->normalizeToOneNF();
-            this->normalizedTables.push_back(this->table);
-            break;
-        case NormalizationForm::TWO:
-            this->normalizeToTwoNF();
-            break;
-        case NormalizationForm::THREE:
-            this->normalizeToThreeNF();
-            break;
-        case NormalizationForm::BCNF:
-            this->normalizeToBCNF();
-            break;
-        case NormalizationForm::FOUR:
-            this->normalizeToFourNF();
-            break;
-        case NormalizationForm::FIVE:
-            this->normalizeToFiveNF();
-            break;
-        default:
-            std::cout << "Normalization form not recognized" << std::endl;
-            break;
+            if (!passManager.hasPass(targetForm))
+            {
+                std::cout << "Normalization form not recognized" << std::endl;
+                return decompositions;
+            }
         }
+
+        this->table = this->inputTable;
+        this->hasPrimaryKey = true;
+        this->hasNullableRows = false;
+        this->normalizedTables = {this->table}; // Every pass starts from the tables of the one before it
+
+        passManager.run(*std::max_element(targetForms.begin(), targetForms.end()), [this, &targetForms, &decompositions](const NormalizationForm form)
+                        {
+                            if (std::find(targetForms.begin(), targetForms.end(), form) != targetForms.end())
+                            {
+                                decompositions[form] = this->normalizedTables;
+                            } });
+
+        this->table = this->inputTable; // The 1NF pass only sets the primary key of the working copy
+
+        if (this->verifyDecomposition)
+        {
+            this->verifyNormalizedTables();
+        }
+
+        return decompositions;
+    }
+
+    const analysis::NormalFormAnalysis &Normalizer::analyze()
+    {
+        if (this->normalFormAnalysis.has_value())
+        {
+            return this->normalFormAnalysis.value();
+        }
+
+        analysis::NormalFormAnalysis result;
+
+        result.inOneNF = this->determineInOneNF();
+        this->findKeyViolations(result, {this->table}, {this->getTableDependencies(this->table)});
+        result.multiValuedDependencies = this->getMultiValuedDependencies();
+        result.joinDependencies = this->getJoinDependencies();
+
+        const std::vector<bool> levelsHeld = {result.inOneNF, result.partialDependencies.empty(), result.transitiveDependencies.empty(), result.multiValuedDependencies.empty(), result.joinDependencies.empty()};
+
+        while (result.highestForm < levelsHeld.size() && levelsHeld[result.highestForm])
+        {
+            ++result.highestForm;
+        }
+
+        if (result.highestForm > 3 && !result.bcnfDependencies.empty()) // BCNF has no number of its own, but 4NF and 5NF need it
+        {
+            result.highestForm = 3;
+        }
+
+        this->normalFormAnalysis = result;
+
+        return this->normalFormAnalysis.value();
+    }
+
+    incremental::IncrementalNormalizer Normalizer::createIncrementalNormalizer() const
+    {
+        return {this->attributeDictionary, this->closureCache, this->getNormalizedComponents()};
+    }
+
+    dependencies::comparison::DependencyComparator Normalizer::compareDependencies(const std::string &dependencyFilePath) const
+    {
+        file::FileManager dependencyManager(dependencyFilePath, false);
+
+        std::string dependencyContents = dependencyManager.grabFileContents();
+
+        table::Table schemaTable(this->table.getTableName()); // The input table loses rows while normalizing, and the other file may declare its own primary key
+
+        for (const std::string &rowName : this->attributeDictionary.toRowNames(this->attributeDictionary.createFullSet()))
+        {
+            schemaTable.addTableRow({rowName, table::row::GenericRowDefinition()});
+        }
+
+        interpreter::parser::Parser dependencyParser(dependencyContents, schemaTable);
+
+        dependencyParser.parse();
+
+        return {this->dependencies.getFunctionalDependencies(this->attributeDictionary), dependencyParser.getDependencyManager().getFunctionalDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount()};
+    }
+
+    void Normalizer::initializeDependencyAnalysis()
+    {
+        this->attributeDictionary = dependencies::attribute::AttributeDictionary(this->table);
+
+        this->closureCache = dependencies::closure::ClosureCache(dependencies::closure::ClosureCalculator(this->dependencies.getFunctionalDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount()));
+
+        this->closureMatrix = dependencies::closure::ClosureMatrix(this->closureCache.getCalculator().getDependencyStore());
+        this->dependencyGraph = dependencies::graph::DependencyGraph(this->closureCache.getCalculator().getDependencyStore());
+
+        const dependencies::keys::PrimeAttributeService primeService(this->closureCache);
+
+        this->candidateKeys = primeService.getCandidateKeys();
+        this->primeAttributes = primeService.getPrimeAttributes();
+
+        this->basisCalculator = dependencies::basis::DependencyBasisCalculator(this->closureCache.getCalculator().getFunctionalDependencies(), this->dependencies.getMultivaluedDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount());
+    }
+
+    pipeline::PassManager Normalizer::createPassManager()
+    {
+        pipeline::PassManager passManager;
+
+        passManager.registerAnalysis(
+            pipeline::Analysis::CLOSURES, [this]()
+            {
+                this->closureCache = dependencies::closure::ClosureCache(dependencies::closure::ClosureCalculator(this->dependencies.getFunctionalDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount()));
+                this->closureMatrix = dependencies::closure::ClosureMatrix(this->closureCache.getCalculator().getDependencyStore());
+                this->dependencyGraph = dependencies::graph::DependencyGraph(this->closureCache.getCalculator().getDependencyStore());
+                this->basisCalculator = dependencies::basis::DependencyBasisCalculator(this->closureCache.getCalculator().getFunctionalDependencies(), this->dependencies.getMultivaluedDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount()); },
+            true); // Built along with the dictionary
+
+        passManager.registerAnalysis(
+            pipeline::Analysis::KEYS, [this]()
+            {
+                const dependencies::keys::PrimeAttributeService primeService(this->closureCache);
+
+                this->candidateKeys = primeService.getCandidateKeys();
+                this->primeAttributes = primeService.getPrimeAttributes(); },
+            true);
+
+        passManager.registerAnalysis(
+            pipeline::Analysis::PROJECTIONS, [this]()
+            {
+                this->tableDependencies.clear();
+
+                for (const table::Table &normTable : this->normalizedTables)
+                {
+                    this->tableDependencies.push_back(this->getTableDependencies(normTable));
+                } },
+            false);
+
+        passManager.registerAnalysis(
+            pipeline::Analysis::NORMAL_FORMS, [this]()
+            {
+                this->findKeyViolations(this->workingAnalysis, this->normalizedTables, this->tableDependencies); },
+            false);
+
+        const std::vector<pipeline::Analysis> schemaAnalyses = {pipeline::Analysis::CLOSURES, pipeline::Analysis::KEYS}; // The dependencies of the input table never change, but those of the tables do whenever a pass splits them
+        const std::vector<pipeline::Analysis> tableAnalyses = {pipeline::Analysis::PROJECTIONS, pipeline::Analysis::NORMAL_FORMS};
+
+        passManager.addPass({NormalizationForm::ONE, {pipeline::Analysis::CLOSURES}, schemaAnalyses, [this]()
+                             { return this->determineInOneNF(); },
+                             [this]()
+                             {
+                                 this->normalizeToOneNF();
+                                 this->normalizedTables = {this->table};
+                                 return true; // The primary key may have changed
+                             }});
+
+        passManager.addPass({NormalizationForm::TWO, {pipeline::Analysis::KEYS, pipeline::Analysis::PROJECTIONS, pipeline::Analysis::NORMAL_FORMS}, schemaAnalyses, [this]() noexcept
+                             { return this->workingAnalysis.partialDependencies.empty(); },
+                             [this]()
+                             {
+                                 this->normalizeToTwoNF();
+                                 return true;
+                             }});
+
+        passManager.addPass({NormalizationForm::THREE, tableAnalyses, schemaAnalyses, [this]() noexcept
+                             { return this->workingAnalysis.transitiveDependencies.empty(); },
+                             [this]()
+                             {
+                                 this->normalizeToThreeNF();
+                                 return true;
+                             }});
+
+        passManager.addPass({NormalizationForm::BCNF, tableAnalyses, schemaAnalyses, [this]() noexcept
+                             { return this->workingAnalysis.bcnfDependencies.empty(); },
+                             [this]()
+                             {
+                                 this->normalizeToBCNF();
+                                 return true;
+                             }});
+
+        passManager.addPass({NormalizationForm::FOUR, {pipeline::Analysis::CLOSURES}, schemaAnalyses, {}, [this]()
+                             {
+                                 const std::size_t tableCount = this->normalizedTables.size();
+
+                                 this->normalizeToFourNF();
+                                 return this->normalizedTables.size() != tableCount; // Only splitting a table changes anything
+                             }});
+
+        passManager.addPass({NormalizationForm::FIVE, {pipeline::Analysis::CLOSURES, pipeline::Analysis::KEYS}, schemaAnalyses, [this]()
+                             { return this->dependencies.getJoinDependencyRows().empty(); },
+                             [this]()
+                             {
+                                 this->normalizeToFiveNF();
+                                 return true;
+                             }});
+
+        return passManager;
+    }
+
+    std::vector<dependencies::attribute::AttributeSet> Normalizer::getNormalizedComponents() const
+    {
+        std::vector<dependencies::attribute::AttributeSet> components;
+
+        for (const table::Table &normalizedTable : this->normalizedTables)
+        {
+            components.push_back(this->attributeDictionary.getTableAttributes(normalizedTable));
+        }
+
+        return components;
+    }
+
+    void Normalizer::verifyNormalizedTables()
+    {
+        const std::vector<dependencies::attribute::AttributeSet> components = this->getNormalizedComponents();
+
+        verification::LosslessJoinVerifier losslessVerifier(this->closureCache.getCalculator().getFunctionalDependencies(), this->dependencies.getMultivaluedDependencies(this->attributeDictionary), this->attributeDictionary.getAttributeCount(), this->dependencies.getJoinDependencies(this->attributeDictionary));
+
+        this->joinResult = losslessVerifier.verify(components);
+        this->uncoveredAttributes = losslessVerifier.getUncoveredAttributes();
+
+        verification::DependencyPreservationVerifier preservationVerifier(this->closureCache);
+
+        preservationVerifier.verify(components);
+
+        this->lostDependencies = preservationVerifier.getLostDependencies();
     }
 
     bool Normalizer::determineInOneNF()
@@ -147,9 +416,7 @@ namespace normalizer
 
     void Normalizer::normalizeToTwoNF()
     {
-        this->normalizeToOneNF(); // To be in 2NF, it must first be in 1NF
-
-        std::vector<std::pair<std::string, std::string>> partialDependencies = this->getPartialDependencies();
+        const std::vector<std::pair<std::string, std::string>> &partialDependencies = this->workingAnalysis.partialDependencies;
 
         for (const auto &dependency : partialDependencies)
         {
@@ -158,102 +425,78 @@ namespace normalizer
 
         if (partialDependencies.size() == 0)
         {
-            this->normalizedTables.push_back(this->table);
             return; // Already in 2NF as there are no partial dependencies
         }
 
-        std::vector<std::pair<std::string, std::string>> transitiveDependencies = this->getTrasitiveDependencies(); // In 2NF we keep the transitive dependencies
+        std::vector<table::Table> twoNFTables;
 
-        std::unordered_map<std::string, table::Table> newTables;
+        for (const table::Table &normTable : this->normalizedTables)
+        {
+            const dependencies::attribute::AttributeSet relation = this->attributeDictionary.getTableAttributes(normTable);
 
-        const std::vector<table::row::TableRow> &tableRows = this->table.getTableRows();
+            dependencies::attribute::AttributeSet remainder = relation;
+            std::vector<table::Table> newTables;
+            std::vector<dependencies::attribute::AttributeSet> newDeterminants;
 
-        for (const auto &dependency : partialDependencies)
-        {
-            for (us i = 0; i < tableRows.size();)
+            for (const dependencies::attribute::AttributeSet &determinant : this->workingAnalysis.partialDeterminants)
             {
-                if (tableRows[i].getRowName() != dependency.second) // Skip if not a partial dependency
+                if (!determinant.isSubsetOf(relation))
                 {
-                    i++;
                     continue;
                 }
 
-                if (newTables.find(dependency.first) == newTables.end()) // If the primary key doesn't already exist
-                {
-                    newTables[dependency.first] = table::Table(this->convertRowToTableName(dependency.first));
+                const dependencies::attribute::AttributeSet component = this->closureCache.getClosure(determinant) & relation; // In 2NF we keep the transitive dependencies, so the new table takes every row the determinant decides
 
-                    newTables[dependency.first].addPrimaryKey(dependency.first); // Add the primary key to the new table
-                    newTables[dependency.first].addTableRow(tableRows[i]);       // Add the row to the new table
-                    this->table.removeTableRow(tableRows[i]);                    // Remove the row from the original table
-                }
-                else
+                remainder -= (component - determinant) - this->primeAttributes; // The prime rows stay behind, so the candidate keys of the table still hold
+
+                std::string rowNames;
+
+                for (const std::string &rowName : this->attributeDictionary.toRowNames(determinant))
                 {
-                    newTables[dependency.first].addTableRow(tableRows[i]); // Add the row to the new table
-                    this->table.removeTableRow(tableRows[i]);              // Remove the row from the original table
+                    rowNames += rowName;
                 }
+
+                newTables.push_back(this->createComponentTable(normTable, component, this->convertRowToTableName(rowNames), determinant));
+                newDeterminants.push_back(determinant);
             }
-        }
 
-        for (const std::string &primaryKey : this->table.getPrimaryKeys())
-        {
-            if (newTables.find(primaryKey) != newTables.end()) // If the the new table exists
-                for (const table::row::TableRow &row : tableRows)
-                {
-                    if (row.getRowName() == primaryKey) // Add the primary key to the new table
-                    {
-                        newTables[primaryKey].addTableRow(row);
-                        break;
-                    }
-                }
-        }
+            if (newTables.empty())
+            {
+                twoNFTables.push_back(normTable);
+                continue;
+            }
 
-        for (const auto &dependency : transitiveDependencies)
-        {
-            for (const std::string &primaryKey : this->table.getPrimaryKeys())
+            dependencies::attribute::AttributeSet primaryKey = this->attributeDictionary.toAttributeSet(normTable.getPrimaryKeys());
+
+            if (!primaryKey.isSubsetOf(remainder)) // A declared key row that only part of the key decides is no longer in the table
             {
-                if (newTables.find(primaryKey) != newTables.end()) // If the the new table exists
-                {
-                    for (const table::row::TableRow &row : newTables[primaryKey].getTableRows())
-                    {
-                        if (row.getRowName() == dependency.first) // Find the row that has the transitive dependency
-                        {
-                            for (const table::row::TableRow &innerRow : tableRows)
-                            {
-                                if (innerRow.getRowName() == dependency.second) // Find the row that is the transitive dependency
-                                {
-                                    newTables[primaryKey].addTableRow(innerRow); // Add the transitive dependency to the new table
-                                    this->table.removeTableRow(innerRow);        // Remove the transitive dependency from the original table
-                                    break;
-                                }
-                            }
-                            break;
-                        }
-                    }
-                }
+                dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+                primaryKey = keyFinder.minimizeSuperkey(remainder, remainder);
             }
-        }
 
-        for (auto &pair : newTables)
-        {
-            if (tableRows.size() > this->table.getPrimaryKeys().size()) // If the original table has more rows than just the primary keys, implies at least one row is dependent on the entire primary key
+            table::Table remainderTable = this->createComponentTable(normTable, remainder, normTable.getTableName(), primaryKey);
+
+            remainderTable.setIfNotExists(normTable.getIfNotExists());
+
+            for (std::size_t i = 0; i < newTables.size(); ++i)
             {
-                this->normalizedTables.push_back(this->table);
+                for (const std::string &rowName : this->attributeDictionary.toRowNames(newDeterminants[i])) // The determinant is prime, so the remaining table still holds it
+                {
+                    remainderTable.addForeignKey({rowName, newTables[i].getTableName(), rowName});
+                }
             }
 
-            this->normalizedTables.push_back(pair.second);
+            twoNFTables.push_back(remainderTable);
+            twoNFTables.insert(twoNFTables.end(), newTables.begin(), newTables.end());
         }
 
-        if (this->table.getPrimaryKeys().size() > 1 && this->normalizedTables.size() > 0) // If the original table was normalized to more tables then create a composite table connection
-        {
-            this->createTableOnCompositeKey();
-        }
+        this->normalizedTables = twoNFTables;
     }
 
     void Normalizer::normalizeToThreeNF()
     {
-        this->normalizeToTwoNF(); // To be in 3NF, it must first be in 2NF
-
-        std::vector<std::pair<std::string, std::string>> transitiveDependencies = this->getTrasitiveDependencies(); // In 2NF we keep the transitive dependencies
+        const std::vector<std::pair<std::string, std::string>> &transitiveDependencies = this->workingAnalysis.transitiveDependencies;
 
         if (transitiveDependencies.size() == 0)
         {
@@ -281,7 +524,14 @@ namespace normalizer
                         {
                             if (innerRow.getRowName() == pair.second) // Find the row that is the transitive dependency
                             {
-                                normTable.addForeignKey({pair.first, this->convertRowToTableName(pair.first), pair.first}); // Add the foreign key to the new table
+                                const table::foreign::ForeignKey foreignKey(pair.first, this->convertRowToTableName(pair.first), pair.first);
+                                const std::vector<table::foreign::ForeignKey> foreignKeys = normTable.getForeignKeys();
+
+                                if (std::find(foreignKeys.begin(), foreignKeys.end(), foreignKey) == foreignKeys.end()) // The table may already reference the table split off by an earlier pass
+                                {
+                                    normTable.addForeignKey(foreignKey); // Add the foreign key to the new table
+                                }
+
 
                                 bool primaryAlreadyIn = false;
 
@@ -321,17 +571,12 @@ namespace normalizer
             }
         }
 
-        for (const auto &pair : newTables) // Add the new tables to the normalized tables
-        {
-            this->normalizedTables.push_back(pair.second);
-        }
+        this->addNewTables(newTables);
     }
 
     void Normalizer::normalizeToBCNF()
     {
-        this->normalizeToThreeNF(); // To be in BCNF, it must first be in 3NF
-
-        std::vector<std::pair<std::string, std::string>> bcnfDependencies = this->getBCNFDependencies();
+        const std::vector<std::pair<std::string, std::string>> &bcnfDependencies = this->workingAnalysis.bcnfDependencies;
 
         if (bcnfDependencies.size() == 0)
         {
@@ -359,9 +604,16 @@ namespace normalizer
                         {
                             if (innerRow.getRowName() == pair.second) // Find the row that is the bcnf dependency
                             {
-                                normTable.addForeignKey({pair.first, this->convertRowToTableName(pair.first), pair.first}); // Add the foreign key to the new table
-                                normTable.removePrimaryKey(innerRow.getRowName());                                          // Remove the primary key from the original table
-                                normTable.addPrimaryKey(row.getRowName());                                                  // Add the primary key to the original table
+                                const table::foreign::ForeignKey foreignKey(pair.first, this->convertRowToTableName(pair.first), pair.first);
+                                const std::vector<table::foreign::ForeignKey> foreignKeys = normTable.getForeignKeys();
+
+                                if (std::find(foreignKeys.begin(), foreignKeys.end(), foreignKey) == foreignKeys.end()) // The table may already reference the table split off by an earlier pass
+                                {
+                                    normTable.addForeignKey(foreignKey); // Add the foreign key to the new table
+                                }
+
+                                normTable.removePrimaryKey(innerRow.getRowName()); // Remove the primary key from the original table
+                                normTable.addPrimaryKey(row.getRowName());         // Add the primary key to the original table
 
                                 bool primaryAlreadyIn = false;
 
@@ -400,150 +652,77 @@ namespace normalizer
             }
         }
 
-        for (const auto &pair : newTables) // Add the new tables to the normalized tables
-        {
-            this->normalizedTables.push_back(pair.second);
-        }
+        this->addNewTables(newTables);
     }
 
     void Normalizer::normalizeToFourNF()
     {
-        this->normalizeToBCNF(); // To be in 4NF, it must first be in BCNF
+        decomposition::FourNFDecomposer decomposer(this->basisCalculator, this->getDeclaredDeterminants());
 
-        std::vector<std::pair<std::string, std::string>> multiValuedDependencies = this->getMultiValuedDependencies();
+        std::vector<table::Table> fourNFTables;
 
-        if (multiValuedDependencies.size() == 0)
+        for (const table::Table &normTable : this->normalizedTables)
         {
-            return; // Already in 4NF as there are no multi-valued dependencies
-        }
-
-        std::unordered_map<std::string, table::Table> newTables;
+            const std::vector<dependencies::attribute::AttributeSet> components = decomposer.decompose(this->attributeDictionary.getTableAttributes(normTable));
 
-        for (const auto &pair : multiValuedDependencies)
-        {
-            bool found = false;
-
-            if (newTables.find(pair.first) == newTables.end()) // Create the table if it does not already exist
+            if (components.size() == 1) // Already in 4NF as no multi-valued dependency splits the table
             {
-                newTables[pair.second] = table::Table(this->convertRowToTableName(pair.first + pair.second));
+                fourNFTables.push_back(normTable);
+                continue;
             }
 
-            for (table::Table &normTable : this->normalizedTables)
+            for (const dependencies::attribute::AttributeSet &component : components)
             {
-                for (table::row::TableRow &row : normTable.getTableRows())
-                {
-                    if (row.getRowName() == pair.first) // Check if the row has the bcnf dependency
-                    {
-                        for (const table::row::TableRow &innerRow : normTable.getTableRows())
-                        {
-                            if (innerRow.getRowName() == pair.second) // Find the row that is the bcnf dependency
-                            {
-                                normTable.removePrimaryKey(innerRow.getRowName()); // Remove the primary key from the original table
-
-                                newTables[pair.second].addTableRow(row);           // Add the primary key row to the new table
-                                newTables[pair.second].addTableRow(innerRow);      // Add the multi-valued dependency to the new table
-                                newTables[pair.second].addPrimaryKey(pair.first);  // Add the primary key to the new table
-                                newTables[pair.second].addPrimaryKey(pair.second); // Add the primary key to the new table
-
-                                normTable.removeTableRow(innerRow); // Remove the multi-valued dependency from the original table
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (found)
-                        {
-                            break;
-                        }
-                    }
-                }
-                if (found)
-                {
-                    break;
-                }
+                fourNFTables.push_back(this->createComponentTable(normTable, component));
             }
         }
 
-        for (const auto &pair : newTables) // Add the new tables to the normalized tables
-        {
-            this->normalizedTables.push_back(pair.second);
-        }
+        this->normalizedTables = fourNFTables;
     }
 
     void Normalizer::normalizeToFiveNF()
     {
-        this->normalizeToFourNF(); // To be in 5NF, it must first be in 4NF
+        decomposition::FiveNFDecomposer decomposer(this->closureCache, this->dependencies.getJoinDependencies(this->attributeDictionary));
 
-        std::vector<std::pair<std::string, std::string>> joinDependencies = this->getJoinDependencies();
-
-        if (joinDependencies.size() == 0)
+        if (decomposer.getJoinDependencies().empty())
         {
-            return; // Already in 5NF as there are no join dependencies
+            return; // Already in 5NF as no join dependency was declared
         }
 
-        std::unordered_map<us, table::Table> newTables;
+        const std::vector<std::vector<dependencies::attribute::AttributeSet>> decomposed = decomposer.decompose(this->getNormalizedComponents());
 
-        us tableIndex = 0;
+        std::vector<table::Table> fiveNFTables;
 
-        for (const auto &pair : joinDependencies)
+        for (std::size_t i = 0; i < decomposed.size(); ++i)
         {
-            bool found = false;
-
-            newTables[tableIndex] = table::Table(this->convertRowToTableName(pair.first + pair.second));
-
-            for (table::Table &normTable : this->normalizedTables)
+            if (decomposed[i].size() == 1) // Already in 5NF as every join dependency over the table follows from its keys
             {
-                for (table::row::TableRow &row : normTable.getTableRows())
-                {
-                    if (row.getRowName() == pair.first) // Check if the row has the join dependency
-                    {
-                        for (const table::row::TableRow &innerRow : normTable.getTableRows())
-                        {
-                            if (innerRow.getRowName() == pair.second) // Find the row that is the join dependency
-                            {
-                                newTables[tableIndex].addTableRow(row);             // Add the primary key row to the new table
-                                newTables[tableIndex].addTableRow(innerRow);        // Add the join dependency to the new table
-                                newTables[tableIndex].addPrimaryKey(pair.first);    // Add the primary key to the new table
-                                newTables[tableIndex++].addPrimaryKey(pair.second); // Add the primary key to the new table
+                fiveNFTables.push_back(this->normalizedTables[i]);
+                continue;
+            }
 
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (found)
-                        {
-                            break;
-                        }
-                    }
-                }
-                if (found)
-                {
-                    break;
-                }
+            for (const dependencies::attribute::AttributeSet &component : decomposed[i])
+            {
+                fiveNFTables.push_back(this->createComponentTable(this->normalizedTables[i], component));
             }
         }
 
-        for (const auto &pair : newTables) // Remove the rows and primary keys from the already original table
+        this->normalizedTables = fiveNFTables;
+    }
+
+    std::string Normalizer::printTables(std::vector<table::Table> &tables)
+    {
+        std::string returnValue = "";
+
+        for (table::Table &inTable : tables)
         {
-            for (const auto &newPair : joinDependencies)
+            if (inTable.getTableRows().size() > 1) // If it's <= to 1 then there is no need to print it
             {
-                for (table::Table &normTable : this->normalizedTables)
-                {
-                    for (const table::row::TableRow &row : normTable.getTableRows())
-                    {
-                        if (row.getRowName() == newPair.second) // Check if the row has the join dependency
-                        {
-                            normTable.removePrimaryKey(row.getRowName()); // Remove the primary key from the original table
-                            normTable.removeTableRow(row);                // Remove the join dependency from the original table
-                        }
-                    }
-                }
+                returnValue += this->printTable(inTable) + "\n";
             }
         }
 
-        for (const auto &pair : newTables) // Add the new tables to the normalized tables
-        {
-            this->normalizedTables.push_back(pair.second);
-        }
+        return returnValue;
     }
 
     std::string Normalizer::printTable(table::Table &inTable)
@@ -634,405 +813,243 @@ namespace normalizer
     {
         std::vector<std::string> nonDependentRows;
 
-        std::vector<dependencies::row::DependencyRow> rows = this->dependencies.getDependencyRows();
-
-        const us DEPENDENCY_ROW_SIZE = static_cast<us>(rows.size());
+        dependencies::attribute::AttributeSet multiDependents = this->attributeDictionary.createEmptySet();
 
-        for (us i = 0; i < DEPENDENCY_ROW_SIZE; ++i)
+        for (const dependencies::multivalued::MultivaluedDependency &dependency : this->dependencies.getMultivaluedDependencies(this->attributeDictionary))
         {
-            bool isDependentOnRow = false;
-
-            for (us j = 0; j < DEPENDENCY_ROW_SIZE; ++j) // Loop through the rest of the rows
-            {
-                for (const std::string &singleValued : rows[j].getSingleDependencies())
-                { // Loop through the single valued dependencies and check if dependent on the jth row
-                    if (singleValued == rows[i].getRowName())
-                    {
-                        isDependentOnRow = true;
-                        break;
-                    }
-                }
+            multiDependents |= dependency.getDependent();
+        }
 
-                for (const std::string &multiValued : rows[j].getMultiDependencies())
-                { // Loop through the multi valued dependencies and check if dependent on the jth row
-                    if (multiValued == rows[i].getRowName())
-                    {
-                        isDependentOnRow = true;
-                        break;
-                    }
-                }
-            }
+        for (const dependencies::row::DependencyRow &row : this->dependencies.getDependencyRows())
+        {
+            const us attributeId = this->attributeDictionary.getAttributeId(row.getRowName());
 
-            if (!isDependentOnRow) // If not dependent, add it to the unique rows
+            if (!this->closureMatrix.isDetermined(attributeId) && !multiDependents.containsAttribute(attributeId)) // If not dependent, add it to the unique rows
             {
-                nonDependentRows.push_back(rows[i].getRowName());
+                nonDependentRows.push_back(row.getRowName());
             }
         }
 
         return nonDependentRows;
     }
 
-    std::vector<std::pair<std::string, std::string>> Normalizer::getPartialDependencies()
+    void Normalizer::findKeyViolations(analysis::NormalFormAnalysis &result, const std::vector<table::Table> &tables, const std::vector<std::vector<dependencies::functional::FunctionalDependency>> &dependenciesOfTables)
     {
-        std::vector<std::pair<std::string, std::string>> partialDependencies;
-
-        std::unordered_map<std::string, std::vector<std::string>> primaryKeyDependencies;
+        result.partialDependencies.clear();
+        result.partialDeterminants.clear();
+        result.transitiveDependencies.clear();
+        result.bcnfDependencies.clear();
 
-        std::vector<std::string> primaryKeys = this->table.getPrimaryKeys();
-        std::vector<dependencies::row::DependencyRow> dependencyRows = this->dependencies.getDependencyRows();
-
-        for (us i = 0; i < primaryKeys.size(); ++i)
+        for (std::size_t i = 0; i < tables.size(); ++i)
         {
-            for (us j = 0; j < dependencyRows.size(); ++j)
-            {
-                if (primaryKeys[i] == dependencyRows[j].getRowName())
-                {
-                    bool isPrimaryKey = false;
-
-                    for (const std::string &singleValued : dependencyRows[j].getSingleDependencies())
-                    {
-                        isPrimaryKey = false;
-
-                        for (const std::string &primaryKey : primaryKeys)
-                        {
-                            if (singleValued == primaryKey)
-                            {
-                                isPrimaryKey = true;
-                                break;
-                            }
-                        }
-
-                        if (!isPrimaryKey)
-                        {
-                            primaryKeyDependencies[primaryKeys[i]].push_back(singleValued);
-                        }
-                    }
+            this->findKeyViolations(result, this->attributeDictionary.getTableAttributes(tables[i]), dependenciesOfTables[i]);
+        }
+    }
 
-                    for (const std::string &multiValued : dependencyRows[j].getMultiDependencies())
-                    {
-                        isPrimaryKey = false;
+    void Normalizer::findKeyViolations(analysis::NormalFormAnalysis &result, const dependencies::attribute::AttributeSet &relation, const std::vector<dependencies::functional::FunctionalDependency> &relationDependencies)
+    {
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
 
-                        for (const std::string &primaryKey : primaryKeys)
-                        {
-                            if (multiValued == primaryKey)
-                            {
-                                isPrimaryKey = true;
-                                break;
-                            }
-                        }
-                        if (!isPrimaryKey)
-                        {
-                            primaryKeyDependencies[primaryKeys[i]].push_back(multiValued);
-                        }
-                    }
-                }
-            }
-        } // Get a map of the primary keys and their dependencies
+        const std::vector<dependencies::attribute::AttributeSet> relationKeys = keyFinder.findCandidateKeys(relation, relationDependencies);
 
-        std::unordered_map<std::string, us> dependencyCounts;
+        dependencies::attribute::AttributeSet relationPrimes = this->attributeDictionary.createEmptySet();
 
-        for (const auto &pair : primaryKeyDependencies)
+        for (const dependencies::attribute::AttributeSet &candidateKey : relationKeys)
         {
-            for (const std::string &dependency : pair.second)
-            {
-                if (dependencyCounts.find(dependency) == dependencyCounts.end())
-                {
-                    dependencyCounts[dependency] = 1;
-                }
-                else
-                {
-                    ++dependencyCounts[dependency];
-                }
-            }
-        } // Count how many times each dependency occurs
+            relationPrimes |= candidateKey;
+        }
 
-        for (const auto &dependencyPair : dependencyCounts)
+        std::vector<dependencies::attribute::AttributeSet> compositeDeterminants; // A single row is a superkey when its row of the closure matrix holds the table
+
+        for (const dependencies::functional::FunctionalDependency &dependency : relationDependencies)
         {
-            if (dependencyPair.second != primaryKeys.size()) // If the dependency does not occur in every primary key
+            if (dependency.getDeterminant().count() != 1)
             {
-                for (const auto &pair : primaryKeyDependencies)
-                {
-                    for (const std::string &dependency : pair.second)
-                    {
-                        if (dependency == dependencyPair.first) // If the depenency occurs in this specific primary key add it to the partial dependencies
-                        {
-                            partialDependencies.push_back(std::make_pair(pair.first, dependencyPair.first));
-                        }
-                    }
-                }
+                compositeDeterminants.push_back(dependency.getDeterminant());
             }
         }
 
-        return partialDependencies;
-    }
+        const std::vector<bool> compositeSuperkeys = dependencies::keys::PrimeAttributeService(this->closureCache, relationKeys).areSuperkeys(compositeDeterminants, relation); // The wider left hand sides are checked at once in batched queries
 
-    std::vector<std::pair<std::string, std::string>> Normalizer::getTrasitiveDependencies()
-    {
-        std::vector<std::pair<std::string, std::string>> transitiveDependencies;
+        std::unordered_map<dependencies::attribute::AttributeSet, dependencies::attribute::AttributeSet, dependencies::attribute::AttributeSetHash> listedDependents; // Several rows of a group can start the same transitive dependency
+        std::vector<bool> splitGroups(this->dependencyGraph.getComponents().size(), false);
+        std::size_t nextComposite = 0;
 
-        std::unordered_map<std::string, std::vector<std::string>> primaryKeyDependencies;
+        for (const dependencies::functional::FunctionalDependency &dependency : relationDependencies)
+        {
+            const dependencies::attribute::AttributeSet &determinant = dependency.getDeterminant();
+            const bool singleRow = determinant.count() == 1;
 
-        std::vector<std::string> primaryKeys = this->table.getPrimaryKeys();
-        std::vector<dependencies::row::DependencyRow> dependencyRows = this->dependencies.getDependencyRows();
-        std::vector<std::string> dependencyRowNames;
+            if (singleRow ? relation.isSubsetOf(this->closureMatrix.getClosure(determinant.findFirst())) : compositeSuperkeys[nextComposite++])
+            {
+                continue;
+            }
 
-        for (us i = 0; i < dependencyRows.size(); ++i)
-        {
-            bool isPrimaryKey = false;
+            const dependencies::attribute::AttributeSet nonPrimeDependents = dependency.getDependent() - relationPrimes; // Dependencies onto prime rows are allowed in 2NF and 3NF
 
-            for (us j = 0; j < primaryKeys.size(); ++j)
+            if (determinant.isSubsetOf(relationPrimes)) // Only a part of a candidate key starts a partial dependency
             {
-                if (primaryKeys[j] == dependencyRows[i].getRowName()) // If the row is a primary key, do not add it to check for transitive dependencies
+                for (us dependentId = nonPrimeDependents.findFirst(); dependentId < nonPrimeDependents.getAttributeCount(); dependentId = nonPrimeDependents.findNext(dependentId))
                 {
-                    isPrimaryKey = true;
-                    break;
+                    result.partialDependencies.push_back(std::make_pair(this->attributeDictionary.toString(determinant), this->attributeDictionary.getAttributeName(dependentId)));
                 }
-            }
-            if (!isPrimaryKey)
-            {
-                dependencyRowNames.push_back(dependencyRows[i].getRowName()); // Get a list of all the dependency row names
-            }
-        }
 
-        for (us i = 0; i < dependencyRowNames.size(); ++i)
-        {
-            for (us j = 0; j < dependencyRows.size(); ++j)
-            {
-                if (dependencyRowNames[i] != dependencyRows[j].getRowName())
+                if (!nonPrimeDependents.isEmpty() && std::find(result.partialDeterminants.begin(), result.partialDeterminants.end(), determinant) == result.partialDeterminants.end())
+                {
+                    result.partialDeterminants.push_back(determinant);
+                }
+
+                if (!singleRow)
                 {
                     continue;
                 }
-                else
+
+                const us attributeId = determinant.findFirst(); // With only single rows on the left hand side, a dependency left to BCNF goes to a prime row that determines it back, so it lies within a group of prime rows that is not a superkey
+                const ui group = this->dependencyGraph.getComponentIndex(attributeId);
+                const us representativeId = (this->dependencyGraph.getEquivalentAttributes(attributeId) & relation).findFirst();
+
+                if (attributeId != representativeId && !splitGroups[group]) // Each group is split once, from the first other row of it that starts a dependency to the first row the group stands in as
                 {
-                    bool isPrimaryKey = false;
+                    splitGroups[group] = true;
 
-                    for (const std::string &singleValued : dependencyRows[j].getSingleDependencies())
-                    {
-                        isPrimaryKey = false;
+                    result.bcnfDependencies.push_back(std::make_pair(this->attributeDictionary.getAttributeName(attributeId), this->attributeDictionary.getAttributeName(representativeId)));
+                }
 
-                        for (const std::string &primaryKey : primaryKeys) // If the dependency of the row is a primary key, do not add it to check for transitive dependencies
-                        {
-                            if (primaryKey == singleValued)
-                            {
-                                isPrimaryKey = true;
-                                break;
-                            }
-                        }
+                continue;
+            }
 
-                        if (!isPrimaryKey)
-                        {
-                            transitiveDependencies.push_back(std::make_pair(dependencyRowNames[i], singleValued));
-                        }
-                    }
+            dependencies::attribute::AttributeSet source = determinant;
+            dependencies::attribute::AttributeSet dependents = nonPrimeDependents;
 
-                    for (const std::string &multiValued : dependencyRows[j].getMultiDependencies())
-                    {
-                        isPrimaryKey = false;
+            if (singleRow) // A group of rows that determine each other is one row of the condensation, so the group stands in as its first row, which takes the dependencies of the whole group
+            {
+                const dependencies::attribute::AttributeSet equivalentRows = this->dependencyGraph.getEquivalentAttributes(determinant.findFirst()) & relation;
 
-                        for (const std::string &primaryKey : primaryKeys) // If the dependency of the row is a primary key, do not add it to check for transitive dependencies
-                        {
-                            if (primaryKey == multiValued)
-                            {
-                                isPrimaryKey = true;
-                                break;
-                            }
-                        }
+                source = this->attributeDictionary.createEmptySet();
+                source.addAttribute(equivalentRows.findFirst());
+                dependents = (dependents | equivalentRows) - source;
+            }
 
-                        if (!isPrimaryKey)
-                        {
-                            transitiveDependencies.push_back(std::make_pair(dependencyRowNames[i], multiValued));
-                        }
-                    }
+            const auto listed = listedDependents.try_emplace(source, source.getAttributeCount()).first;
 
-                    break;
-                }
+            dependents -= listed->second;
+            listed->second |= dependents;
+
+            for (us dependentId = dependents.findFirst(); dependentId < dependents.getAttributeCount(); dependentId = dependents.findNext(dependentId))
+            {
+                result.transitiveDependencies.push_back(std::make_pair(this->attributeDictionary.toString(source), this->attributeDictionary.getAttributeName(dependentId)));
             }
         }
-
-        return transitiveDependencies;
     }
 
-    std::vector<std::pair<std::string, std::string>> Normalizer::getBCNFDependencies()
+    std::vector<std::pair<std::string, std::string>> Normalizer::getMultiValuedDependencies()
     {
-        std::vector<std::pair<std::string, std::string>> bcnfDependencies;
-
-        std::unordered_map<std::string, std::vector<std::string>> primaryKeyDependencies;
+        std::vector<std::pair<std::string, std::string>> multiValuedDependencies;
 
-        std::vector<std::string> primaryKeys = this->table.getPrimaryKeys();
-        std::vector<dependencies::row::DependencyRow> dependencyRows = this->dependencies.getDependencyRows();
-        std::vector<std::string> dependencyRowNames;
+        decomposition::FourNFDecomposer decomposer(this->basisCalculator, this->getDeclaredDeterminants());
 
-        for (us i = 0; i < dependencyRows.size(); ++i)
+        for (const dependencies::multivalued::MultivaluedDependency &violation : decomposer.findMultivaluedViolations(this->attributeDictionary.getTableAttributes(this->table)))
         {
-            bool isPrimaryKey = false;
-
-            for (us j = 0; j < primaryKeys.size(); ++j)
+            for (const std::string &multiValued : this->attributeDictionary.toRowNames(violation.getDependent()))
             {
-                if (primaryKeys[j] == dependencyRows[i].getRowName()) // If the row is a primary key, do not add it to check for transitive dependencies
-                {
-                    isPrimaryKey = true;
-                    break;
-                }
-            }
-            if (!isPrimaryKey)
-            {
-                dependencyRowNames.push_back(dependencyRows[i].getRowName()); // Get a list of all the dependency row names
+                multiValuedDependencies.push_back(std::make_pair(this->attributeDictionary.toString(violation.getDeterminant()), multiValued));
             }
         }
 
-        for (us i = 0; i < dependencyRowNames.size(); ++i)
+        return multiValuedDependencies;
+    }
+
+    std::vector<dependencies::attribute::AttributeSet> Normalizer::getDeclaredDeterminants() const
+    {
+        std::vector<dependencies::attribute::AttributeSet> determinants;
+
+        for (const dependencies::functional::FunctionalDependency &dependency : this->closureCache.getCalculator().getFunctionalDependencies())
         {
-            for (us j = 0; j < dependencyRows.size(); ++j)
-            {
-                if (dependencyRowNames[i] != dependencyRows[j].getRowName())
-                {
-                    continue;
-                }
-                else
-                {
-                    bool isPrimaryKey = false;
+            determinants.push_back(dependency.getDeterminant());
+        }
 
-                    for (const std::string &singleValued : dependencyRows[j].getSingleDependencies())
-                    {
-                        isPrimaryKey = false;
+        for (const dependencies::multivalued::MultivaluedDependency &dependency : this->dependencies.getMultivaluedDependencies(this->attributeDictionary))
+        {
+            determinants.push_back(dependency.getDeterminant());
+        }
 
-                        for (const std::string &primaryKey : primaryKeys) // If the dependency of the row is a primary key, do not add it to check for transitive dependencies
-                        {
-                            if (primaryKey == singleValued)
-                            {
-                                isPrimaryKey = true;
-                                bcnfDependencies.push_back(std::make_pair(dependencyRowNames[i], singleValued));
+        return determinants;
+    }
 
-                                break;
-                            }
-                        }
-                    }
+    table::Table Normalizer::createComponentTable(const table::Table &sourceTable, const dependencies::attribute::AttributeSet &component)
+    {
+        std::string rowNames;
 
-                    break;
-                }
-            }
+        for (const std::string &rowName : this->attributeDictionary.toRowNames(component))
+        {
+            rowNames += rowName;
         }
 
-        return bcnfDependencies;
+        dependencies::keys::CandidateKeyFinder keyFinder(this->closureCache);
+
+        return this->createComponentTable(sourceTable, component, this->convertRowToTableName(rowNames), keyFinder.minimizeSuperkey(component, component));
     }
 
-    std::vector<std::pair<std::string, std::string>> Normalizer::getMultiValuedDependencies()
+    table::Table Normalizer::createComponentTable(const table::Table &sourceTable, const dependencies::attribute::AttributeSet &component, const std::string &tableName, const dependencies::attribute::AttributeSet &primaryKey)
     {
-        std::vector<std::pair<std::string, std::string>> multiValuedDependencies;
+        table::Table componentTable(tableName);
 
-        std::unordered_map<std::string, std::vector<std::string>> primaryKeyDependencies;
+        for (const table::row::TableRow &row : sourceTable.getTableRows())
+        {
+            if (!this->attributeDictionary.containsAttribute(row.getRowName()) || !component.containsAttribute(this->attributeDictionary.getAttributeId(row.getRowName())))
+            {
+                continue;
+            }
 
-        std::vector<std::string> primaryKeys = this->table.getPrimaryKeys();
-        std::vector<dependencies::row::DependencyRow> dependencyRows = this->dependencies.getDependencyRows();
-        std::vector<std::string> dependencyRowNames;
+            componentTable.addTableRow(row);
 
-        if (primaryKeys.size() > 1) // If it's equal to 1, then the key is a super key and thus it would be in 4NF
-        {
-            for (us i = 0; i < dependencyRows.size(); ++i)
+            if (primaryKey.containsAttribute(this->attributeDictionary.getAttributeId(row.getRowName())))
             {
-                dependencyRowNames.push_back(dependencyRows[i].getRowName()); // Get a list of all the dependency row names
+                componentTable.addPrimaryKey(row.getRowName());
             }
+        }
 
-            for (us i = 0; i < dependencyRowNames.size(); ++i)
+        for (const table::foreign::ForeignKey &foreignKey : sourceTable.getForeignKeys())
+        {
+            if (this->attributeDictionary.containsAttribute(foreignKey.getTableRow()) && component.containsAttribute(this->attributeDictionary.getAttributeId(foreignKey.getTableRow())))
             {
-                for (us j = 0; j < dependencyRows.size(); ++j)
-                {
-                    if (dependencyRowNames[i] != dependencyRows[j].getRowName())
-                    {
-                        continue;
-                    }
-                    else
-                    {
-                        if (dependencyRows[j].getMultiDependencies().size() > 1) // Requires two independent 1:N relationships A:B and A:C
-                        {
-                            for (const std::string &multiValued : dependencyRows[j].getMultiDependencies())
-                            {
-                                multiValuedDependencies.push_back(std::make_pair(dependencyRowNames[i], multiValued));
-                            }
-                        }
-                    }
-                }
+                componentTable.addForeignKey(foreignKey);
             }
         }
 
-        return multiValuedDependencies;
+        return componentTable;
     }
 
-    std::vector<std::pair<std::string, std::string>> Normalizer::getJoinDependencies()
+    void Normalizer::addNewTables(const std::unordered_map<std::string, table::Table> &newTables)
     {
-        std::vector<std::pair<std::string, std::string>> joinDependencies;
-
-        std::unordered_map<std::string, std::vector<std::string>> primaryKeyDependencies;
-
-        std::vector<std::string> primaryKeys = this->table.getPrimaryKeys();
-        std::vector<dependencies::row::DependencyRow> dependencyRows = this->dependencies.getDependencyRows();
-        std::vector<std::string> dependencyRowNames;
-
-        std::unordered_map<std::string, std::vector<std::string>> dependencyList;
-
-        for (us i = 0; i < dependencyRows.size(); ++i)
+        for (const auto &pair : newTables)
         {
-            dependencyRowNames.push_back(dependencyRows[i].getRowName()); // Get a list of all the dependency row names
-        }
+            auto existing = std::find_if(this->normalizedTables.begin(), this->normalizedTables.end(), [&pair](const table::Table &normTable)
+                                         { return normTable.getTableName() == pair.second.getTableName(); });
 
-        for (us i = 0; i < dependencyRowNames.size(); ++i)
-        {
-            for (us j = 0; j < dependencyRows.size(); ++j)
+            if (existing == this->normalizedTables.end())
             {
-                if (dependencyRowNames[i] != dependencyRows[j].getRowName())
-                {
-                    continue;
-                }
-                else
-                {
-                    for (const std::string &singleValued : dependencyRows[j].getSingleDependencies())
-                    {
-                        dependencyList[dependencyRowNames[i]].push_back(singleValued); // Add the single valued dependencies to the dependency list
-                    }
-
-                    break;
-                }
+                this->normalizedTables.push_back(pair.second);
+                continue;
             }
-        }
 
-        for (const auto &pair : dependencyList)
-        {
-            if (pair.second.size() > 1) // If the dependency list is not more than 1, then it the cause of the join dependency
+            for (const table::row::TableRow &row : pair.second.getTableRows()) // An earlier pass already split off a table keyed on the same row
             {
-                std::vector<std::string> potentialJoinDependecies = pair.second;
+                const std::vector<table::row::TableRow> &existingRows = existing->getTableRows();
 
-                for (const auto &newPair : dependencyList) // Loop again through the dependency list to find join dependencies
+                if (std::find(existingRows.begin(), existingRows.end(), row) == existingRows.end())
                 {
-                    if (newPair.first == pair.first)
-                    {
-                        continue;
-                    }
-
-                    for (const std::string &potentialJoinDependency : potentialJoinDependecies)
-                    {
-                        if (newPair.first == potentialJoinDependency) // If the row is in the list of potential join dependencies
-                        {
-                            for (const std::string &singleValued : newPair.second) // Loop over the dependencies of the row
-                            {
-                                for (const std::string &newPotential : potentialJoinDependecies) // Loop over the potential join dependencies to figure out if the dependencies of the above row are also in the list of potential join dependencies
-                                {
-                                    if (singleValued == newPotential) // If in the list, there is a join dependency
-                                    {
-                                        joinDependencies.push_back(std::make_pair(pair.first, newPair.first)); // Add the row that has both newPair.first and singleValued as a dependency
-
-                                        joinDependencies.push_back(std::make_pair(pair.first, singleValued));
-
-                                        joinDependencies.push_back(std::make_pair(newPair.first, singleValued)); // Add the row that is dependent on pair.first but also determines singleValued
-                                    }
-                                }
-                            }
-                        }
-                    }
+                    existing->addTableRow(row);
                 }
             }
         }
+    }
 
-        return joinDependencies;
+    std::vector<dependencies::join::JoinDependency> Normalizer::getJoinDependencies()
+    {
+        decomposition::FiveNFDecomposer decomposer(this->closureCache, this->dependencies.getJoinDependencies(this->attributeDictionary));
+
+        return decomposer.findViolations(this->attributeDictionary.getTableAttributes(this->table));
     }
 
     std::string Normalizer::convertRowToTableName(const std::string &rowName) const
@@ -1050,86 +1067,56 @@ namespace normalizer
         return tableName;
     }
 
-    void Normalizer::createTableOnCompositeKey()
-    {
-        std::string compositeTableName;
-        std::vector<table::row::TableRow> primaryKeyRows;
-
-        for (const std::string &primaryKey : this->table.getPrimaryKeys()) // Appends all the primary keys together
-        {
-            compositeTableName += primaryKey;
-
-            for (const table::row::TableRow &row : this->table.getTableRows()) // Gets the rows for the primary key
-            {
-                if (row.getRowName() == primaryKey)
-                {
-                    primaryKeyRows.push_back(row);
-                }
-            }
-        }
-
-        compositeTableName += "Table";
-
-        table::Table compositeTable(compositeTableName);
-
-        for (const table::row::TableRow &primaryKeyRow : primaryKeyRows)
-        {
-            compositeTable.addTableRow(primaryKeyRow);
-
-            std::string rowName = primaryKeyRow.getRowName();
-
-            compositeTable.addForeignKey({rowName, this->convertRowToTableName(rowName), rowName});
-        }
-
-        this->normalizedTables.push_back(compositeTable);
-    }
-
     us Normalizer::getHighestNormalizedForm()
     {
-        if (!this->determineInOneNF())
-        {
-            return 0;
-        }
+        return this->analyze().highestForm;
+    }
 
-        if (this->getPartialDependencies().size() > 0)
-        {
-            return 1;
-        }
+    /* Operator Overloads */
 
-        if (this->getTrasitiveDependencies().size() > 0)
-        {
-            return 2;
-        }
+    std::ostream &operator<<(std::ostream &outputStream, Normalizer &normalizer)
+    {
+        outputStream << normalizer.printTables(normalizer.getNormalizedTables());
 
-        if (this->getMultiValuedDependencies().size() > 0)
+        if (normalizer.getHighestForm)
         {
-            return 3;
+            outputStream << std::endl
+                         << "The highest normalized form of the table is: " << normalizer.getHighestNormalizedForm() << std::endl;
         }
 
-        if (this->getJoinDependencies().size() > 0)
+        if (normalizer.verifyDecomposition)
         {
-            return 4;
-        }
+            outputStream << std::endl;
 
-        return 5;
-    }
+            if (normalizer.joinResult == verification::JoinResult::INCONCLUSIVE)
+            {
+                outputStream << "Whether the normalized tables join back losslessly could not be decided within " << verification::CHASE_ROW_LIMIT << " rows of the chase" << std::endl;
+            }
+            else
+            {
+                outputStream << "The normalized tables " << (normalizer.joinResult == verification::JoinResult::LOSSLESS ? "join back losslessly" : "do not join back losslessly") << std::endl;
+            }
 
-    /* Operator Overloads */
+            if (!normalizer.uncoveredAttributes.isEmpty())
+            {
+                outputStream << "Rows missing from the normalized tables: " << normalizer.attributeDictionary.toString(normalizer.uncoveredAttributes) << std::endl;
+            }
 
-    std::ostream &operator<<(std::ostream &outputStream, Normalizer &normalizer)
-    {
-        for (table::Table &table : normalizer.getNormalizedTables())
-        {
-            if (table.getTableRows().size() > 1) // If it's <= to 1 then there is no need to print it
+            if (normalizer.lostDependencies.empty())
             {
-                outputStream << normalizer.printTable(table) << std::endl;
+                outputStream << "The normalized tables preserve every dependency" << std::endl;
             }
-        }
+            else
+            {
+                outputStream << "Dependencies not preserved by the normalized tables:" << std::endl;
 
-        if (normalizer.getHighestForm)
-        {
-            outputStream << std::endl
-                         << "The highest normalized form of the table is: " << normalizer.getHighestNormalizedForm() << std::endl;
+                for (const dependencies::functional::FunctionalDependency &dependency : normalizer.lostDependencies)
+                {
+                    outputStream << "\t" << dependency.toString(normalizer.attributeDictionary) << std::endl;
+                }
+            }
+
+            outputStream << "Closure cache: " << normalizer.closureCache.getHitCount() << " hits, " << normalizer.closureCache.getMissCount() << " misses" << std::endl;
         }
 
         return outputStream;
@@ -0,0 +1,59 @@
+/*! \file parallelRunner.cpp
+    \brief C++ file for running a task over a range of indices across threads.
+    \details Contains the function definitions for splitting a range of indices into one contiguous chunk per thread and carrying the errors of the threads back to the caller
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Parallel/parallelRunner.h"
+
+namespace normalizer::parallel
+{
+    /* Static Functions */
+
+    void ParallelRunner::run(const std::size_t count, const std::size_t indicesPerThread, const std::function<void(std::size_t, std::size_t)> &task)
+    {
+        const std::size_t grainSize = std::max<std::size_t>(indicesPerThread, 1);
+        const std::size_t threadCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), (count + grainSize - 1) / grainSize);
+
+        if (threadCount <= 1)
+        {
+            task(0, count);
+            return;
+        }
+
+        const std::size_t chunkSize = (count + threadCount - 1) / threadCount;
+        const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+        std::vector<std::exception_ptr> errors(chunkCount); // One per thread, so no thread waits on another to report
+        std::vector<std::thread> threads;
+
+        for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            threads.emplace_back([chunk, chunkSize, count, &errors, &task]()
+                                 {
+                                     try
+                                     {
+                                         task(chunk * chunkSize, std::min((chunk + 1) * chunkSize, count));
+                                     }
+                                     catch (...)
+                                     {
+                                         errors[chunk] = std::current_exception();
+                                     } });
+        }
+
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const std::exception_ptr &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
@@ -0,0 +1,381 @@
+/*! \file externalPartitioner.cpp
+    \brief C++ file for splitting the rows of a CSV data file into partitions that each fit in memory.
+    \details Contains the function definitions for spilling the rows of a CSV data file to disk in partitions by a key, and reading the partitions back one at a time under a memory limit
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Table/External/externalPartitioner.h"
+
+namespace normalizer::table::external
+{
+    /* Constructors and Destructors */
+
+    ExternalPartitioner::ExternalPartitioner(const std::string &csvPath, const std::string &inTemporaryPath, const ul inMemoryLimit) : reader(csvPath), temporaryPath(inTemporaryPath), memoryLimit(inMemoryLimit), partitionCount(0), spilledBytes(0)
+    {
+        file::FileValidator::validateDirectoryPath(inTemporaryPath);
+    }
+
+    /* Getters and Setters */
+
+    ul ExternalPartitioner::getMemoryLimit() const
+    {
+        return this->memoryLimit;
+    }
+
+    ul ExternalPartitioner::getPartitionCount() const
+    {
+        return this->partitionCount;
+    }
+
+    ul ExternalPartitioner::getSpilledBytes() const
+    {
+        return this->spilledBytes;
+    }
+
+    /* Member Functions */
+
+    void ExternalPartitioner::forEachPartition(const std::vector<std::string> &columnNames, const std::vector<us> &keyColumns, const std::function<void(const instance::TableInstance &, const std::vector<ul> &)> &visit)
+    {
+        const std::vector<std::string> fileColumnNames = this->reader.readColumnNames();
+
+        std::vector<us> columns;
+        std::vector<us> fileKeyColumns;
+
+        for (const std::string &name : columnNames)
+        {
+            const auto found = std::find(fileColumnNames.begin(), fileColumnNames.end(), name);
+
+            if (found == fileColumnNames.end())
+            {
+                throw std::invalid_argument(MISSING_DATA_COLUMN + name);
+            }
+
+            columns.push_back(static_cast<us>(found - fileColumnNames.begin()));
+        }
+
+        for (const us keyColumn : keyColumns)
+        {
+            fileKeyColumns.push_back(columns[keyColumn]);
+        }
+
+        const ul fileBytes = std::filesystem::file_size(this->reader.getPath());
+
+        if (fileBytes * EXTERNAL_MEMORY_FACTOR <= this->memoryLimit || keyColumns.empty()) // A key of no columns puts every row in the same partition
+        {
+            const instance::TableInstance instance = this->reader.read().selectColumns(columnNames);
+
+            std::vector<ul> rows(instance.getRowCount(), 0);
+            std::iota(rows.begin(), rows.end(), 0);
+
+            ++this->partitionCount;
+            visit(instance, rows);
+            return;
+        }
+
+        const file::TemporaryDirectory directory(this->temporaryPath);
+
+        const std::size_t fanout = this->countPartitions(fileBytes);
+
+        std::vector<std::string> paths;
+
+        for (std::size_t i = 0; i < fanout; ++i)
+        {
+            paths.push_back(directory.createFilePath("partition-" + std::to_string(i)));
+        }
+
+        this->spillFile(columns, fileKeyColumns, paths);
+
+        for (const std::string &path : paths)
+        {
+            this->visitPartition(path, columnNames, keyColumns, 1, visit);
+        }
+    }
+
+    ul ExternalPartitioner::parseMemoryLimit(const std::string &text)
+    {
+        std::size_t digits = 0;
+        ul bytes = 0;
+
+        for (; digits < text.size() && std::isdigit(static_cast<unsigned char>(text[digits])); ++digits)
+        {
+            const ul digit = static_cast<ul>(text[digits] - '0');
+
+            if (bytes > (std::numeric_limits<ul>::max() - digit) / DECIMAL_BASE)
+            {
+                return 0;
+            }
+
+            bytes = bytes * DECIMAL_BASE + digit;
+        }
+
+        if (digits == 0 || text.size() > digits + 1)
+        {
+            return 0;
+        }
+
+        us shift = 0;
+
+        if (digits < text.size())
+        {
+            switch (std::toupper(static_cast<unsigned char>(text[digits])))
+            {
+            case 'K':
+                shift = 10;
+                break;
+            case 'M':
+                shift = 20;
+                break;
+            case 'G':
+                shift = 30;
+                break;
+            default:
+                return 0;
+            }
+        }
+
+        return bytes > (std::numeric_limits<ul>::max() >> shift) ? 0 : bytes << shift;
+    }
+
+    std::size_t ExternalPartitioner::countPartitions(const ul bytes) const
+    {
+        const ul neededCount = (bytes * EXTERNAL_MEMORY_FACTOR + this->memoryLimit - 1) / std::max<ul>(this->memoryLimit, 1);
+
+        return static_cast<std::size_t>(std::min<ul>(std::bit_ceil(std::max<ul>(neededCount, 2)), EXTERNAL_MAX_FANOUT));
+    }
+
+    void ExternalPartitioner::spillFile(const std::vector<us> &columns, const std::vector<us> &keyColumns, const std::vector<std::string> &paths)
+    {
+        const std::size_t fanout = paths.size();
+        const std::size_t chunksPerWindow = std::clamp<std::size_t>(this->memoryLimit / (EXTERNAL_MEMORY_FACTOR * file::CSV_CHUNK_BYTES), 1, std::max(std::thread::hardware_concurrency(), 1U)); // Each chunk of a window is held in memory as its text and again as its records
+
+        std::vector<std::ofstream> outputs;
+
+        for (const std::string &path : paths)
+        {
+            outputs.push_back(ExternalPartitioner::openPartition(path));
+        }
+
+        std::vector<std::vector<std::string>> records(chunksPerWindow, std::vector<std::string>(fanout));
+        std::vector<ui> chunkRows(chunksPerWindow, 0);
+        ul firstRow = 0;
+
+        this->reader.scan(
+            chunksPerWindow, [&columns, &keyColumns, fanout, &records, &chunkRows](const std::size_t chunk, const std::vector<std::string> &values)
+            { ExternalPartitioner::appendRecord(records[chunk][ExternalPartitioner::choosePartition(values, keyColumns, 0, fanout)], chunkRows[chunk]++, values, columns); },
+            [this, fanout, &outputs, &records, &chunkRows, &firstRow](const std::size_t chunkCount)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) // Written in the order of the chunks, so every partition holds its rows in order
+                {
+                    for (std::size_t partition = 0; partition < fanout; ++partition)
+                    {
+                        if (!records[chunk][partition].empty())
+                        {
+                            this->writeSegment(outputs[partition], firstRow, records[chunk][partition]);
+                            records[chunk][partition].clear();
+                        }
+                    }
+
+                    firstRow += chunkRows[chunk];
+                    chunkRows[chunk] = 0;
+                }
+            });
+
+        ExternalPartitioner::closePartitions(outputs, paths);
+    }
+
+    void ExternalPartitioner::visitPartition(const std::string &path, const std::vector<std::string> &columnNames, const std::vector<us> &keyColumns, const us depth, const std::function<void(const instance::TableInstance &, const std::vector<ul> &)> &visit)
+    {
+        const ul bytes = std::filesystem::file_size(path);
+
+        if (bytes == 0) // No key hashed to the partition
+        {
+            std::filesystem::remove(path);
+            return;
+        }
+
+        std::ifstream input(path, std::ios::binary);
+
+        if (!input.is_open())
+        {
+            throw std::filesystem::filesystem_error(file::FILE_DID_NOT_OPEN, path, std::make_error_code(std::errc::io_error));
+        }
+
+        std::string records;
+        std::vector<std::string> values(columnNames.size());
+        ul firstRow = 0;
+        ui localRow = 0;
+
+        if (bytes * EXTERNAL_MEMORY_FACTOR > this->memoryLimit && depth < EXTERNAL_MAX_DEPTH) // Too many rows share the top bits of their hash, so the next bits of another hash split them
+        {
+            const std::size_t fanout = this->countPartitions(bytes);
+
+            std::vector<us> columns(columnNames.size(), 0);
+            std::iota(columns.begin(), columns.end(), 0);
+
+            std::vector<std::string> paths;
+            std::vector<std::ofstream> outputs;
+            std::vector<std::string> partitionRecords(fanout);
+
+            for (std::size_t i = 0; i < fanout; ++i)
+            {
+                paths.push_back(path + "-" + std::to_string(i));
+                outputs.push_back(ExternalPartitioner::openPartition(paths.back()));
+            }
+
+            while (ExternalPartitioner::readSegment(input, firstRow, records))
+            {
+                for (std::size_t position = 0; position < records.size();)
+                {
+                    position = ExternalPartitioner::readRecord(records, position, localRow, values);
+                    ExternalPartitioner::appendRecord(partitionRecords[ExternalPartitioner::choosePartition(values, keyColumns, depth, fanout)], localRow, values, columns);
+                }
+
+                for (std::size_t partition = 0; partition < fanout; ++partition)
+                {
+                    if (!partitionRecords[partition].empty())
+                    {
+                        this->writeSegment(outputs[partition], firstRow, partitionRecords[partition]);
+                        partitionRecords[partition].clear();
+                    }
+                }
+            }
+
+            ExternalPartitioner::closePartitions(outputs, paths);
+
+            input.close();
+            std::filesystem::remove(path);
+
+            for (const std::string &partitionPath : paths)
+            {
+                this->visitPartition(partitionPath, columnNames, keyColumns, static_cast<us>(depth + 1), visit);
+            }
+
+            return;
+        }
+
+        instance::TableInstance instance(columnNames);
+        std::vector<ul> rows;
+
+        while (ExternalPartitioner::readSegment(input, firstRow, records))
+        {
+            for (std::size_t position = 0; position < records.size();)
+            {
+                position = ExternalPartitioner::readRecord(records, position, localRow, values);
+
+                instance.addRow(values);
+                rows.push_back(firstRow + localRow);
+            }
+        }
+
+        input.close();
+        std::filesystem::remove(path);
+
+        ++this->partitionCount;
+        visit(instance, rows);
+    }
+
+    std::ofstream ExternalPartitioner::openPartition(const std::string &path)
+    {
+        std::ofstream output(path, std::ios::binary);
+
+        if (!output.is_open())
+        {
+            throw std::filesystem::filesystem_error(file::FILE_DID_NOT_OPEN, path, std::make_error_code(std::errc::io_error));
+        }
+
+        return output;
+    }
+
+    void ExternalPartitioner::closePartitions(std::vector<std::ofstream> &outputs, const std::vector<std::string> &paths)
+    {
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            outputs[i].close();
+
+            if (outputs[i].fail()) // Most likely the disk filled up
+            {
+                throw std::filesystem::filesystem_error(file::FILE_NOT_WRITTEN, paths[i], std::make_error_code(std::errc::io_error));
+            }
+        }
+    }
+
+    void ExternalPartitioner::writeSegment(std::ofstream &output, const ul firstRow, const std::string &records)
+    {
+        const ul byteCount = records.size();
+
+        output.write(reinterpret_cast<const char *>(&firstRow), sizeof(firstRow));
+        output.write(reinterpret_cast<const char *>(&byteCount), sizeof(byteCount));
+        output.write(records.data(), static_cast<std::streamsize>(byteCount));
+
+        this->spilledBytes += sizeof(firstRow) + sizeof(byteCount) + byteCount;
+    }
+
+    bool ExternalPartitioner::readSegment(std::ifstream &input, ul &firstRow, std::string &records)
+    {
+        if (!input.read(reinterpret_cast<char *>(&firstRow), sizeof(firstRow)))
+        {
+            return false;
+        }
+
+        ul byteCount = 0;
+
+        if (input.read(reinterpret_cast<char *>(&byteCount), sizeof(byteCount)))
+        {
+            records.resize(byteCount);
+            input.read(records.data(), static_cast<std::streamsize>(byteCount));
+        }
+
+        if (!input) // Only a partition file cut short ends inside a segment
+        {
+            throw std::filesystem::filesystem_error(file::FILE_DID_NOT_OPEN, std::make_error_code(std::errc::io_error));
+        }
+
+        return true;
+    }
+
+    void ExternalPartitioner::appendRecord(std::string &records, const ui localRow, const std::vector<std::string> &values, const std::vector<us> &columns)
+    {
+        records.append(reinterpret_cast<const char *>(&localRow), sizeof(localRow));
+
+        for (const us column : columns)
+        {
+            const ui length = static_cast<ui>(values[column].size());
+
+            records.append(reinterpret_cast<const char *>(&length), sizeof(length));
+            records += values[column];
+        }
+    }
+
+    std::size_t ExternalPartitioner::readRecord(const std::string &records, std::size_t position, ui &localRow, std::vector<std::string> &values)
+    {
+        std::memcpy(&localRow, records.data() + position, sizeof(localRow));
+        position += sizeof(localRow);
+
+        for (std::string &value : values)
+        {
+            ui length = 0;
+
+            std::memcpy(&length, records.data() + position, sizeof(length));
+            position += sizeof(length);
+
+            value.assign(records, position, length);
+            position += length;
+        }
+
+        return position;
+    }
+
+    std::size_t ExternalPartitioner::choosePartition(const std::vector<std::string> &values, const std::vector<us> &keyColumns, const ul seed, const std::size_t fanout)
+    {
+        ul hash = seed;
+
+        for (const us column : keyColumns)
+        {
+            hash ^= std::hash<std::string>{}(values[column]) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        }
+
+        return static_cast<std::size_t>((hash * 0xff51afd7ed558ccdULL) >> (64 - std::countr_zero(fanout))); // The top bits of the product depend on every bit of the hash
+    }
+}
@@ -0,0 +1,126 @@
+/*! \file tableInstance.cpp
+    \brief C++ file for the rows of data of a table.
+    \details Contains the function definitions for storing the rows of a table column by column, with every value replaced by a small identifier
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Table/Instance/tableInstance.h"
+
+namespace normalizer::table::instance
+{
+    /* Constructors and Destructors */
+
+    TableInstance::TableInstance(const std::vector<std::string> &inColumnNames) : columnNames(inColumnNames), columns(inColumnNames.size()), columnValues(inColumnNames.size()), valueIds(inColumnNames.size()), rowCount(0) {}
+
+    TableInstance::TableInstance(const std::vector<std::string> &inColumnNames, std::vector<std::vector<ui>> &&inColumns, std::vector<std::vector<std::string>> &&inColumnValues) : columnNames(inColumnNames), columns(std::move(inColumns)), columnValues(std::move(inColumnValues)), valueIds(inColumnNames.size()), rowCount(0)
+    {
+        if (this->columns.size() != this->columnNames.size() || this->columnValues.size() != this->columnNames.size())
+        {
+            throw std::invalid_argument(ROW_WIDTH_MISMATCH);
+        }
+
+        if (!this->columns.empty())
+        {
+            this->rowCount = static_cast<ui>(this->columns[0].size());
+        }
+
+        for (const std::vector<ui> &column : this->columns)
+        {
+            if (column.size() != this->rowCount)
+            {
+                throw std::invalid_argument(ROW_WIDTH_MISMATCH);
+            }
+        }
+    }
+
+    /* Getters and Setters */
+
+    const std::vector<std::string> &TableInstance::getColumnNames() const
+    {
+        return this->columnNames;
+    }
+
+    us TableInstance::getColumnCount() const
+    {
+        return static_cast<us>(this->columnNames.size());
+    }
+
+    ui TableInstance::getRowCount() const
+    {
+        return this->rowCount;
+    }
+
+    const std::vector<ui> &TableInstance::getColumn(const us column) const
+    {
+        return this->columns[column];
+    }
+
+    ui TableInstance::getDistinctCount(const us column) const
+    {
+        return static_cast<ui>(this->columnValues[column].size());
+    }
+
+    const std::string &TableInstance::getValue(const ui row, const us column) const
+    {
+        return this->columnValues[column][this->columns[column][row]];
+    }
+
+    const std::string &TableInstance::getDistinctValue(const us column, const ui id) const
+    {
+        return this->columnValues[column][id];
+    }
+
+    /* Member Functions */
+
+    void TableInstance::addRow(const std::vector<std::string> &values)
+    {
+        if (values.size() != this->columnNames.size())
+        {
+            throw std::invalid_argument(ROW_WIDTH_MISMATCH);
+        }
+
+        for (std::size_t column = 0; column < values.size(); ++column)
+        {
+            for (std::size_t id = this->valueIds[column].size(); id < this->columnValues[column].size(); ++id) // Columns that came encoded are only indexed once a row is added to them
+            {
+                this->valueIds[column].emplace(this->columnValues[column][id], static_cast<ui>(id));
+            }
+
+            const auto inserted = this->valueIds[column].emplace(values[column], static_cast<ui>(this->columnValues[column].size()));
+
+            if (inserted.second) // First row with this value
+            {
+                this->columnValues[column].push_back(values[column]);
+            }
+
+            this->columns[column].push_back(inserted.first->second);
+        }
+
+        ++this->rowCount;
+    }
+
+    TableInstance TableInstance::selectColumns(const std::vector<std::string> &names) const
+    {
+        std::vector<std::vector<ui>> selectedColumns;
+        std::vector<std::vector<std::string>> selectedValues;
+
+        for (const std::string &name : names)
+        {
+            const auto found = std::find(this->columnNames.begin(), this->columnNames.end(), name);
+
+            if (found == this->columnNames.end())
+            {
+                throw std::invalid_argument(MISSING_DATA_COLUMN + name);
+            }
+
+            const std::size_t column = static_cast<std::size_t>(found - this->columnNames.begin());
+
+            selectedColumns.push_back(this->columns[column]);
+            selectedValues.push_back(this->columnValues[column]);
+        }
+
+        return TableInstance(names, std::move(selectedColumns), std::move(selectedValues));
+    }
+}
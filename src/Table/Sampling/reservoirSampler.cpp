@@ -0,0 +1,134 @@
+/*! \file reservoirSampler.cpp
+    \brief C++ file for drawing a uniform sample of the rows of a CSV data file in one pass.
+    \details Contains the function definitions for keeping a fixed number of the rows of a CSV data file, picked uniformly at random, while reading it a window of chunks at a time
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Table/Sampling/reservoirSampler.h"
+
+namespace normalizer::table::sampling
+{
+    /* Getters and Setters */
+
+    ul ReservoirSampler::getSampleSize() const
+    {
+        return this->sampleSize;
+    }
+
+    ul ReservoirSampler::getRowCount() const
+    {
+        return this->rowCount;
+    }
+
+    const std::vector<ul> &ReservoirSampler::getRowNumbers() const
+    {
+        return this->rowNumbers;
+    }
+
+    /* Member Functions */
+
+    instance::TableInstance ReservoirSampler::sample()
+    {
+        const std::size_t chunksPerWindow = std::max(std::thread::hardware_concurrency(), 1U);
+
+        std::vector<std::vector<SampledRow>> chunkReservoirs(chunksPerWindow);
+        std::vector<ui> chunkRows(chunksPerWindow, 0);
+        std::vector<SampledRow> reservoir;
+        ul firstRow = 0;
+        ul firstChunk = 0;
+
+        this->reader.scan(
+            chunksPerWindow, [this, &chunkReservoirs, &chunkRows, &firstChunk](const std::size_t chunk, const std::vector<std::string> &values)
+            {
+                const ul priority = ReservoirSampler::mixPriority((firstChunk + chunk) << 32 | chunkRows[chunk]); // No chunk holds 2^32 rows
+
+                if (this->accepts(chunkReservoirs[chunk], priority))
+                {
+                    this->offer(chunkReservoirs[chunk], {priority, chunkRows[chunk], values});
+                }
+
+                ++chunkRows[chunk]; },
+            [this, &chunkReservoirs, &chunkRows, &reservoir, &firstRow, &firstChunk](const std::size_t chunkCount)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+                {
+                    for (SampledRow &sampled : chunkReservoirs[chunk])
+                    {
+                        sampled.row += firstRow;
+
+                        if (this->accepts(reservoir, sampled.priority))
+                        {
+                            this->offer(reservoir, std::move(sampled));
+                        }
+                    }
+
+                    chunkReservoirs[chunk].clear();
+                    firstRow += chunkRows[chunk];
+                    chunkRows[chunk] = 0;
+                }
+
+                firstChunk += chunkCount;
+            });
+
+        std::sort(reservoir.begin(), reservoir.end(), [](const SampledRow &first, const SampledRow &second)
+                  { return first.row < second.row; });
+
+        instance::TableInstance sampledRows(this->reader.readColumnNames());
+
+        this->rowCount = firstRow;
+        this->rowNumbers.clear();
+
+        for (const SampledRow &sampled : reservoir)
+        {
+            sampledRows.addRow(sampled.values);
+            this->rowNumbers.push_back(sampled.row);
+        }
+
+        return sampledRows;
+    }
+
+    ul ReservoirSampler::countFittingRows(const std::string &csvPath, const ul memoryLimit)
+    {
+        std::ifstream csvFile(csvPath, std::ios::binary);
+        std::string chunk(file::CSV_CHUNK_BYTES, '\0');
+
+        csvFile.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        chunk.resize(static_cast<std::size_t>(csvFile.gcount()));
+
+        const ul rowBytes = std::max<ul>(chunk.size() / std::max<std::size_t>(static_cast<std::size_t>(std::count(chunk.begin(), chunk.end(), '\n')), 1), 1);
+
+        return std::max<ul>(memoryLimit / (EXTERNAL_MEMORY_FACTOR * rowBytes), 1); // A sampled row is held as its values and again in its table instance, like a partition read back
+    }
+
+    bool ReservoirSampler::accepts(const std::vector<SampledRow> &reservoir, const ul priority) const
+    {
+        return reservoir.size() < this->sampleSize || (!reservoir.empty() && priority < reservoir.front().priority);
+    }
+
+    void ReservoirSampler::offer(std::vector<SampledRow> &reservoir, SampledRow &&sampled) const
+    {
+        const auto lowerPriority = [](const SampledRow &first, const SampledRow &second)
+        { return first.priority < second.priority; };
+
+        if (reservoir.size() >= this->sampleSize)
+        {
+            std::pop_heap(reservoir.begin(), reservoir.end(), lowerPriority);
+            reservoir.pop_back();
+        }
+
+        reservoir.push_back(std::move(sampled));
+        std::push_heap(reservoir.begin(), reservoir.end(), lowerPriority);
+    }
+
+    ul ReservoirSampler::mixPriority(const ul position)
+    {
+        ul priority = position ^ SAMPLE_SEED;
+
+        priority = (priority ^ (priority >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        priority = (priority ^ (priority >> 27)) * 0x94d049bb133111ebULL;
+
+        return priority ^ (priority >> 31);
+    }
+}
@@ -165,9 +165,18 @@ namespace normalizer::table
 
     Table &Table::operator=(const Table &other)
     {
+        if (this == &other)
+        {
+            return *this;
+        }
+
         this->tableName = other.tableName;
         this->ifNotExists = other.ifNotExists;
 
+        this->primaryKeys.clear(); // Replace, rather than append to, the keys and rows of this table
+        this->foreignKeys.clear();
+        this->tableRows.clear();
+
         for (const std::string &primaryKey : other.getPrimaryKeys())
         {
             this->primaryKeys.push_back(primaryKey);
@@ -9,17 +9,99 @@
 #include "main.h"
 
 /*! \brief The entry point for the program
+    \param[in] argc The number of command line arguments
+    \param[in] argv The command line arguments, each one of the flags described in constants.h
     \date 10/11/2023
     \version 1.0
     \author Matthew Moore
     \return int The status code of the program
 */
-int main()
+int main(int argc, char **argv)
 {
+    bool verifyDecomposition = false;
+    bool incrementalMode = false;
+    bool compareMode = false;
+    bool analyzeMode = false;
+    bool discoverMode = false;
+    bool materializeMode = false;
+    bool validateMode = false;
+    ul memoryLimit = 0;
+    ul sampleSize = 0;
+    std::string temporaryPath = std::filesystem::temp_directory_path().string();
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+
+        if (argument == normalizer::VERIFY_ARGUMENT)
+        {
+            verifyDecomposition = true;
+        }
+        else if (argument == normalizer::INCREMENTAL_ARGUMENT)
+        {
+            incrementalMode = true;
+        }
+        else if (argument == normalizer::COMPARE_ARGUMENT)
+        {
+            compareMode = true;
+        }
+        else if (argument == normalizer::ANALYZE_ARGUMENT)
+        {
+            analyzeMode = true;
+        }
+        else if (argument == normalizer::DISCOVER_ARGUMENT)
+        {
+            discoverMode = true;
+        }
+        else if (argument == normalizer::MATERIALIZE_ARGUMENT)
+        {
+            materializeMode = true;
+        }
+        else if (argument == normalizer::VALIDATE_ARGUMENT)
+        {
+            validateMode = true;
+        }
+        else if (argument.rfind(normalizer::MEMORY_LIMIT_ARGUMENT, 0) == 0)
+        {
+            memoryLimit = normalizer::table::external::ExternalPartitioner::parseMemoryLimit(argument.substr(normalizer::MEMORY_LIMIT_ARGUMENT.size()));
+
+            if (memoryLimit == 0)
+            {
+                std::cout << "Invalid command line argument: " << argument << std::endl;
+                return 1;
+            }
+        }
+        else if (argument.rfind(normalizer::SAMPLE_ARGUMENT, 0) == 0)
+        {
+            const std::string rows = argument.substr(normalizer::SAMPLE_ARGUMENT.size());
+            const std::from_chars_result parsed = std::from_chars(rows.data(), rows.data() + rows.size(), sampleSize);
+
+            if (parsed.ec != std::errc() || parsed.ptr != rows.data() + rows.size() || sampleSize == 0)
+            {
+                std::cout << "Invalid command line argument: " << argument << std::endl;
+                return 1;
+            }
+        }
+        else if (argument.rfind(normalizer::TEMPORARY_DIRECTORY_ARGUMENT, 0) == 0)
+        {
+            temporaryPath = argument.substr(normalizer::TEMPORARY_DIRECTORY_ARGUMENT.size());
+        }
+        else
+        {
+            std::cout << "Invalid command line argument: " << argument << std::endl;
+            return 1;
+        }
+    }
+
+    if (discoverMode)
+    {
+        return runDiscoverMode(sampleSize, memoryLimit, temporaryPath);
+    }
+
     std::string datasetFile;
     std::string dependencyFile;
-    char normalizeTo;
-    normalizer::NormalizationForm normalizationForm;
+    std::string normalizeTo;
+    std::vector<normalizer::NormalizationForm> normalizationForms;
     char getHighestNormalizedForm;
     bool getNormalizedForm;
 
@@ -29,37 +111,42 @@ int main()
     std::cout << "Enter the path to the functional dependencies file (It must be in the resources/dependencies folder): ";
     std::cin >> dependencyFile;
 
-    std::cout << "Enter the normalization form required (1: 1NF, 2: 2NF, 3: 3NF, B: BCNF, 4: 4NF, 5: 5NF): ";
+    std::cout << "Enter the normalization form required, or several of them to compare (1: 1NF, 2: 2NF, 3: 3NF, B: BCNF, 4: 4NF, 5: 5NF): ";
     std::cin >> normalizeTo;
 
     std::cout << "Do you want to see the highest normalized form of the inputted table? (Yes: Y, No: N)" ;
     std::cin >> getHighestNormalizedForm;
 
-    switch (normalizeTo)
+    for (const char form : normalizeTo)
     {
-    case '1':
-        normalizationForm = normalizer::NormalizationForm::ONE;
-        break;
-    case '2':
-        normalizationForm = normalizer::NormalizationForm::TWO;
-        break;
-    case '3':
-        normalizationForm = normalizer::NormalizationForm::THREE;
-        break;
-    case 'B':
-        normalizationForm = normalizer::NormalizationForm::BCNF;
-        break;
-    case '4':
-        normalizationForm = normalizer::NormalizationForm::FOUR;
-        break;
-    case '5':
-        normalizationForm = normalizer::NormalizationForm::FIVE;
-        break;
-    default:
-        std::cout << "Invalid normalization form." << std::endl;
-        return 1;
+        switch (form)
+        {
+        case '1':
+            normalizationForms.push_back(normalizer::NormalizationForm::ONE);
+            break;
+        case '2':
+            normalizationForms.push_back(normalizer::NormalizationForm::TWO);
+            break;
+        case '3':
+            normalizationForms.push_back(normalizer::NormalizationForm::THREE);
+            break;
+        case 'B':
+            normalizationForms.push_back(normalizer::NormalizationForm::BCNF);
+            break;
+        case '4':
+            normalizationForms.push_back(normalizer::NormalizationForm::FOUR);
+            break;
+        case '5':
+            normalizationForms.push_back(normalizer::NormalizationForm::FIVE);
+            break;
+        default:
+            std::cout << "Invalid normalization form." << std::endl;
+            return 1;
+        }
     }
 
+    const normalizer::NormalizationForm normalizationForm = *std::max_element(normalizationForms.begin(), normalizationForms.end());
+
     switch (tolower(getHighestNormalizedForm))
     {
     case 'y':
@@ -75,9 +162,676 @@ int main()
 
     normalizer::Normalizer normalizer(normalizationForm, getNormalizedForm, normalizer::file::SQL_DATASET_FOLDER + datasetFile, normalizer::file::FUNCTIONAL_DEPENDENCIES_FOLDER + dependencyFile);
 
-    normalizer.normalize();
+    if (analyzeMode)
+    {
+        runAnalyzeMode(normalizer);
+        return 0;
+    }
+
+    if (validateMode && runValidateMode(normalizer, sampleSize, memoryLimit, temporaryPath) != 0) // Dependencies the data breaks would give a lossy schema
+    {
+        return 1;
+    }
+
+    normalizer.setVerifyDecomposition(verifyDecomposition);
+
+    if (normalizationForms.size() > 1)
+    {
+        runMultipleFormsMode(normalizer, normalizationForms);
+    }
+    else
+    {
+        normalizer.normalize();
+    }
 
     std::cout << normalizer << std::endl;
 
+    if (compareMode)
+    {
+        runCompareMode(normalizer, normalizationForm, getNormalizedForm, datasetFile, verifyDecomposition);
+    }
+
+    if (incrementalMode)
+    {
+        runIncrementalMode(normalizer);
+    }
+
+    if (materializeMode)
+    {
+        return runMaterializeMode(normalizer, verifyDecomposition, memoryLimit, temporaryPath);
+    }
+
     return 0;
-}
\ No newline at end of file
+}
+
+void runIncrementalMode(normalizer::Normalizer &normalizer)
+{
+    normalizer::incremental::IncrementalNormalizer incrementalNormalizer = normalizer.createIncrementalNormalizer();
+
+    const normalizer::dependencies::attribute::AttributeDictionary &dictionary = normalizer.getAttributeDictionary();
+    const std::vector<normalizer::table::Table> &normalizedTables = normalizer.getNormalizedTables();
+
+    std::string line;
+
+    while (true)
+    {
+        std::cout << "Enter + or - followed by a dependency to add or retract it (q to quit): ";
+
+        if (!std::getline(std::cin >> std::ws, line) || line.empty() || line[0] == 'q')
+        {
+            break;
+        }
+
+        if (line[0] != '+' && line[0] != '-')
+        {
+            std::cout << "Invalid argument." << std::endl;
+            continue;
+        }
+
+        const bool adding = line[0] == '+';
+
+        for (const normalizer::dependencies::functional::FunctionalDependency &dependency : incrementalNormalizer.parseDependencies(line.substr(1)))
+        {
+            const bool changed = adding ? incrementalNormalizer.addDependency(dependency) : incrementalNormalizer.retractDependency(dependency);
+
+            if (!changed)
+            {
+                std::cout << dependency.toString(dictionary) << (adding ? " is already a dependency" : " is not a dependency") << std::endl;
+                continue;
+            }
+
+            std::cout << (adding ? "Added " : "Retracted ") << dependency.toString(dictionary) << ", recomputing " << incrementalNormalizer.getRecomputedClosureCount() << " cached closures" << std::endl;
+
+            for (const ui index : incrementalNormalizer.getAffectedComponents())
+            {
+                std::cout << "\t" << normalizedTables[index].getTableName() << (incrementalNormalizer.isComponentInBCNF(index) ? " is in BCNF" : " is not in BCNF") << std::endl;
+
+                for (const normalizer::dependencies::functional::FunctionalDependency &componentDependency : incrementalNormalizer.getComponentDependencies()[index])
+                {
+                    std::cout << "\t\t" << componentDependency.toString(dictionary) << std::endl;
+                }
+            }
+
+            std::cout << "Candidate keys:";
+
+            for (const normalizer::dependencies::attribute::AttributeSet &candidateKey : incrementalNormalizer.getCandidateKeys())
+            {
+                std::cout << " " << dictionary.toString(candidateKey);
+            }
+
+            std::cout << std::endl;
+        }
+    }
+}
+
+void runCompareMode(const normalizer::Normalizer &normalizer, const normalizer::NormalizationForm normalizationForm, const bool getNormalizedForm, const std::string &datasetFile, const bool verifyDecomposition)
+{
+    std::string otherDependencyFile;
+
+    std::cout << "Enter the path to the functional dependencies file to compare against (It must be in the resources/dependencies folder): ";
+    std::cin >> otherDependencyFile;
+
+    const normalizer::dependencies::comparison::DependencyComparator comparator = normalizer.compareDependencies(normalizer::file::FUNCTIONAL_DEPENDENCIES_FOLDER + otherDependencyFile);
+
+    const normalizer::dependencies::attribute::AttributeDictionary &dictionary = normalizer.getAttributeDictionary();
+
+    for (const normalizer::dependencies::functional::FunctionalDependency &dependency : comparator.getAddedDependencies())
+    {
+        std::cout << "New: " << dependency.toString(dictionary) << std::endl;
+    }
+
+    for (const normalizer::dependencies::functional::FunctionalDependency &dependency : comparator.getRemovedDependencies())
+    {
+        std::cout << "Removed: " << dependency.toString(dictionary) << std::endl;
+    }
+
+    for (const normalizer::dependencies::functional::FunctionalDependency &dependency : comparator.getRedundantDependencies())
+    {
+        std::cout << "Redundant: " << dependency.toString(dictionary) << std::endl;
+    }
+
+    if (comparator.isEquivalent())
+    {
+        std::cout << "The dependency files are equivalent, so the normalized tables are unchanged" << std::endl;
+        return;
+    }
+
+    std::cout << "The dependency files are not equivalent, normalizing again:" << std::endl;
+
+    normalizer::Normalizer otherNormalizer(normalizationForm, getNormalizedForm, normalizer::file::SQL_DATASET_FOLDER + datasetFile, normalizer::file::FUNCTIONAL_DEPENDENCIES_FOLDER + otherDependencyFile);
+
+    otherNormalizer.setVerifyDecomposition(verifyDecomposition);
+
+    otherNormalizer.normalize();
+
+    std::cout << otherNormalizer << std::endl;
+}
+
+void runMultipleFormsMode(normalizer::Normalizer &normalizer, const std::vector<normalizer::NormalizationForm> &normalizationForms)
+{
+    const std::map<normalizer::NormalizationForm, std::string> formNames = {{normalizer::NormalizationForm::ONE, "1NF"}, {normalizer::NormalizationForm::TWO, "2NF"}, {normalizer::NormalizationForm::THREE, "3NF"}, {normalizer::NormalizationForm::BCNF, "BCNF"}, {normalizer::NormalizationForm::FOUR, "4NF"}, {normalizer::NormalizationForm::FIVE, "5NF"}};
+
+    std::map<normalizer::NormalizationForm, std::vector<normalizer::table::Table>> decompositions = normalizer.normalize(normalizationForms);
+
+    if (decompositions.empty())
+    {
+        return;
+    }
+
+    const normalizer::NormalizationForm highestForm = std::prev(decompositions.end())->first;
+
+    decompositions.erase(highestForm); // The highest form is printed along with the rest of the normalizer
+
+    for (std::pair<const normalizer::NormalizationForm, std::vector<normalizer::table::Table>> &decomposition : decompositions)
+    {
+        std::cout << "-- " << formNames.at(decomposition.first) << std::endl
+                  << normalizer.printTables(decomposition.second) << std::endl;
+    }
+
+    std::cout << "-- " << formNames.at(highestForm) << std::endl;
+}
+
+int runDiscoverMode(const ul sampleSize, const ul memoryLimit, const std::string &temporaryPath)
+{
+    std::string dataFile;
+    std::string dependencyFile;
+
+    std::cout << "Enter the path to the CSV data file (It must be in the resources/data folder): ";
+    std::cin >> dataFile;
+
+    std::cout << "Enter the name of the functional dependencies file to write (It will be written to the resources/dependencies folder): ";
+    std::cin >> dependencyFile;
+
+    double maxError = 0;
+
+    std::cout << "Enter the largest share of the rows a dependency may fail on, from 0 to 1 (0 for exact dependencies): ";
+
+    if (!(std::cin >> maxError) || maxError < 0 || maxError >= 1)
+    {
+        std::cout << "Invalid argument." << std::endl;
+        return 1;
+    }
+
+    const std::string dataPath = normalizer::file::DATA_FOLDER + dataFile;
+
+    std::error_code sizeError;
+
+    const ul dataBytes = std::filesystem::file_size(dataPath, sizeError);
+
+    const bool partitioned = memoryLimit > 0 && sampleSize == 0 && !sizeError && dataBytes * normalizer::table::EXTERNAL_MEMORY_FACTOR > memoryLimit; // Discovery compares rows across every group of rows, so the dependencies of a sample that fits are checked against every row one partition at a time instead
+
+    normalizer::table::sampling::ReservoirSampler sampler(dataPath, partitioned ? normalizer::table::sampling::ReservoirSampler::countFittingRows(dataPath, memoryLimit) : sampleSize);
+
+    const normalizer::table::instance::TableInstance instance = sampler.getSampleSize() > 0 ? sampler.sample() : normalizer::file::CsvReader(dataPath).read();
+
+    if (sampler.getSampleSize() > 0)
+    {
+        std::cout << "Sampled " << instance.getRowCount() << " of the " << sampler.getRowCount() << " rows of the data" << std::endl;
+    }
+
+    std::vector<normalizer::dependencies::functional::FunctionalDependency> dependencies;
+    std::vector<normalizer::dependencies::functional::FunctionalDependency> exactDependencies;
+    normalizer::dependencies::attribute::AttributeDictionary dictionary;
+
+    if (maxError <= 0 && instance.getColumnCount() > normalizer::dependencies::DISCOVERY_LATTICE_COLUMN_LIMIT) // The lattice grows with every column, while sampling grows with the dependencies, but sampling only finds exact dependencies
+    {
+        normalizer::dependencies::discovery::HybridDiscoverer discoverer(instance);
+
+        dependencies = discoverer.discover();
+        dictionary = discoverer.getAttributeDictionary();
+        exactDependencies = dependencies;
+
+        std::cout << "Found " << dependencies.size() << " minimal dependencies over " << instance.getRowCount() << " rows by sampling " << discoverer.getComparisonCount() << " pairs of rows and validating " << discoverer.getValidationCount() << " candidates" << std::endl;
+    }
+    else
+    {
+        normalizer::dependencies::discovery::TaneDiscoverer discoverer(instance, maxError);
+
+        dependencies = discoverer.discover();
+        dictionary = discoverer.getAttributeDictionary();
+
+        std::cout << "Found " << dependencies.size() << " minimal dependencies over " << instance.getRowCount() << " rows in " << discoverer.getLevelCount() << " levels" << std::endl;
+
+        for (const normalizer::dependencies::functional::FunctionalDependency &dependency : dependencies)
+        {
+            const ui violationCount = discoverer.getViolationCount(dependency);
+
+            if (violationCount > 0)
+            {
+                std::cout << "Holds on all but " << violationCount << " rows: " << dependency.toString(dictionary) << std::endl;
+            }
+            else
+            {
+                exactDependencies.push_back(dependency);
+            }
+        }
+    }
+
+    if (partitioned && instance.getRowCount() < sampler.getRowCount()) // Every dependency of the rows holds on the sample, so the ones the rows break are replaced with larger ones rather than dropped
+    {
+        normalizer::table::external::ExternalPartitioner partitioner(dataPath, temporaryPath, memoryLimit);
+        normalizer::dependencies::discovery::ExternalDiscoverer externalDiscoverer(partitioner, dictionary);
+
+        const std::vector<normalizer::dependencies::functional::FunctionalDependency> rowDependencies = externalDiscoverer.discover(exactDependencies);
+
+        dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(), [&exactDependencies](const normalizer::dependencies::functional::FunctionalDependency &dependency)
+                                          { return std::find(exactDependencies.begin(), exactDependencies.end(), dependency) != exactDependencies.end(); }),
+                           dependencies.end());
+        dependencies.insert(dependencies.end(), rowDependencies.begin(), rowDependencies.end());
+        exactDependencies = rowDependencies;
+
+        std::sort(dependencies.begin(), dependencies.end());
+
+        std::cout << "Found " << rowDependencies.size() << " minimal dependencies over every row by validating " << externalDiscoverer.getValidationCount() << " candidates in " << externalDiscoverer.getLevelCount() << " levels" << std::endl;
+        std::cout << "Read the data in " << partitioner.getPartitionCount() << " partitions, spilling " << partitioner.getSpilledBytes() << " bytes to " << temporaryPath << std::endl;
+    }
+    else if (sampleSize > 0) // Dependencies found on the sample may be broken by the rest of the rows
+    {
+        const std::vector<bool> broken = runSampleChecks(instance, sampler, dictionary, exactDependencies, 0, dataPath, memoryLimit, temporaryPath);
+
+        for (std::size_t i = broken.size(); i-- > 0;)
+        {
+            if (broken[i])
+            {
+                dependencies.erase(std::find(dependencies.begin(), dependencies.end(), exactDependencies[i]));
+                exactDependencies.erase(exactDependencies.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+    }
+
+    normalizer::dependencies::discovery::MultivaluedDiscoverer multivaluedDiscoverer(instance, exactDependencies); // An approximate dependency does not imply any multi valued dependency
+
+    const std::vector<normalizer::dependencies::multivalued::MultivaluedDependency> multivaluedDependencies = multivaluedDiscoverer.discover();
+
+    std::cout << "Found " << multivaluedDependencies.size() << " multi valued dependencies that the functional dependencies do not imply, out of " << multivaluedDiscoverer.getTestCount() << " tested" << std::endl;
+
+    const normalizer::dependencies::discovery::DependencyFileWriter writer(dictionary, dependencies, multivaluedDependencies);
+
+    for (const normalizer::dependencies::functional::FunctionalDependency &dependency : writer.getUnwrittenDependencies())
+    {
+        std::cout << "Not written, as a dependency file only has one row on the left hand side: " << dependency.toString(dictionary) << std::endl;
+    }
+
+    std::ofstream outputFile(normalizer::file::FUNCTIONAL_DEPENDENCIES_FOLDER + dependencyFile);
+
+    if (!outputFile.is_open())
+    {
+        std::cout << normalizer::file::FILE_DID_NOT_OPEN << ": " << normalizer::file::FUNCTIONAL_DEPENDENCIES_FOLDER + dependencyFile << std::endl;
+        return 1;
+    }
+
+    outputFile << writer.toString();
+
+    std::cout << writer.toString() << std::endl;
+
+    return 0;
+}
+
+int runMaterializeMode(normalizer::Normalizer &normalizer, const bool verifyDecomposition, const ul memoryLimit, const std::string &temporaryPath)
+{
+    std::string dataFile;
+    char format;
+
+    std::cout << "Enter the path to the CSV data file of the input table (It must be in the resources/data folder): ";
+    std::cin >> dataFile;
+
+    std::cout << "Enter the format to write the rows of the normalized tables in (I: INSERT statements, C: CSV files with a LOAD DATA script): ";
+    std::cin >> format;
+
+    format = static_cast<char>(tolower(format));
+
+    if (format != 'i' && format != 'c')
+    {
+        std::cout << "Invalid argument." << std::endl;
+        return 1;
+    }
+
+    const std::vector<normalizer::table::Table> &normalizedTables = normalizer.getNormalizedTables();
+
+    std::filesystem::create_directories(normalizer::file::MATERIALIZED_FOLDER);
+
+    std::vector<std::string> outputPaths;
+
+    if (format == 'i')
+    {
+        outputPaths.push_back(normalizer::file::MATERIALIZED_FOLDER + normalizer::file::MATERIALIZED_INSERT_FILE);
+    }
+    else
+    {
+        for (const normalizer::table::Table &normalizedTable : normalizedTables)
+        {
+            outputPaths.push_back(std::filesystem::absolute(normalizer::file::MATERIALIZED_FOLDER + normalizedTable.getTableName() + ".csv").string()); // LOAD DATA LOCAL reads paths from wherever the client runs
+        }
+
+        outputPaths.push_back(normalizer::file::MATERIALIZED_FOLDER + normalizer::file::MATERIALIZED_LOAD_FILE);
+    }
+
+    const std::string dataPath = normalizer::file::DATA_FOLDER + dataFile;
+    const ul partitionLimit = memoryLimit > 0 ? memoryLimit : normalizer::materialization::MATERIALIZE_MEMORY_LIMIT;
+
+    normalizer::table::external::ExternalPartitioner partitioner(dataPath, temporaryPath, partitionLimit);
+    normalizer::materialization::ExternalMaterializer materializer(partitioner, normalizedTables);
+
+    if (writeMaterializedRows(materializer, outputPaths, normalizedTables.size(), format) != 0)
+    {
+        return 1;
+    }
+
+    for (std::size_t i = 0; i < normalizedTables.size(); ++i)
+    {
+        std::cout << normalizedTables[i].getTableName() << ": " << materializer.getRowCount(i) << " distinct rows" << std::endl;
+    }
+
+    if (partitioner.getSpilledBytes() > 0)
+    {
+        std::cout << "Read the data in " << partitioner.getPartitionCount() << " partitions, spilling " << partitioner.getSpilledBytes() << " bytes to " << temporaryPath << std::endl;
+    }
+
+    std::cout << "Wrote the rows to " << normalizer::file::MATERIALIZED_FOLDER << std::endl;
+
+    if (verifyDecomposition)
+    {
+        std::vector<std::string> columnNames;
+
+        for (const normalizer::table::row::TableRow &row : normalizer.getInputTable().getTableRows())
+        {
+            columnNames.push_back(row.getRowName());
+        }
+
+        normalizer::verification::ExternalDataJoinVerifier verifier(dataPath, columnNames, materializer, normalizedTables, temporaryPath, partitionLimit);
+
+        const bool lossless = verifier.verify();
+
+        for (const std::string &column : verifier.getUncoveredColumns())
+        {
+            std::cout << "No normalized table holds the column " << column << std::endl;
+        }
+
+        if (lossless)
+        {
+            std::cout << "The rows of the normalized tables join back into the " << verifier.getDistinctRowCount() << " distinct rows of the data" << std::endl;
+        }
+        else
+        {
+            std::cout << "The rows of the normalized tables join back into " << (verifier.getJoinedRowCount() > verifier.getDistinctRowCount() ? "more than " : "") << verifier.getJoinedRowCount() << " rows, but the data has " << verifier.getDistinctRowCount() << " distinct rows" << std::endl;
+        }
+
+        for (const std::vector<std::string> &row : verifier.getSpuriousRows())
+        {
+            std::cout << "Not a row of the data: " << printRow(row) << std::endl;
+        }
+
+        for (const std::vector<std::string> &row : verifier.getMissingRows())
+        {
+            std::cout << "Not joined back: " << printRow(row) << std::endl;
+        }
+
+        if (verifier.getSpilledBytes() > 0)
+        {
+            std::cout << "Joined the rows in " << verifier.getPartitionCount() << " partitions, spilling " << verifier.getSpilledBytes() << " bytes to " << temporaryPath << std::endl;
+        }
+    }
+
+    return 0;
+}
+
+template <typename Materializer>
+int writeMaterializedRows(Materializer &materializer, const std::vector<std::string> &outputPaths, const std::size_t tableCount, const char format)
+{
+    for (std::size_t i = 0; i < outputPaths.size(); ++i)
+    {
+        std::ofstream outputFile(outputPaths[i]);
+
+        if (!outputFile.is_open())
+        {
+            std::cout << normalizer::file::FILE_DID_NOT_OPEN << ": " << outputPaths[i] << std::endl;
+            return 1;
+        }
+
+        if (format == 'i')
+        {
+            materializer.writeInserts(outputFile);
+        }
+        else if (i < tableCount)
+        {
+            materializer.writeCsv(i, outputFile);
+        }
+        else
+        {
+            outputFile << materializer.createLoadScript(outputPaths);
+        }
+    }
+
+    return 0;
+}
+
+int runValidateMode(const normalizer::Normalizer &normalizer, const ul sampleSize, const ul memoryLimit, const std::string &temporaryPath)
+{
+    std::string dataFile;
+
+    std::cout << "Enter the path to the CSV data file of the input table (It must be in the resources/data folder): ";
+    std::cin >> dataFile;
+
+    const std::string dataPath = normalizer::file::DATA_FOLDER + dataFile;
+    const normalizer::dependencies::attribute::AttributeDictionary &dictionary = normalizer.getAttributeDictionary();
+    std::vector<normalizer::dependencies::functional::FunctionalDependency> dependencies = normalizer.getDeclaredDependencies();
+
+    if (sampleSize > 0)
+    {
+        const std::vector<std::string> primaryKeys = normalizer.getInputTable().getPrimaryKeys();
+        std::size_t keyCount = 0;
+
+        if (!primaryKeys.empty()) // Two distinct rows only share a key if they differ on some other attribute
+        {
+            const normalizer::dependencies::attribute::AttributeSet key = dictionary.toAttributeSet(primaryKeys);
+
+            dependencies.push_back({key, dictionary.createFullSet() - key});
+            keyCount = 1;
+        }
+
+        normalizer::table::sampling::ReservoirSampler sampler(dataPath, sampleSize);
+
+        const normalizer::table::instance::TableInstance sample = sampler.sample();
+
+        std::cout << "Sampled " << sample.getRowCount() << " of the " << sampler.getRowCount() << " rows of the data" << std::endl;
+
+        const std::vector<bool> broken = runSampleChecks(sample, sampler, dictionary, dependencies, keyCount, dataPath, memoryLimit, temporaryPath);
+        const std::size_t brokenCount = static_cast<std::size_t>(std::count(broken.begin(), broken.end(), true));
+
+        if (brokenCount == 0)
+        {
+            std::cout << "None of the " << dependencies.size() << " dependencies and keys is broken by the sample or the rows checked" << std::endl;
+            return 0;
+        }
+
+        std::cout << brokenCount << " of " << dependencies.size() << " dependencies and keys do not hold on the data" << std::endl;
+
+        return 1;
+    }
+
+    const std::vector<normalizer::dependencies::validation::DependencyViolation> violations = checkEveryRow(dataPath, dictionary, dependencies, memoryLimit, temporaryPath);
+
+    for (const normalizer::dependencies::validation::DependencyViolation &violation : violations)
+    {
+        printViolation(violation, violation.dependency.toString(dictionary));
+    }
+
+    if (violations.empty())
+    {
+        std::cout << "All " << dependencies.size() << " functional dependencies hold on the data" << std::endl;
+        return 0;
+    }
+
+    std::cout << violations.size() << " of " << dependencies.size() << " functional dependencies do not hold on the data" << std::endl;
+
+    return 1;
+}
+
+std::vector<normalizer::dependencies::validation::DependencyViolation> checkEveryRow(const std::string &dataPath, const normalizer::dependencies::attribute::AttributeDictionary &dictionary, const std::vector<normalizer::dependencies::functional::FunctionalDependency> &dependencies, const ul memoryLimit, const std::string &temporaryPath)
+{
+    if (memoryLimit > 0)
+    {
+        normalizer::table::external::ExternalPartitioner partitioner(dataPath, temporaryPath, memoryLimit);
+
+        const std::vector<normalizer::dependencies::validation::DependencyViolation> violations = normalizer::dependencies::validation::ExternalDependencyValidator(partitioner, dictionary).validate(dependencies);
+
+        std::cout << "Read the data in " << partitioner.getPartitionCount() << " partitions, spilling " << partitioner.getSpilledBytes() << " bytes to " << temporaryPath << std::endl;
+
+        return violations;
+    }
+
+    const normalizer::table::instance::TableInstance instance = normalizer::file::CsvReader(dataPath).read();
+
+    return normalizer::dependencies::validation::DependencyValidator(instance, dictionary).validate(dependencies);
+}
+
+std::vector<bool> runSampleChecks(const normalizer::table::instance::TableInstance &sample, const normalizer::table::sampling::ReservoirSampler &sampler, const normalizer::dependencies::attribute::AttributeDictionary &dictionary, const std::vector<normalizer::dependencies::functional::FunctionalDependency> &dependencies, const std::size_t keyCount, const std::string &dataPath, const ul memoryLimit, const std::string &temporaryPath)
+{
+    const normalizer::dependencies::validation::SampleValidator validator(sample, sampler.getRowNumbers(), sampler.getRowCount(), dictionary);
+    const std::vector<normalizer::dependencies::validation::DependencyEstimate> estimates = validator.estimate(dependencies, keyCount);
+    const ul confidence = static_cast<ul>(std::lround(normalizer::dependencies::SAMPLE_CONFIDENCE * 100));
+
+    std::vector<std::string> names;
+    std::vector<bool> broken;
+
+    for (std::size_t i = 0; i < estimates.size(); ++i)
+    {
+        const normalizer::dependencies::validation::DependencyEstimate &estimate = estimates[i];
+        const bool isKey = i >= dependencies.size() - keyCount;
+
+        names.push_back(isKey ? "KEY: " + dictionary.toString(dependencies[i].getDeterminant()) : dependencies[i].toString(dictionary));
+        broken.push_back(estimate.violation.groupCount > 0);
+
+        std::cout << "[" << i + 1 << "] ";
+
+        if (broken[i])
+        {
+            printViolation(estimate.violation, names[i]);
+        }
+        else if (sample.getRowCount() >= sampler.getRowCount())
+        {
+            std::cout << "Holds on every row: " << names[i] << std::endl;
+        }
+        else if (isKey)
+        {
+            std::cout << "Holds on the sample, and at " << confidence << "% confidence fewer than " << estimate.brokenPairBound << " pairs of rows share it: " << names[i] << std::endl;
+        }
+        else if (estimate.repeatedRows == 0)
+        {
+            std::cout << "Untested, as no two sampled rows agree on its left hand side: " << names[i] << std::endl;
+        }
+        else
+        {
+            std::ostringstream share;
+            share << std::setprecision(3) << estimate.brokenShareBound * 100;
+
+            std::cout << "Holds on the " << estimate.repeatedRows << " sampled rows that repeat its left hand side, and at " << confidence << "% confidence fewer than " << share.str() << "% of such rows break it: " << names[i] << std::endl;
+        }
+    }
+
+    std::string line;
+
+    std::cout << "Enter the numbers of the dependencies to check against every row, separated by spaces (0 for none): ";
+
+    if (!std::getline(std::cin >> std::ws, line))
+    {
+        return broken;
+    }
+
+    std::istringstream numbers(line);
+    std::vector<std::size_t> selected;
+    std::vector<normalizer::dependencies::functional::FunctionalDependency> selectedDependencies;
+
+    for (std::size_t number = 0; numbers >> number;)
+    {
+        if (number == 0)
+        {
+            continue;
+        }
+
+        if (number > dependencies.size())
+        {
+            std::cout << "No dependency numbered " << number << std::endl;
+            continue;
+        }
+
+        selected.push_back(number - 1);
+        selectedDependencies.push_back(dependencies[number - 1]);
+    }
+
+    if (selected.empty())
+    {
+        return broken;
+    }
+
+    const std::vector<normalizer::dependencies::validation::DependencyViolation> violations = checkEveryRow(dataPath, dictionary, selectedDependencies, memoryLimit, temporaryPath);
+    std::size_t next = 0;
+
+    for (std::size_t i = 0; i < selected.size(); ++i)
+    {
+        if (next < violations.size() && violations[next].dependency == selectedDependencies[i]) // The violations come in the order of the dependencies
+        {
+            std::cout << "[" << selected[i] + 1 << "] Checked every row: ";
+            printViolation(violations[next++], names[selected[i]]);
+
+            broken[selected[i]] = true;
+        }
+        else
+        {
+            std::cout << "[" << selected[i] + 1 << "] Checked every row, and it holds: " << names[selected[i]] << std::endl;
+        }
+    }
+
+    return broken;
+}
+
+void runAnalyzeMode(normalizer::Normalizer &normalizer)
+{
+    const normalizer::analysis::NormalFormAnalysis &analysis = normalizer.analyze();
+
+    if (!analysis.inOneNF)
+    {
+        std::cout << "1NF: The table has no primary key or has nullable rows" << std::endl;
+    }
+
+    printViolations("2NF", "->", analysis.partialDependencies);
+    printViolations("3NF", "->", analysis.transitiveDependencies);
+    printViolations("BCNF", "->", analysis.bcnfDependencies);
+    printViolations("4NF", "->>", analysis.multiValuedDependencies);
+
+    for (const normalizer::dependencies::join::JoinDependency &joinDependency : analysis.joinDependencies)
+    {
+        std::cout << "5NF: " << joinDependency.toString(normalizer.getAttributeDictionary()) << std::endl;
+    }
+
+    std::cout << std::endl
+              << "The highest normalized form of the table is: " << analysis.highestForm << std::endl;
+}
+
+void printViolations(const std::string &label, const std::string &arrow, const std::vector<std::pair<std::string, std::string>> &violations)
+{
+    for (const std::pair<std::string, std::string> &violation : violations)
+    {
+        std::cout << label << ": " << violation.first << " " << arrow << " " << violation.second << std::endl;
+    }
+}
+
+void printViolation(const normalizer::dependencies::validation::DependencyViolation &violation, const std::string &name)
+{
+    std::cout << "Broken on " << violation.groupCount << " groups of rows: " << name << std::endl;
+
+    std::cout << "\tRow " << violation.firstRow + 1 << ": " << printRow(violation.firstValues) << std::endl
+              << "\tRow " << violation.secondRow + 1 << ": " << printRow(violation.secondValues) << std::endl;
+}
+
+std::string printRow(const std::vector<std::string> &values)
+{
+    std::string row = "(";
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        row += (i == 0 ? "" : ", ") + values[i];
+    }
+
+    return row + ")";
+}
@@ -0,0 +1,21 @@
+/*! \file attributeDictionaryHelper.cpp
+    \brief C++ file for creating the attribute dictionaries of tests.
+    \details Contains the function definitions for creating an attribute dictionary from the row names of a test
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Dependencies/attributeDictionaryHelper.h"
+
+normalizer::dependencies::attribute::AttributeDictionary createDictionary(const std::vector<std::string> &rowNames)
+{
+    normalizer::dependencies::attribute::AttributeDictionary dictionary;
+
+    for (const std::string &rowName : rowNames)
+    {
+        dictionary.addAttribute(rowName);
+    }
+
+    return dictionary;
+}
@@ -0,0 +1,88 @@
+/*! \file closureMatrixTest.cpp
+    \brief C++ file for creating tests for the closures of every single attribute.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/Closure/closureCalculator.h"
+#include "Dependencies/Closure/closureMatrix.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::dependencies::closure::ClosureMatrix;
+using normalizer::dependencies::functional::FunctionalDependency;
+
+TEST(ClosureMatrix, TransitiveChain)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const ClosureCalculator calculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}}, dictionary.getAttributeCount());
+    const ClosureMatrix matrix(calculator.getDependencyStore());
+
+    EXPECT_EQ(dictionary.toString(matrix.getClosure(dictionary.getAttributeId("A"))), "(A, B, C)");
+    EXPECT_TRUE(matrix.determines(dictionary.getAttributeId("A"), dictionary.getAttributeId("C")));
+    EXPECT_FALSE(matrix.determines(dictionary.getAttributeId("C"), dictionary.getAttributeId("A")));
+    EXPECT_EQ(dictionary.toString(matrix.getDeterminedAttributes()), "(B, C)");
+    EXPECT_TRUE(matrix.getSingleAttributeKeys().isEmpty());
+}
+
+TEST(ClosureMatrix, CompositeLeftHandSides)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D", "E"});
+    const ClosureCalculator calculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}, {dictionary.toAttributeSet({"B", "C"}), dictionary.toAttributeSet({"D"})}, {dictionary.toAttributeSet({"D"}), dictionary.toAttributeSet({"E"})}}, dictionary.getAttributeCount());
+    const ClosureMatrix matrix(calculator.getDependencyStore());
+
+    EXPECT_TRUE(matrix.isSuperkey(dictionary.getAttributeId("A")));
+    EXPECT_FALSE(matrix.isSuperkey(dictionary.getAttributeId("B")));
+    EXPECT_FALSE(matrix.determines(dictionary.getAttributeId("B"), dictionary.getAttributeId("D")));
+    EXPECT_FALSE(matrix.isDetermined(dictionary.getAttributeId("A")));
+}
+
+TEST(ClosureMatrix, MatchesClosureCalculator)
+{
+    std::vector<std::string> rowNames;
+
+    for (us i = 0; i < 150; ++i) // More than two words per row
+    {
+        rowNames.push_back("A" + std::to_string(static_cast<ui>(i)));
+    }
+
+    const AttributeDictionary dictionary = createDictionary(rowNames);
+    std::vector<FunctionalDependency> dependencies;
+
+    for (us i = 0; i + 1 < 150; ++i)
+    {
+        AttributeSet determinant = dictionary.createEmptySet();
+        AttributeSet dependent = dictionary.createEmptySet();
+
+        determinant.addAttribute(static_cast<us>((i * 7) % 150));
+        dependent.addAttribute(static_cast<us>((i * 7 + 13) % 150));
+
+        if (i % 5 == 0) // Some dependencies need two attributes on the left
+        {
+            determinant.addAttribute(static_cast<us>((i * 11 + 3) % 150));
+        }
+
+        dependencies.push_back({determinant, dependent});
+    }
+
+    const ClosureCalculator calculator(dependencies, dictionary.getAttributeCount());
+    const ClosureMatrix matrix(calculator.getDependencyStore());
+
+    for (us attributeId = 0; attributeId < dictionary.getAttributeCount(); ++attributeId)
+    {
+        AttributeSet attributes = dictionary.createEmptySet();
+        attributes.addAttribute(attributeId);
+
+        EXPECT_EQ(matrix.getClosure(attributeId), calculator.computeClosure(attributes));
+    }
+}
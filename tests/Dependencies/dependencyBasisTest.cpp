@@ -0,0 +1,53 @@
+/*! \file dependencyBasisTest.cpp
+    \brief C++ file for creating tests for computing dependency bases.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Basis/dependencyBasis.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::basis::DependencyBasisCalculator;
+
+TEST(DependencyBasis, SplitsOnMultivaluedDependencies)
+{
+    const AttributeDictionary dictionary = createDictionary({"Ename", "Pname", "Dname", "Salary"});
+    DependencyBasisCalculator basisCalculator({}, {{dictionary.toAttributeSet({"Ename"}), dictionary.toAttributeSet({"Pname"})}}, dictionary.getAttributeCount());
+
+    const std::vector<AttributeSet> &basis = basisCalculator.getBasis(dictionary.toAttributeSet({"Ename"}));
+
+    ASSERT_EQ(basis.size(), 2U);
+    EXPECT_EQ(dictionary.toString(basis[0]), "Pname");
+    EXPECT_EQ(dictionary.toString(basis[1]), "(Dname, Salary)");
+    EXPECT_TRUE(basisCalculator.implies({dictionary.toAttributeSet({"Ename"}), dictionary.toAttributeSet({"Dname", "Salary"})}));
+    EXPECT_FALSE(basisCalculator.implies({dictionary.toAttributeSet({"Ename"}), dictionary.toAttributeSet({"Dname"})}));
+}
+
+TEST(DependencyBasis, ImpliedThroughTransitivity)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    DependencyBasisCalculator basisCalculator({}, {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}}, dictionary.getAttributeCount());
+
+    EXPECT_TRUE(basisCalculator.implies({dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C", "D"})})); // A ->> C - B and complementation
+    EXPECT_EQ(basisCalculator.getCachedBasisCount(), 1U);
+}
+
+TEST(DependencyBasis, ClosureByCoalescence)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    DependencyBasisCalculator basisCalculator({{dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"A"})}}, {{dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"})}}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(dictionary.toString(basisCalculator.computeClosure(dictionary.toAttributeSet({"C"}))), "(A, C)");
+    EXPECT_EQ(dictionary.toString(basisCalculator.computeClosure(dictionary.toAttributeSet({"A"}))), "A");
+}
@@ -0,0 +1,99 @@
+/*! \file dependencyComparatorTest.cpp
+    \brief C++ file for creating tests for comparing two sets of functional dependencies.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Comparison/dependencyComparator.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::comparison::DependencyComparator;
+using normalizer::dependencies::functional::FunctionalDependency;
+
+TEST(DependencyComparator, RewrittenDependenciesAreEquivalent)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    const std::vector<FunctionalDependency> oldDependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}};
+    const std::vector<FunctionalDependency> newDependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}};
+
+    const DependencyComparator comparator(oldDependencies, newDependencies, dictionary.getAttributeCount());
+
+    EXPECT_TRUE(comparator.isEquivalent());
+    EXPECT_TRUE(comparator.getRedundantDependencies().empty());
+}
+
+TEST(DependencyComparator, AddedAndRemovedParts)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const std::vector<FunctionalDependency> oldDependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}};
+    const std::vector<FunctionalDependency> newDependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"D"})}};
+
+    const DependencyComparator comparator(oldDependencies, newDependencies, dictionary.getAttributeCount());
+
+    EXPECT_FALSE(comparator.isEquivalent());
+    ASSERT_EQ(comparator.getAddedDependencies().size(), 1U);
+    EXPECT_EQ(comparator.getAddedDependencies()[0].toString(dictionary), "C -> D");
+    ASSERT_EQ(comparator.getRemovedDependencies().size(), 1U);
+    EXPECT_EQ(comparator.getRemovedDependencies()[0].toString(dictionary), "A -> C"); // A -> B is still there
+}
+
+TEST(DependencyComparator, RedundantDependencies)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    const std::vector<FunctionalDependency> newDependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})}};
+
+    const DependencyComparator comparator(newDependencies, newDependencies, dictionary.getAttributeCount());
+
+    EXPECT_TRUE(comparator.isEquivalent());
+    ASSERT_EQ(comparator.getRedundantDependencies().size(), 1U);
+    EXPECT_EQ(comparator.getRedundantDependencies()[0].toString(dictionary), "A -> C");
+}
+
+TEST(DependencyComparator, ThousandsOfDependencies)
+{
+    std::vector<std::string> rowNames;
+
+    for (ui i = 0; i < 2000; ++i)
+    {
+        rowNames.push_back("A" + std::to_string(i));
+    }
+
+    const AttributeDictionary dictionary = createDictionary(rowNames);
+
+    std::vector<FunctionalDependency> oldDependencies;
+
+    for (us attributeId = 0; attributeId + 1 < dictionary.getAttributeCount(); ++attributeId) // A chain A0 -> A1 -> ... -> A1999
+    {
+        AttributeSet determinant = dictionary.createEmptySet();
+        determinant.addAttribute(attributeId);
+
+        AttributeSet dependent = dictionary.createEmptySet();
+        dependent.addAttribute(static_cast<us>(attributeId + 1));
+
+        oldDependencies.push_back({determinant, dependent});
+    }
+
+    std::vector<FunctionalDependency> newDependencies = oldDependencies;
+    std::reverse(newDependencies.begin(), newDependencies.end());
+
+    EXPECT_TRUE(DependencyComparator(oldDependencies, newDependencies, dictionary.getAttributeCount()).isEquivalent());
+
+    newDependencies.pop_back();
+
+    const DependencyComparator comparator(oldDependencies, newDependencies, dictionary.getAttributeCount());
+
+    EXPECT_FALSE(comparator.isEquivalent());
+    ASSERT_EQ(comparator.getRemovedDependencies().size(), 1U);
+    EXPECT_EQ(comparator.getRemovedDependencies()[0].toString(dictionary), "A0 -> A1");
+}
@@ -0,0 +1,89 @@
+/*! \file dependencyGraphTest.cpp
+    \brief C++ file for creating tests for the groups of attributes that determine each other.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Graph/dependencyGraph.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::graph::DependencyGraph;
+using normalizer::dependencies::keys::CandidateKeyFinder;
+
+TEST(DependencyGraph, GroupsCycles)
+{
+    const AttributeDictionary dictionary = createDictionary({"StudentID", "Course", "Instructor", "Room"});
+    const ClosureCalculator calculator({{dictionary.toAttributeSet({"Course"}), dictionary.toAttributeSet({"Instructor"})}, {dictionary.toAttributeSet({"Instructor"}), dictionary.toAttributeSet({"Course", "Room"})}}, dictionary.getAttributeCount());
+    const DependencyGraph graph(calculator.getDependencyStore());
+
+    EXPECT_TRUE(graph.hasCycles());
+    EXPECT_EQ(graph.getComponents().size(), 3U);
+    EXPECT_EQ(dictionary.toString(graph.getEquivalentAttributes(dictionary.getAttributeId("Course"))), "(Course, Instructor)");
+    EXPECT_EQ(graph.getComponentIndex(dictionary.getAttributeId("Course")), graph.getComponentIndex(dictionary.getAttributeId("Instructor")));
+    EXPECT_LT(graph.getComponentIndex(dictionary.getAttributeId("Room")), graph.getComponentIndex(dictionary.getAttributeId("Course"))); // Determined groups come first
+    EXPECT_EQ(graph.getSuccessors(dictionary.getAttributeId("Instructor")).size(), 2U);
+}
+
+TEST(DependencyGraph, LongChainWithoutCycles)
+{
+    std::vector<std::string> rowNames;
+
+    for (ui i = 0; i < 5000; ++i) // Deep enough to overflow a recursive search
+    {
+        rowNames.push_back("A" + std::to_string(i));
+    }
+
+    const AttributeDictionary dictionary = createDictionary(rowNames);
+    std::vector<FunctionalDependency> dependencies;
+
+    for (us i = 0; i + 1 < dictionary.getAttributeCount(); ++i)
+    {
+        AttributeSet determinant = dictionary.createEmptySet();
+        AttributeSet dependent = dictionary.createEmptySet();
+
+        determinant.addAttribute(i);
+        dependent.addAttribute(static_cast<us>(i + 1));
+
+        dependencies.push_back({determinant, dependent});
+    }
+
+    const ClosureCalculator calculator(dependencies, dictionary.getAttributeCount());
+    const DependencyGraph graph(calculator.getDependencyStore());
+
+    EXPECT_FALSE(graph.hasCycles());
+    EXPECT_EQ(graph.getComponents().size(), 5000U);
+}
+
+TEST(CandidateKeyFinder, ExpandsCondensedKeys)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D", "E"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"})}, {dictionary.toAttributeSet({"A", "D"}), dictionary.toAttributeSet({"E"})}}, dictionary.getAttributeCount()));
+    CandidateKeyFinder keyFinder(closureCache);
+
+    std::vector<std::string> candidateKeys;
+
+    for (const AttributeSet &candidateKey : keyFinder.findCandidateKeys())
+    {
+        candidateKeys.push_back(dictionary.toString(candidateKey));
+    }
+
+    std::sort(candidateKeys.begin(), candidateKeys.end());
+
+    EXPECT_EQ(candidateKeys, (std::vector<std::string>{"(A, D)", "(B, D)", "(C, D)"}));
+}
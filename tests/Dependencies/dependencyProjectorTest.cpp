@@ -0,0 +1,113 @@
+/*! \file dependencyProjectorTest.cpp
+    \brief C++ file for creating tests for projecting functional dependencies.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCalculator.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Projection/dependencyProjector.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+
+namespace
+{
+    FunctionalDependency createDependency(const AttributeDictionary &dictionary, const std::vector<std::string> &lhs, const std::vector<std::string> &rhs)
+    {
+        return {dictionary.toAttributeSet(lhs), dictionary.toAttributeSet(rhs)};
+    }
+}
+
+TEST(ClosureCalculator, TransitiveClosure)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const normalizer::dependencies::closure::ClosureCalculator calculator({createDependency(dictionary, {"A"}, {"B"}), createDependency(dictionary, {"B"}, {"C"})}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(calculator.computeClosure(dictionary.toAttributeSet({"A"})), dictionary.toAttributeSet({"A", "B", "C"}));
+    EXPECT_TRUE(calculator.implies(dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})));
+    EXPECT_FALSE(calculator.implies(dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"})));
+}
+
+TEST(DependencyProjector, TransitiveDependencyCarriedOntoSubSchema)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({createDependency(dictionary, {"A"}, {"B"}), createDependency(dictionary, {"B"}, {"C"})}, dictionary.getAttributeCount()));
+    normalizer::dependencies::projection::DependencyProjector projector(closureCache);
+
+    const std::vector<FunctionalDependency> projected = projector.project(dictionary.toAttributeSet({"A", "C"}));
+
+    ASSERT_EQ(projected.size(), 1U);
+    EXPECT_EQ(projected[0].toString(dictionary), "A -> C");
+}
+
+TEST(DependencyProjector, ProjectionIsMinimal)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({createDependency(dictionary, {"A"}, {"B"}), createDependency(dictionary, {"B"}, {"C"}), createDependency(dictionary, {"A"}, {"C"})}, dictionary.getAttributeCount()));
+    normalizer::dependencies::projection::DependencyProjector projector(closureCache);
+
+    const std::vector<FunctionalDependency> projected = projector.project(dictionary.createFullSet());
+
+    ASSERT_EQ(projected.size(), 2U);
+    EXPECT_EQ(projected[0].toString(dictionary), "A -> B");
+    EXPECT_EQ(projected[1].toString(dictionary), "B -> C");
+}
+
+TEST(DependencyProjector, CompositeDeterminant)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({createDependency(dictionary, {"A", "B"}, {"C"}), createDependency(dictionary, {"C"}, {"D"})}, dictionary.getAttributeCount()));
+    normalizer::dependencies::projection::DependencyProjector projector(closureCache);
+
+    const std::vector<FunctionalDependency> projected = projector.project(dictionary.toAttributeSet({"A", "B", "D"}));
+
+    ASSERT_EQ(projected.size(), 1U);
+    EXPECT_EQ(projected[0].toString(dictionary), "(A, B) -> D");
+}
+
+TEST(DependencyProjector, ClosuresCachedAcrossCalls)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({createDependency(dictionary, {"A"}, {"B"}), createDependency(dictionary, {"B"}, {"C"})}, dictionary.getAttributeCount()));
+    normalizer::dependencies::projection::DependencyProjector projector(closureCache);
+
+    projector.project(dictionary.toAttributeSet({"A", "B"}));
+
+    const std::size_t cachedClosures = projector.getCachedClosureCount();
+
+    projector.project(dictionary.toAttributeSet({"A", "B"}));
+
+    EXPECT_EQ(projector.getCachedClosureCount(), cachedClosures);
+    EXPECT_TRUE(projector.project(dictionary.toAttributeSet({"C"})).empty());
+}
+
+TEST(ClosureCache, SharedAcrossProjectors)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({createDependency(dictionary, {"A"}, {"B"}), createDependency(dictionary, {"B"}, {"C"})}, dictionary.getAttributeCount()));
+
+    normalizer::dependencies::projection::DependencyProjector firstProjector(closureCache);
+    firstProjector.project(dictionary.toAttributeSet({"A", "C"}));
+
+    const ul missCount = closureCache.getMissCount();
+
+    normalizer::dependencies::projection::DependencyProjector secondProjector(closureCache);
+    secondProjector.project(dictionary.toAttributeSet({"A", "C"}));
+
+    EXPECT_EQ(closureCache.getMissCount(), missCount);
+    EXPECT_GT(closureCache.getHitCount(), 0U);
+    EXPECT_EQ(closureCache.getClosure(dictionary.toAttributeSet({"A"})), dictionary.toAttributeSet({"A", "B", "C"}));
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*! \file dependencyStoreTest.cpp
+    \brief C++ file for creating tests for the flat functional dependency store.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Store/dependencyStore.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::store::DependencyStore;
+
+namespace
+{
+    template <typename T>
+    std::vector<T> toVector(const std::span<const T> values)
+    {
+        return std::vector<T>(values.begin(), values.end());
+    }
+}
+
+TEST(DependencyStore, StoresBothSidesContiguously)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const DependencyStore store({{dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A", "D"})}}, dictionary.getAttributeCount());
+
+    ASSERT_EQ(store.getDependencyCount(), 2U);
+    EXPECT_EQ(toVector(store.getDeterminant(0)), (std::vector<us>{0, 1}));
+    EXPECT_EQ(toVector(store.getDependent(0)), (std::vector<us>{2}));
+    EXPECT_EQ(toVector(store.getDeterminant(1)), (std::vector<us>{2}));
+    EXPECT_EQ(toVector(store.getDependent(1)), (std::vector<us>{0, 3}));
+    EXPECT_EQ(store.toFunctionalDependency(1).toString(dictionary), "C -> (A, D)");
+}
+
+TEST(DependencyStore, IndexesByAttribute)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const DependencyStore store({{dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A", "D"})}, {dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"A", "B"})}}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(toVector(store.getDependenciesWithDeterminant(0)), (std::vector<ui>{0, 2}));
+    EXPECT_EQ(toVector(store.getDependenciesWithDeterminant(2)), (std::vector<ui>{1}));
+    EXPECT_TRUE(store.getDependenciesWithDeterminant(3).empty());
+
+    EXPECT_EQ(toVector(store.getDependenciesMentioning(0)), (std::vector<ui>{0, 1, 2}));
+    EXPECT_EQ(toVector(store.getDependenciesMentioning(3)), (std::vector<ui>{1}));
+}
\ No newline at end of file
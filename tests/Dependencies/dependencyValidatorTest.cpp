@@ -0,0 +1,73 @@
+/*! \file dependencyValidatorTest.cpp
+    \brief C++ file for creating tests for checking declared functional dependencies against the rows of a table.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Table/Instance/tableInstance.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::validation::DependencyValidator;
+using normalizer::dependencies::validation::DependencyViolation;
+using normalizer::file::CsvReader;
+using normalizer::table::instance::TableInstance;
+
+TEST(DependencyValidator, ReportsBrokenDependenciesWithRows)
+{
+    std::string contents = "C,A,B";
+
+    for (ui row = 0; row < 3000; ++row) // B depends on A, and C on A and B together, but row 2000 gives its A a second B
+    {
+        contents += "\n" + std::to_string((row % 7) * (row % 11)) + "," + std::to_string(row % 7) + "," + std::to_string(row == 2000 ? 99 : row % 7 * 2);
+    }
+
+    const TableInstance instance = CsvReader::parse(contents);
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+
+    const std::vector<FunctionalDependency> dependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"A"})}};
+
+    const DependencyValidator validator(instance, dictionary);
+    const std::vector<DependencyViolation> violations = validator.validate(dependencies);
+
+    EXPECT_EQ(validator.getColumn(0), 1U);
+
+    ASSERT_EQ(violations.size(), 2U);
+    EXPECT_EQ(violations[0].dependency, dependencies[0]);
+    EXPECT_EQ(violations[0].groupCount, 1U);
+    EXPECT_EQ(violations[0].firstRow, 2000U % 7);
+    EXPECT_EQ(violations[0].secondRow, 2000U);
+    EXPECT_EQ(violations[1].dependency, dependencies[1]);
+    EXPECT_EQ(violations[1].groupCount, 6U);
+    EXPECT_EQ(instance.getValue(static_cast<ui>(violations[1].firstRow), 1), instance.getValue(static_cast<ui>(violations[1].secondRow), 1));
+    EXPECT_NE(instance.getValue(static_cast<ui>(violations[1].firstRow), 0), instance.getValue(static_cast<ui>(violations[1].secondRow), 0));
+}
+
+TEST(DependencyValidator, AcceptsDependenciesThatHold)
+{
+    const TableInstance instance = CsvReader::parse("A,B\n1,x\n2,y\n1,x\n3,x");
+    const AttributeDictionary dictionary = createDictionary({"A", "B"});
+
+    const DependencyValidator validator(instance, dictionary);
+
+    EXPECT_TRUE(validator.validate({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"A"})}}).empty());
+    EXPECT_EQ(validator.validate({{dictionary.createEmptySet(), dictionary.toAttributeSet({"B"})}}).size(), 1U);
+}
+
+TEST(DependencyValidator, RejectsMissingColumns)
+{
+    const TableInstance instance = CsvReader::parse("A,B\n1,x");
+
+    EXPECT_THROW(DependencyValidator(instance, createDictionary({"A", "C"})), std::invalid_argument);
+}
@@ -0,0 +1,72 @@
+/*! \file externalDependencyValidatorTest.cpp
+    \brief C++ file for creating tests for checking declared functional dependencies against the rows of a CSV data file larger than memory.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Validation/dependencyValidator.h"
+#include "Dependencies/Validation/externalDependencyValidator.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/tableHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::validation::DependencyValidator;
+using normalizer::dependencies::validation::DependencyViolation;
+using normalizer::dependencies::validation::ExternalDependencyValidator;
+using normalizer::file::CsvReader;
+using normalizer::file::TemporaryDirectory;
+using normalizer::table::external::ExternalPartitioner;
+
+TEST(ExternalDependencyValidator, MatchesValidatorOnEveryRow)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+
+    std::string contents = "C,A,B,D";
+
+    for (ui row = 0; row < 3000; ++row) // B depends on A, and C on A and B together, but rows 1500 and 2000 give their A a second B
+    {
+        contents += "\n" + std::to_string((row % 7) * (row % 11)) + "," + std::to_string(row % 23) + "," + std::to_string(row == 1500 || row == 2000 ? 99 : row % 23 * 2) + "," + std::to_string(row);
+    }
+
+    const std::string csvPath = writeRows(directory, contents);
+
+    AttributeDictionary dictionary;
+
+    for (const std::string name : {"A", "B", "C", "D"})
+    {
+        dictionary.addAttribute(name);
+    }
+
+    const std::vector<FunctionalDependency> dependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"D"}), dictionary.toAttributeSet({"A", "C"})}, {dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})}, {dictionary.createEmptySet(), dictionary.toAttributeSet({"B"})}};
+
+    const std::vector<DependencyViolation> expected = DependencyValidator(CsvReader(csvPath).read(), dictionary).validate(dependencies);
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 4096);
+
+    const std::vector<DependencyViolation> violations = ExternalDependencyValidator(partitioner, dictionary).validate(dependencies);
+
+    EXPECT_GT(partitioner.getSpilledBytes(), 0U);
+
+    ASSERT_EQ(violations.size(), expected.size());
+    ASSERT_EQ(violations.size(), 4U);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(violations[i].dependency, expected[i].dependency);
+        EXPECT_EQ(violations[i].groupCount, expected[i].groupCount);
+        EXPECT_EQ(violations[i].secondRow, expected[i].secondRow);
+        EXPECT_EQ(violations[i].firstValues, expected[i].firstValues);
+        EXPECT_EQ(violations[i].secondValues, expected[i].secondValues);
+    }
+}
@@ -0,0 +1,60 @@
+/*! \file externalDiscovererTest.cpp
+    \brief C++ file for creating tests for discovering the functional dependencies of a CSV data file larger than memory.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Dependencies/Discovery/externalDiscoverer.h"
+#include "Dependencies/Discovery/taneDiscoverer.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+#include "Table/Sampling/reservoirSampler.h"
+#include "Table/tableHelper.h"
+
+using normalizer::dependencies::discovery::ExternalDiscoverer;
+using normalizer::dependencies::discovery::TaneDiscoverer;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::file::CsvReader;
+using normalizer::file::TemporaryDirectory;
+using normalizer::table::external::ExternalPartitioner;
+using normalizer::table::instance::TableInstance;
+using normalizer::table::sampling::ReservoirSampler;
+
+TEST(ExternalDiscoverer, MatchesDiscoveryOnEveryRow)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+
+    std::string contents = "A,B,C,D,E";
+
+    for (ui row = 0; row < 3000; ++row) // B depends on A but for rows 1500 and 2000, and E is constant but for the last row, which a small sample is likely to miss
+    {
+        contents += "\n" + std::to_string(row % 23) + "," + std::to_string(row == 1500 || row == 2000 ? 99 : row % 23 * 2) + "," + std::to_string((row % 7) * (row % 11)) + "," + std::to_string(row) + "," + (row == 2999 ? "1" : "0");
+    }
+
+    const std::string csvPath = writeRows(directory, contents);
+
+    const TableInstance instance = CsvReader(csvPath).read();
+    const std::vector<FunctionalDependency> expected = TaneDiscoverer(instance).discover();
+
+    ReservoirSampler sampler(csvPath, 40);
+    const TableInstance sample = sampler.sample();
+
+    TaneDiscoverer sampleDiscoverer(sample);
+    const std::vector<FunctionalDependency> sampleDependencies = sampleDiscoverer.discover();
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 4096);
+    ExternalDiscoverer discoverer(partitioner, sampleDiscoverer.getAttributeDictionary());
+
+    EXPECT_NE(sampleDependencies, expected);
+    EXPECT_EQ(discoverer.discover(sampleDependencies), expected);
+    EXPECT_GT(discoverer.getValidationCount(), 0U);
+    EXPECT_GT(partitioner.getSpilledBytes(), 0U);
+}
@@ -0,0 +1,115 @@
+/*! \file hybridDiscovererTest.cpp
+    \brief C++ file for creating tests for discovering the functional dependencies of a wide table by sampling and validating.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Discovery/dependencyTree.h"
+#include "Dependencies/Discovery/hybridDiscoverer.h"
+#include "Dependencies/Discovery/taneDiscoverer.h"
+#include "FileManager/csvReader.h"
+#include "Table/Instance/tableInstance.h"
+
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::discovery::DependencyTree;
+using normalizer::dependencies::discovery::HybridDiscoverer;
+using normalizer::dependencies::discovery::TaneDiscoverer;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::file::CsvReader;
+using normalizer::table::instance::TableInstance;
+
+namespace
+{
+    AttributeSet createSet(const us count, const std::vector<us> &columns)
+    {
+        AttributeSet attributeSet(count);
+
+        for (const us column : columns)
+        {
+            attributeSet.addAttribute(column);
+        }
+
+        return attributeSet;
+    }
+
+    std::vector<std::pair<std::vector<us>, us>> toPairs(const std::vector<FunctionalDependency> &dependencies)
+    {
+        std::vector<std::pair<std::vector<us>, us>> pairs;
+
+        for (const FunctionalDependency &dependency : dependencies)
+        {
+            pairs.push_back({dependency.getDeterminant().getAttributes(), dependency.getDependent().findFirst()});
+        }
+
+        return pairs;
+    }
+}
+
+TEST(DependencyTree, FindsAndRemovesGeneralizations)
+{
+    DependencyTree tree(4);
+
+    tree.addDependency(createSet(4, {}), 0);
+    tree.addDependency(createSet(4, {}), 3);
+    tree.removeDependency(createSet(4, {}), 3);
+    tree.addDependency(createSet(4, {0, 1}), 3);
+    tree.addDependency(createSet(4, {2}), 3);
+
+    EXPECT_TRUE(tree.containsGeneralization(createSet(4, {0, 1, 2}), 3));
+    EXPECT_FALSE(tree.containsGeneralization(createSet(4, {0}), 3));
+    EXPECT_EQ(tree.getDepth(), 2U);
+    EXPECT_EQ(tree.getLevel(1).size(), 1U);
+
+    const std::vector<AttributeSet> removed = tree.removeGeneralizations(createSet(4, {0, 1, 2}), 3);
+
+    ASSERT_EQ(removed.size(), 2U);
+    EXPECT_FALSE(tree.containsGeneralization(createSet(4, {0, 1, 2}), 3));
+    EXPECT_TRUE(tree.containsGeneralization(createSet(4, {}), 0)); // Other right hand sides are untouched
+}
+
+TEST(HybridDiscoverer, MatchesLatticeSearch)
+{
+    for (ui seed = 1; seed <= 4; ++seed)
+    {
+        std::string contents = "A,B,C,D,E,F,G,H";
+        ui state = seed;
+
+        for (ui row = 0; row < 80; ++row) // Pseudo random columns with a few dependencies between them
+        {
+            std::vector<ui> values;
+
+            for (ui column = 0; column < 5; ++column)
+            {
+                state = state * 1103515245U + 12345U;
+                values.push_back((state >> 16) % (2 + column * seed));
+            }
+
+            values.push_back((values[0] + values[1]) % 3);
+            values.push_back(values[2] * 2 + values[3] % 2);
+            values.push_back(row % 7);
+
+            contents += "\n";
+
+            for (std::size_t column = 0; column < values.size(); ++column)
+            {
+                contents += (column == 0 ? "" : ",") + std::to_string(values[column]);
+            }
+        }
+
+        const TableInstance instance = CsvReader::parse(contents);
+        TaneDiscoverer taneDiscoverer(instance);
+        HybridDiscoverer hybridDiscoverer(instance);
+
+        EXPECT_EQ(toPairs(hybridDiscoverer.discover()), toPairs(taneDiscoverer.discover())) << "seed " << seed;
+        EXPECT_GT(hybridDiscoverer.getComparisonCount(), 0U);
+        EXPECT_GT(hybridDiscoverer.getValidationCount(), 0U);
+    }
+}
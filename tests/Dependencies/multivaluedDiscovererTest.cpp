@@ -0,0 +1,69 @@
+/*! \file multivaluedDiscovererTest.cpp
+    \brief C++ file for creating tests for discovering the multi valued dependencies of the rows of a table.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Discovery/taneDiscoverer.h"
+#include "Dependencies/Discovery/multivaluedDiscoverer.h"
+#include "Dependencies/Discovery/dependencyFileWriter.h"
+#include "FileManager/csvReader.h"
+#include "Table/Instance/tableInstance.h"
+
+using normalizer::dependencies::discovery::DependencyFileWriter;
+using normalizer::dependencies::discovery::MultivaluedDiscoverer;
+using normalizer::dependencies::discovery::TaneDiscoverer;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::multivalued::MultivaluedDependency;
+using normalizer::file::CsvReader;
+using normalizer::table::instance::TableInstance;
+
+TEST(MultivaluedDiscoverer, FindsIndependentColumns)
+{
+    std::string contents = "Ename,Pname,Dname,Salary";
+
+    for (const std::string &employee : std::vector<std::string>{"Smith", "Jones"}) // Every project of an employee appears with every dependent of the employee
+    {
+        for (const std::string &project : std::vector<std::string>{"X", "Y", "Z"})
+        {
+            for (const std::string &dependentName : std::vector<std::string>{"Anna", "Bob"})
+            {
+                contents += "\n" + employee + "," + employee + project + "," + employee + dependentName + "," + (employee == "Smith" ? "10" : "20");
+            }
+        }
+    }
+
+    contents += "\nBrown,BrownX,BrownAnna,30\nBrown,BrownY,BrownBob,30"; // Brown breaks Ename ->> Pname, unless Pname determines Dname
+
+    const TableInstance instance = CsvReader::parse(contents);
+    TaneDiscoverer discoverer(instance);
+    const std::vector<FunctionalDependency> dependencies = discoverer.discover();
+    MultivaluedDiscoverer multivaluedDiscoverer(instance, dependencies);
+
+    EXPECT_TRUE(multivaluedDiscoverer.discover().empty());
+
+    const TableInstance crossProduct = CsvReader::parse(contents.substr(0, contents.find("\nBrown")));
+    TaneDiscoverer crossDiscoverer(crossProduct);
+    const std::vector<FunctionalDependency> crossDependencies = crossDiscoverer.discover();
+    MultivaluedDiscoverer crossMultivaluedDiscoverer(crossProduct, crossDependencies);
+
+    std::vector<std::string> found;
+
+    for (const MultivaluedDependency &multivaluedDependency : crossMultivaluedDiscoverer.discover())
+    {
+        found.push_back(multivaluedDependency.toString(crossMultivaluedDiscoverer.getAttributeDictionary()));
+    }
+
+    EXPECT_EQ(found, (std::vector<std::string>{"Ename ->> Pname", "Ename ->> Dname", "Salary ->> Pname", "Salary ->> Dname"}));
+
+    const DependencyFileWriter writer(crossDiscoverer.getAttributeDictionary(), crossDependencies, crossMultivaluedDiscoverer.discover());
+
+    EXPECT_NE(writer.toString().find("Ename ->> (Pname, Dname)\n"), std::string::npos);
+}
@@ -0,0 +1,83 @@
+/*! \file primeAttributeServiceTest.cpp
+    \brief C++ file for creating tests for prime attribute and superkey queries.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Keys/primeAttributeService.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::dependencies::keys::PrimeAttributeService;
+
+TEST(PrimeAttributeService, PrimeAttributesFromEveryKey)
+{
+    const AttributeDictionary dictionary = createDictionary({"StudentID", "Course", "Instructor"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"StudentID", "Course"}), dictionary.toAttributeSet({"Instructor"})}, {dictionary.toAttributeSet({"Instructor"}), dictionary.toAttributeSet({"Course"})}}, dictionary.getAttributeCount()));
+    const PrimeAttributeService primeService(closureCache);
+
+    EXPECT_EQ(primeService.getCandidateKeys().size(), 2U);
+    EXPECT_EQ(dictionary.toString(primeService.getPrimeAttributes()), "(StudentID, Course, Instructor)");
+    EXPECT_TRUE(primeService.isPrime(dictionary.getAttributeId("Instructor")));
+}
+
+TEST(PrimeAttributeService, NonPrimeAttributes)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"D"})}}, dictionary.getAttributeCount()));
+    const PrimeAttributeService primeService(closureCache);
+
+    EXPECT_EQ(dictionary.toString(primeService.getPrimeAttributes()), "(A, B)");
+    EXPECT_FALSE(primeService.isPrime(dictionary.getAttributeId("C")));
+    EXPECT_FALSE(primeService.isPrime(dictionary.getAttributeId("D")));
+}
+
+TEST(PrimeAttributeService, SuperkeysAcrossSeveralBatches)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C", "B"}), dictionary.toAttributeSet({"D"})}}, dictionary.getAttributeCount()));
+    const PrimeAttributeService primeService(closureCache);
+
+    std::vector<AttributeSet> queries;
+    std::vector<bool> expected;
+
+    for (ui i = 0; i < 150; ++i) // Every subset of the four attributes, repeated past the size of one batch
+    {
+        AttributeSet query = dictionary.createEmptySet();
+
+        for (us attributeId = 0; attributeId < dictionary.getAttributeCount(); ++attributeId)
+        {
+            if (((i % 16) >> attributeId) & 1)
+            {
+                query.addAttribute(attributeId);
+            }
+        }
+
+        expected.push_back(dictionary.createFullSet().isSubsetOf(closureCache.getCalculator().computeClosure(query)));
+        queries.push_back(query);
+    }
+
+    EXPECT_EQ(primeService.areSuperkeys(queries), expected);
+}
+
+TEST(PrimeAttributeService, SuperkeysOfRelation)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"D"})}}, dictionary.getAttributeCount()));
+    const PrimeAttributeService primeService(closureCache);
+
+    const std::vector<bool> superkeys = primeService.areSuperkeys({dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"B"})}, dictionary.toAttributeSet({"A", "C", "D"}));
+
+    EXPECT_EQ(superkeys, (std::vector<bool>{true, false, false}));
+}
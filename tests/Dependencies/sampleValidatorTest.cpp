@@ -0,0 +1,90 @@
+/*! \file sampleValidatorTest.cpp
+    \brief C++ file for creating tests for checking functional dependencies against a uniform sample of the rows of a table.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Validation/sampleValidator.h"
+#include "Table/Instance/tableInstance.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::validation::DependencyEstimate;
+using normalizer::dependencies::validation::SampleValidator;
+using normalizer::file::CsvReader;
+using normalizer::table::instance::TableInstance;
+
+TEST(SampleValidator, ReportsBreaksByTheirRowsInTheTable)
+{
+    const TableInstance sample = CsvReader::parse("A,B,C\n1,x,p\n2,y,p\n1,x,q\n1,z,q\n3,y,r");
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+
+    const SampleValidator validator(sample, {4, 10, 25, 40, 41}, 1000, dictionary);
+
+    const std::vector<DependencyEstimate> estimates = validator.estimate({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"})}, {dictionary.toAttributeSet({"B", "C"}), dictionary.toAttributeSet({"A"})}}, 0);
+
+    ASSERT_EQ(estimates.size(), 3U);
+
+    EXPECT_EQ(estimates[0].violation.groupCount, 1U);
+    EXPECT_EQ(estimates[0].violation.firstRow, 4U);
+    EXPECT_EQ(estimates[0].violation.secondRow, 40U);
+    EXPECT_EQ(estimates[0].violation.secondValues, (std::vector<std::string>{"1", "z"}));
+    EXPECT_EQ(estimates[0].repeatedRows, 2U);
+
+    EXPECT_EQ(estimates[1].violation.groupCount, 1U);
+    EXPECT_EQ(estimates[1].violation.secondRow, 10U);
+
+    EXPECT_EQ(estimates[2].violation.groupCount, 0U);
+    EXPECT_EQ(estimates[2].repeatedRows, 0U);
+    EXPECT_DOUBLE_EQ(estimates[2].brokenShareBound, 1); // No sampled row tests it
+}
+
+TEST(SampleValidator, BoundsDependenciesTheSampleHolds)
+{
+    std::string contents = "A,B";
+
+    for (ui row = 0; row < 200; ++row)
+    {
+        contents += "\n" + std::to_string(row % 20) + "," + std::to_string(row % 20 * 3);
+    }
+
+    const TableInstance sample = CsvReader::parse(contents);
+    const AttributeDictionary dictionary = createDictionary({"A", "B"});
+    const std::vector<FunctionalDependency> dependencies = {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}};
+
+    std::vector<ul> rows;
+
+    for (ul row = 0; row < 200; ++row)
+    {
+        rows.push_back(row * 50);
+    }
+
+    const std::vector<DependencyEstimate> estimates = SampleValidator(sample, rows, 10000, dictionary).estimate(dependencies, 0);
+
+    ASSERT_EQ(estimates.size(), 1U);
+    EXPECT_EQ(estimates[0].violation.groupCount, 0U);
+    EXPECT_EQ(estimates[0].repeatedRows, 180U);
+    EXPECT_NEAR(estimates[0].brokenShareBound, 1 - std::pow(0.05, 1.0 / 180), 1e-12);
+    EXPECT_NEAR(estimates[0].brokenShareBound, 3.0 / 180, 0.001);
+    EXPECT_EQ(estimates[0].brokenPairBound, 0U); // Only a key is bounded by pairs of rows
+
+    const std::vector<DependencyEstimate> keyEstimates = SampleValidator(sample, rows, 10000, dictionary).estimate(dependencies, 1);
+    const double pairShare = 200.0 * 199 / (10000.0 * 9999);
+
+    EXPECT_EQ(keyEstimates[0].brokenPairBound, static_cast<ul>(std::ceil(std::log(0.05) / std::log1p(-pairShare))));
+
+    const std::vector<DependencyEstimate> exact = SampleValidator(sample, rows, 200, dictionary).estimate(dependencies, 1);
+
+    EXPECT_DOUBLE_EQ(exact[0].brokenShareBound, 0); // The sample holds every row
+    EXPECT_EQ(exact[0].brokenPairBound, 0U);
+}
@@ -0,0 +1,247 @@
+/*! \file taneDiscovererTest.cpp
+    \brief C++ file for creating tests for discovering the functional dependencies of the rows of a table.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Discovery/strippedPartition.h"
+#include "Dependencies/Discovery/taneDiscoverer.h"
+#include "Dependencies/Discovery/dependencyFileWriter.h"
+#include "FileManager/csvReader.h"
+#include "Table/Instance/tableInstance.h"
+
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::discovery::DependencyFileWriter;
+using normalizer::dependencies::discovery::StrippedPartition;
+using normalizer::dependencies::discovery::TaneDiscoverer;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::file::CsvReader;
+using normalizer::table::instance::TableInstance;
+
+namespace
+{
+    bool holds(const TableInstance &instance, const std::vector<us> &determinant, const us dependent)
+    {
+        for (ui first = 0; first < instance.getRowCount(); ++first)
+        {
+            for (ui second = first + 1; second < instance.getRowCount(); ++second)
+            {
+                bool agree = true;
+
+                for (const us column : determinant)
+                {
+                    agree = agree && instance.getColumn(column)[first] == instance.getColumn(column)[second];
+                }
+
+                if (agree && instance.getColumn(dependent)[first] != instance.getColumn(dependent)[second])
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    ui countViolations(const TableInstance &instance, const std::vector<us> &determinant, const us dependent)
+    {
+        std::map<std::vector<ui>, std::map<ui, ui>> groups;
+
+        for (ui row = 0; row < instance.getRowCount(); ++row)
+        {
+            std::vector<ui> key;
+
+            for (const us column : determinant)
+            {
+                key.push_back(instance.getColumn(column)[row]);
+            }
+
+            ++groups[key][instance.getColumn(dependent)[row]];
+        }
+
+        ui violationCount = 0;
+
+        for (const auto &group : groups)
+        {
+            ui size = 0;
+            ui largest = 0;
+
+            for (const auto &value : group.second)
+            {
+                size += value.second;
+                largest = std::max(largest, value.second);
+            }
+
+            violationCount += size - largest;
+        }
+
+        return violationCount;
+    }
+}
+
+TEST(StrippedPartition, ProductOfColumns)
+{
+    const TableInstance instance = CsvReader::parse("A,B\n1,x\n1,x\n1,y\n2,x\n2,x");
+
+    StrippedPartition first(instance.getColumn(0), instance.getDistinctCount(0));
+    StrippedPartition second(instance.getColumn(1), instance.getDistinctCount(1));
+    std::vector<ui> probeTable(instance.getRowCount(), StrippedPartition::NO_CLASS);
+
+    EXPECT_EQ(first.getClassCount(), 2U);
+    EXPECT_EQ(first.getErrorCount(), 3U);
+
+    const StrippedPartition product = first.multiply(second, probeTable);
+
+    EXPECT_EQ(product.getClassCount(), 2U); // Row 2 is the only 1 with y, so it is stripped
+    EXPECT_EQ(product.getErrorCount(), 2U);
+    EXPECT_EQ(probeTable, std::vector<ui>(instance.getRowCount(), StrippedPartition::NO_CLASS));
+}
+
+TEST(TaneDiscoverer, MatchesEveryMinimalDependency)
+{
+    std::string contents = "A,B,C,D,E";
+
+    for (ui row = 0; row < 60; ++row) // A fixed pseudo random table with a few dependencies
+    {
+        const ui a = (row * 7) % 11;
+        const ui b = a % 3;
+        const ui c = (row * 5) % 4;
+        const ui d = (b + c) % 5;
+        const ui e = (row * 13) % 6;
+
+        contents += "\n" + std::to_string(a) + "," + std::to_string(b) + "," + std::to_string(c) + "," + std::to_string(d) + "," + std::to_string(e);
+    }
+
+    const TableInstance instance = CsvReader::parse(contents);
+    TaneDiscoverer discoverer(instance);
+
+    std::set<std::pair<std::vector<us>, us>> found;
+
+    for (const FunctionalDependency &dependency : discoverer.discover())
+    {
+        found.insert({dependency.getDeterminant().getAttributes(), dependency.getDependent().findFirst()});
+    }
+
+    std::set<std::pair<std::vector<us>, us>> expected;
+    const us columnCount = instance.getColumnCount();
+
+    for (ui mask = 0; mask < (1U << columnCount); ++mask)
+    {
+        std::vector<us> determinant;
+
+        for (us column = 0; column < columnCount; ++column)
+        {
+            if (mask & (1U << column))
+            {
+                determinant.push_back(column);
+            }
+        }
+
+        for (us dependent = 0; dependent < columnCount; ++dependent)
+        {
+            if ((mask & (1U << dependent)) || !holds(instance, determinant, dependent))
+            {
+                continue;
+            }
+
+            bool minimal = true;
+
+            for (const us removed : determinant)
+            {
+                std::vector<us> subset;
+
+                for (const us column : determinant)
+                {
+                    if (column != removed)
+                    {
+                        subset.push_back(column);
+                    }
+                }
+
+                minimal = minimal && !holds(instance, subset, dependent);
+            }
+
+            if (minimal)
+            {
+                expected.insert({determinant, dependent});
+            }
+        }
+    }
+
+    EXPECT_EQ(found, expected);
+}
+
+TEST(DependencyFileWriter, WritesSingleRowDeterminants)
+{
+    const TableInstance instance = CsvReader::parse("StudentID,Name,\"Course, Section\",Room\r\n1,Ann,CS101,R1\r\n1,Ann,MA101,R2\r\n2,\"Ben \"\"B\"\"\",CS101,R1\r\n\r\n2,\"Ben \"\"B\"\"\",MA101,R3");
+
+    ASSERT_EQ(instance.getRowCount(), 4U);
+    EXPECT_EQ(instance.getColumnNames()[2], "Course, Section");
+    EXPECT_EQ(instance.getValue(2, 1), "Ben \"B\"");
+
+    TaneDiscoverer discoverer(instance);
+    const DependencyFileWriter writer(discoverer.getAttributeDictionary(), discoverer.discover());
+
+    EXPECT_EQ(writer.toString(), "StudentID -> Name\nName -> StudentID\nRoom -> Course, Section\nKEY: (StudentID, Room)");
+    ASSERT_EQ(writer.getUnwrittenDependencies().size(), 2U); // (StudentID, Course, Section) -> Room and (Name, Course, Section) -> Room
+}
+
+TEST(TaneDiscoverer, FindsApproximateDependencies)
+{
+    std::string contents = "ProfessorEmail,Professor,Course";
+
+    for (ui row = 0; row < 40; ++row)
+    {
+        contents += "\np" + std::to_string(row % 4) + "@school.edu,Professor" + std::to_string(row % 4) + ",C" + std::to_string(row % 10);
+    }
+
+    contents += "\np1@school.edu,Professor2,C3"; // One dirty row breaks ProfessorEmail -> Professor
+
+    const TableInstance instance = CsvReader::parse(contents);
+    TaneDiscoverer exactDiscoverer(instance);
+    TaneDiscoverer approximateDiscoverer(instance, 0.05);
+
+    std::vector<FunctionalDependency> exactDependencies = exactDiscoverer.discover();
+    std::vector<FunctionalDependency> approximateDependencies = approximateDiscoverer.discover();
+
+    AttributeSet email(3);
+    AttributeSet professor(3);
+    email.addAttribute(0);
+    professor.addAttribute(1);
+
+    const FunctionalDependency emailDependency(email, professor);
+
+    EXPECT_EQ(std::count(exactDependencies.begin(), exactDependencies.end(), emailDependency), 0);
+    ASSERT_EQ(std::count(approximateDependencies.begin(), approximateDependencies.end(), emailDependency), 1);
+    EXPECT_EQ(approximateDiscoverer.getViolationCount(emailDependency), 1U);
+
+    for (const FunctionalDependency &dependency : approximateDependencies) // Every dependency found is within the threshold, and none of its generalizations are
+    {
+        const std::vector<us> determinant = dependency.getDeterminant().getAttributes();
+        const us dependent = dependency.getDependent().findFirst();
+
+        EXPECT_EQ(approximateDiscoverer.getViolationCount(dependency), countViolations(instance, determinant, dependent));
+        EXPECT_LE(countViolations(instance, determinant, dependent), 2U);
+
+        for (const us removed : determinant)
+        {
+            std::vector<us> subset;
+
+            std::copy_if(determinant.begin(), determinant.end(), std::back_inserter(subset), [removed](const us column)
+                         { return column != removed; });
+
+            EXPECT_GT(countViolations(instance, subset, dependent), 2U);
+        }
+    }
+}
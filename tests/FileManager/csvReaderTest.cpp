@@ -0,0 +1,92 @@
+/*! \file csvReaderTest.cpp
+    \brief C++ file for creating tests for reading the rows of a CSV data file.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "constants.h"
+#include "FileManager/csvReader.h"
+#include "Table/table.h"
+#include "Table/TableRow/tableRow.h"
+#include "Table/TableRow/RowDefinition/genericRowDefinition.h"
+#include "Table/Instance/tableInstance.h"
+
+using normalizer::file::CsvReader;
+using normalizer::table::Table;
+using normalizer::table::instance::TableInstance;
+using normalizer::table::row::GenericRowDefinition;
+
+namespace
+{
+    void expectSameRows(const TableInstance &actual, const TableInstance &expected)
+    {
+        ASSERT_EQ(actual.getColumnNames(), expected.getColumnNames());
+        ASSERT_EQ(actual.getRowCount(), expected.getRowCount());
+
+        for (us column = 0; column < expected.getColumnCount(); ++column)
+        {
+            EXPECT_EQ(actual.getColumn(column), expected.getColumn(column)) << "column " << column; // The identifiers follow the order the values first appear in
+
+            for (ui row = 0; row < expected.getRowCount(); ++row)
+            {
+                EXPECT_EQ(actual.getValue(row, column), expected.getValue(row, column));
+            }
+        }
+    }
+}
+
+TEST(CsvReader, ChunksSplitOnlyBetweenRows)
+{
+    std::string contents = "Id,Note,\"Code, Part\"\r\n";
+    TableInstance expected({"Id", "Note", "Code, Part"});
+
+    for (ui row = 0; row < 60; ++row)
+    {
+        const std::string note = row % 3 == 0 ? "line one\nline \"\"two\"\", still one" : "plain " + std::to_string(row % 5);
+
+        contents += std::to_string(row % 7) + ",\"" + note + "\"," + std::to_string(row % 4) + "\r\n" + (row % 10 == 0 ? "\n" : "");
+        expected.addRow({std::to_string(row % 7), row % 3 == 0 ? "line one\nline \"two\", still one" : note, std::to_string(row % 4)});
+    }
+
+    for (const std::size_t chunkBytes : {1U, 2U, 3U, 7U, 16U, 61U, 1000U, 1U << 20})
+    {
+        SCOPED_TRACE(chunkBytes);
+        expectSameRows(CsvReader::parse(contents, chunkBytes), expected);
+    }
+}
+
+TEST(CsvReader, ThrowsOnRowWidthMismatch)
+{
+    EXPECT_THROW(CsvReader::parse("A,B\n1,2\n3,4\n5\n6,7", 4), std::invalid_argument);
+    EXPECT_EQ(CsvReader::parse("", 4).getColumnCount(), 0U);
+    EXPECT_EQ(CsvReader::parse("\n\nA,B\n\n", 4).getRowCount(), 0U);
+}
+
+TEST(CsvReader, MapsFileAndMatchesTableColumns)
+{
+    const CsvReader reader(normalizer::file::DATA_FOLDER + "dataset.csv");
+    const TableInstance instance = reader.read();
+
+    expectSameRows(instance, CsvReader::parse(normalizer::file::FileManager(normalizer::file::DATA_FOLDER + "dataset.csv").grabFileContents()));
+
+    Table table("TESTING");
+
+    table.addTableRow({"Course", GenericRowDefinition("VARCHAR")});
+    table.addTableRow({"StudentID", GenericRowDefinition("INT")});
+
+    const TableInstance matched = reader.read(table);
+
+    ASSERT_EQ(matched.getColumnNames(), (std::vector<std::string>{"Course", "StudentID"}));
+    EXPECT_EQ(matched.getColumn(0), instance.getColumn(3));
+    EXPECT_EQ(matched.getColumn(1), instance.getColumn(0));
+
+    table.addTableRow({"Room", GenericRowDefinition("VARCHAR")});
+
+    EXPECT_THROW(reader.read(table), std::invalid_argument);
+}
@@ -0,0 +1,76 @@
+/*! \file dataJoinVerifierTest.cpp
+    \brief C++ file for creating tests for verifying on the rows of a table that a decomposition is lossless.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Normalizer/Verification/dataJoinVerifier.h"
+#include "Table/table.h"
+#include "Table/TableRow/RowDefinition/genericRowDefinition.h"
+#include "Table/Instance/tableInstance.h"
+#include "Table/tableHelper.h"
+
+using normalizer::file::CsvReader;
+using normalizer::materialization::TableMaterializer;
+using normalizer::table::Table;
+using normalizer::table::instance::TableInstance;
+using normalizer::verification::DataJoinVerifier;
+
+TEST(DataJoinVerifier, JoinsLosslessDecompositionBack)
+{
+    std::string contents = "A,B,C,D";
+
+    for (ui row = 0; row < 5000; ++row) // C depends on A alone, so splitting it off is lossless
+    {
+        contents += "\n" + std::to_string(row % 97) + "," + std::to_string(row % 13) + "," + std::to_string((row % 97) * 3 % 11) + "," + std::to_string(row % 5);
+    }
+
+    const TableInstance instance = CsvReader::parse(contents);
+    TableMaterializer materializer(instance, {createTable("AC", {"A", "C"}), createTable("ABD", {"A", "B", "D"})});
+
+    materializer.materialize();
+
+    DataJoinVerifier verifier(instance, materializer);
+
+    EXPECT_TRUE(verifier.verify());
+    EXPECT_EQ(verifier.getJoinedRowCount(), verifier.getDistinctRowCount());
+    EXPECT_TRUE(verifier.getSpuriousRows().empty());
+    EXPECT_TRUE(verifier.getMissingRows().empty());
+}
+
+TEST(DataJoinVerifier, ReportsSpuriousRows)
+{
+    const TableInstance instance = CsvReader::parse("A,B,C\n1,x,p\n2,x,q\n2,x,q");
+    TableMaterializer materializer(instance, {createTable("AB", {"A", "B"}), createTable("BC", {"B", "C"})});
+
+    materializer.materialize();
+
+    DataJoinVerifier verifier(instance, materializer);
+
+    EXPECT_FALSE(verifier.verify());
+    EXPECT_EQ(verifier.getDistinctRowCount(), 2U);
+    EXPECT_GT(verifier.getJoinedRowCount(), 2U);
+    EXPECT_EQ(verifier.getSpuriousRows(), (std::vector<std::vector<std::string>>{{"1", "x", "q"}, {"2", "x", "p"}}));
+    EXPECT_TRUE(verifier.getMissingRows().empty());
+}
+
+TEST(DataJoinVerifier, ReportsUncoveredColumns)
+{
+    const TableInstance instance = CsvReader::parse("A,B,C\n1,x,p\n2,y,q");
+    TableMaterializer materializer(instance, {createTable("AB", {"A", "B"})});
+
+    materializer.materialize();
+
+    DataJoinVerifier verifier(instance, materializer);
+
+    EXPECT_FALSE(verifier.verify()); // The rows on A and B come back, but C is lost
+    EXPECT_EQ(verifier.getUncoveredColumns(), std::vector<us>{2});
+    EXPECT_EQ(verifier.getJoinedRowCount(), 2U);
+}
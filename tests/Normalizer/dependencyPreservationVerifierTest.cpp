@@ -0,0 +1,96 @@
+/*! \file dependencyPreservationVerifierTest.cpp
+    \brief C++ file for creating tests for verifying that a decomposition preserves its dependencies.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Normalizer/Verification/dependencyPreservationVerifier.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::verification::DependencyPreservationVerifier;
+
+TEST(DependencyPreservationVerifier, DependencyPreservedAcrossTables)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"})}}, dictionary.getAttributeCount()));
+    DependencyPreservationVerifier verifier(closureCache);
+
+    EXPECT_TRUE(verifier.verify({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})}));
+    EXPECT_TRUE(verifier.getLostDependencies().empty());
+}
+
+TEST(DependencyPreservationVerifier, BCNFDecompositionLosesDependency)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount()));
+    DependencyPreservationVerifier verifier(closureCache);
+
+    EXPECT_FALSE(verifier.verify({dictionary.toAttributeSet({"A", "C"}), dictionary.toAttributeSet({"B", "C"})}));
+    ASSERT_EQ(verifier.getLostDependencies().size(), 1U);
+    EXPECT_EQ(verifier.getLostDependencies()[0].toString(dictionary), "(A, B) -> C");
+}
+
+TEST(DependencyPreservationVerifier, ManyDependenciesCheckedInParallel)
+{
+    AttributeDictionary dictionary;
+    std::vector<FunctionalDependency> functionalDependencies;
+    std::vector<AttributeSet> components;
+
+    for (us attributeId = 0; attributeId < 512; ++attributeId)
+    {
+        dictionary.addAttribute("A" + std::to_string(static_cast<ui>(attributeId)));
+    }
+
+    for (us attributeId = 0; attributeId + 1 < 512; ++attributeId)
+    {
+        AttributeSet determinant = dictionary.createEmptySet();
+        determinant.addAttribute(attributeId);
+
+        AttributeSet dependent = dictionary.createEmptySet();
+        dependent.addAttribute(static_cast<us>(attributeId + 1));
+
+        functionalDependencies.push_back({determinant, dependent});
+
+        if (attributeId != 300)
+        {
+            components.push_back(determinant | dependent);
+        }
+    }
+
+    ClosureCache closureCache(ClosureCalculator(functionalDependencies, dictionary.getAttributeCount()));
+    DependencyPreservationVerifier verifier(closureCache);
+
+    EXPECT_FALSE(verifier.verify(components));
+    ASSERT_EQ(verifier.getLostDependencies().size(), 1U);
+    EXPECT_EQ(verifier.getLostDependencies()[0].toString(dictionary), "A300 -> A301");
+
+    const ul missCount = closureCache.getMissCount();
+
+    EXPECT_FALSE(verifier.verify(components));
+    EXPECT_EQ(closureCache.getMissCount(), missCount);
+    EXPECT_GT(closureCache.getHitCount(), 0U);
+}
+
+TEST(DependencyPreservationVerifier, EmptyDeterminantPreservedInOtherTable)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.createEmptySet(), dictionary.toAttributeSet({"A"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}}, dictionary.getAttributeCount()));
+    DependencyPreservationVerifier verifier(closureCache);
+
+    EXPECT_TRUE(verifier.verify({dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})})); // A is constant, so its table holds it without sharing anything with B
+    EXPECT_TRUE(verifier.getLostDependencies().empty());
+}
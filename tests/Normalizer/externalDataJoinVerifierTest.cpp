@@ -0,0 +1,121 @@
+/*! \file externalDataJoinVerifierTest.cpp
+    \brief C++ file for creating tests for verifying on the rows of a CSV data file larger than memory that a decomposition is lossless.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Normalizer/Materialization/externalMaterializer.h"
+#include "Normalizer/Verification/externalDataJoinVerifier.h"
+#include "Table/table.h"
+#include "Table/TableRow/RowDefinition/genericRowDefinition.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/tableHelper.h"
+
+using normalizer::file::TemporaryDirectory;
+using normalizer::materialization::ExternalMaterializer;
+using normalizer::table::Table;
+using normalizer::table::external::ExternalPartitioner;
+using normalizer::verification::ExternalDataJoinVerifier;
+
+TEST(ExternalDataJoinVerifier, JoinsLosslessDecompositionBackInPartitions)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+
+    std::string contents = "A,B,C,D,E";
+
+    for (ui row = 0; row < 3000; ++row) // C depends on A, and E on D, so the three tables join back losslessly
+    {
+        contents += "\n" + std::to_string(row % 97) + "," + std::to_string(row % 13) + "," + std::to_string((row % 97) * 3 % 11) + "," + std::to_string(row % 5) + ",\"e, " + std::to_string(row % 5 * 7) + "\"";
+    }
+
+    const std::string csvPath = writeRows(directory, contents);
+    const std::vector<Table> tables = {createTable("AC", {"A", "C"}), createTable("ABD", {"A", "B", "D"}), createTable("DE", {"D", "E"})};
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 4096);
+    ExternalMaterializer materializer(partitioner, tables);
+    ExternalDataJoinVerifier verifier(csvPath, {"A", "B", "C", "D", "E"}, materializer, tables, directory.getPath(), 4096);
+
+    EXPECT_TRUE(verifier.verify());
+    EXPECT_GT(verifier.getSpilledBytes(), 0U);
+    EXPECT_EQ(verifier.getDistinctRowCount(), 3000U); // A, B and D only repeat every 97 * 13 * 5 rows
+    EXPECT_EQ(verifier.getJoinedRowCount(), verifier.getDistinctRowCount());
+    EXPECT_TRUE(verifier.getSpuriousRows().empty());
+    EXPECT_TRUE(verifier.getMissingRows().empty());
+}
+
+TEST(ExternalDataJoinVerifier, MatchesVerifierInMemory)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+
+    std::string contents = "A,B,C";
+
+    for (ui row = 0; row < 400; ++row) // B does not decide C, so the tables join back into spurious rows
+    {
+        contents += "\n" + std::to_string(row) + "," + std::to_string(row % 3) + "," + std::to_string(row % 4);
+    }
+
+    const std::string csvPath = writeRows(directory, contents);
+    const std::vector<Table> tables = {createTable("AB", {"A", "B"}), createTable("BC", {"B", "C"})};
+
+    std::vector<std::vector<std::vector<std::string>>> spuriousRows;
+
+    for (const ul memoryLimit : {1UL << 30, 1024UL})
+    {
+        ExternalPartitioner partitioner(csvPath, directory.getPath(), memoryLimit);
+        ExternalMaterializer materializer(partitioner, tables);
+        ExternalDataJoinVerifier verifier(csvPath, {"A", "B", "C"}, materializer, tables, directory.getPath(), memoryLimit);
+
+        EXPECT_FALSE(verifier.verify());
+        EXPECT_EQ(verifier.getDistinctRowCount(), 400U);
+        EXPECT_EQ(verifier.getJoinedRowCount(), 401U); // Joining stops once it passes the rows of the data, which are all distinct
+        EXPECT_EQ(verifier.getSpilledBytes() > 0, memoryLimit == 1024);
+    }
+
+    const std::string smallPath = writeRows(directory, "A,B,C\n1,x,p\n2,x,q\n2,x,q\n3,y,r\n4,y,r\n4,y,r\n4,y,r");
+
+    for (const ul memoryLimit : {1UL << 30, 64UL})
+    {
+        ExternalPartitioner partitioner(smallPath, directory.getPath(), memoryLimit);
+        ExternalMaterializer materializer(partitioner, {createTable("AB", {"A", "B"}), createTable("BC", {"B", "C"})});
+        ExternalDataJoinVerifier verifier(smallPath, {"A", "B", "C"}, materializer, {createTable("AB", {"A", "B"}), createTable("BC", {"B", "C"})}, directory.getPath(), memoryLimit);
+
+        EXPECT_FALSE(verifier.verify());
+        EXPECT_EQ(verifier.getDistinctRowCount(), 4U);
+        EXPECT_GT(verifier.getJoinedRowCount(), 4U);
+        EXPECT_TRUE(verifier.getMissingRows().empty());
+
+        std::vector<std::vector<std::string>> rows = verifier.getSpuriousRows();
+
+        std::sort(rows.begin(), rows.end()); // Partitions report their rows in the order of their hashes
+
+        spuriousRows.push_back(rows);
+    }
+
+    ASSERT_EQ(spuriousRows.size(), 2U);
+    EXPECT_EQ(spuriousRows[0], (std::vector<std::vector<std::string>>{{"1", "x", "q"}, {"2", "x", "p"}}));
+    EXPECT_EQ(spuriousRows[1], spuriousRows[0]);
+}
+
+TEST(ExternalDataJoinVerifier, ReportsUncoveredColumns)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+    const std::string csvPath = writeRows(directory, "A,B,C\n1,x,p\n2,y,q");
+    const std::vector<Table> tables = {createTable("AB", {"A", "B"})};
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 16);
+    ExternalMaterializer materializer(partitioner, tables);
+    ExternalDataJoinVerifier verifier(csvPath, {"A", "B", "C"}, materializer, tables, directory.getPath(), 16);
+
+    EXPECT_FALSE(verifier.verify()); // The rows on A and B come back, but C is lost
+    EXPECT_EQ(verifier.getUncoveredColumns(), std::vector<std::string>{"C"});
+    EXPECT_EQ(verifier.getJoinedRowCount(), 2U);
+    EXPECT_EQ(verifier.getDistinctRowCount(), 2U);
+}
@@ -0,0 +1,89 @@
+/*! \file fiveNFDecomposerTest.cpp
+    \brief C++ file for creating tests for decomposing relations into 5NF.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Normalizer/Decomposition/fiveNFDecomposer.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::decomposition::FiveNFDecomposer;
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::dependencies::join::JoinDependency;
+
+TEST(FiveNFDecomposer, SplitsAllKeyRelation)
+{
+    const AttributeDictionary dictionary = createDictionary({"Sname", "Part_name", "Proj_name"});
+    ClosureCache closureCache(ClosureCalculator({}, dictionary.getAttributeCount()));
+    const JoinDependency dependency({dictionary.toAttributeSet({"Sname", "Part_name"}), dictionary.toAttributeSet({"Part_name", "Proj_name"}), dictionary.toAttributeSet({"Sname", "Proj_name"})});
+    FiveNFDecomposer decomposer(closureCache, {dependency});
+
+    EXPECT_EQ(decomposer.findViolations(dictionary.createFullSet()).size(), 1U);
+
+    const std::vector<std::vector<AttributeSet>> components = decomposer.decompose({dictionary.createFullSet()});
+
+    ASSERT_EQ(components.size(), 1U);
+    ASSERT_EQ(components[0].size(), 3U);
+    EXPECT_EQ(dictionary.toString(components[0][0]), "(Sname, Part_name)");
+    EXPECT_EQ(dictionary.toString(components[0][1]), "(Part_name, Proj_name)");
+    EXPECT_EQ(dictionary.toString(components[0][2]), "(Sname, Proj_name)");
+}
+
+TEST(FiveNFDecomposer, JoinDependencyImpliedByKey)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}}, dictionary.getAttributeCount()));
+    FiveNFDecomposer decomposer(closureCache, {JoinDependency({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"A", "C"})})});
+
+    EXPECT_TRUE(decomposer.findViolations(dictionary.createFullSet()).empty());
+    EXPECT_EQ(decomposer.decompose({dictionary.createFullSet()})[0].size(), 1U);
+}
+
+TEST(FiveNFDecomposer, JoinDependencyNotImpliedByEveryComponentKey)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}}, dictionary.getAttributeCount()));
+    FiveNFDecomposer decomposer(closureCache, {JoinDependency({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})})});
+
+    EXPECT_EQ(decomposer.findViolations(dictionary.createFullSet()).size(), 1U); // B is not a key, so the components cannot be joined on it
+}
+
+TEST(FiveNFDecomposer, TrivialAndForeignJoinDependenciesAreIgnored)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({}, dictionary.getAttributeCount()));
+    FiveNFDecomposer decomposer(closureCache, {JoinDependency({dictionary.toAttributeSet({"A", "B", "C"}), dictionary.toAttributeSet({"A", "B"})}), JoinDependency({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})})});
+
+    EXPECT_EQ(decomposer.getJoinDependencies().size(), 1U);
+
+    const std::vector<std::vector<AttributeSet>> components = decomposer.decompose({dictionary.createFullSet(), dictionary.toAttributeSet({"A", "B", "C"})});
+
+    EXPECT_EQ(components[0].size(), 1U); // The join dependency is over A, B and C only
+    EXPECT_EQ(components[1].size(), 2U);
+}
+
+TEST(FiveNFDecomposer, ManyRelationsAcrossThreads)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({}, dictionary.getAttributeCount()));
+    FiveNFDecomposer decomposer(closureCache, {JoinDependency({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"}), dictionary.toAttributeSet({"A", "C"})})});
+
+    const std::vector<AttributeSet> relations(64, dictionary.createFullSet());
+
+    for (const std::vector<AttributeSet> &components : decomposer.decompose(relations))
+    {
+        EXPECT_EQ(components.size(), 3U);
+    }
+}
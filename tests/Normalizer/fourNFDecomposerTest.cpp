@@ -0,0 +1,69 @@
+/*! \file fourNFDecomposerTest.cpp
+    \brief C++ file for creating tests for decomposing relations into 4NF.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/Basis/dependencyBasis.h"
+#include "Normalizer/Decomposition/fourNFDecomposer.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::decomposition::FourNFDecomposer;
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::basis::DependencyBasisCalculator;
+using normalizer::dependencies::multivalued::MultivaluedDependency;
+
+TEST(FourNFDecomposer, SplitsIndependentMultivaluedDependencies)
+{
+    const AttributeDictionary dictionary = createDictionary({"Ename", "Pname", "Dname"});
+    DependencyBasisCalculator basisCalculator({}, {{dictionary.toAttributeSet({"Ename"}), dictionary.toAttributeSet({"Pname"})}, {dictionary.toAttributeSet({"Ename"}), dictionary.toAttributeSet({"Dname"})}}, dictionary.getAttributeCount());
+    FourNFDecomposer decomposer(basisCalculator, {dictionary.toAttributeSet({"Ename"})});
+
+    const std::vector<AttributeSet> components = decomposer.decompose(dictionary.createFullSet());
+
+    ASSERT_EQ(components.size(), 2U);
+    EXPECT_EQ(dictionary.toString(components[0]), "(Ename, Pname)");
+    EXPECT_EQ(dictionary.toString(components[1]), "(Ename, Dname)");
+}
+
+TEST(FourNFDecomposer, SuperkeyIsNotAViolation)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    DependencyBasisCalculator basisCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}}, {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount());
+    FourNFDecomposer decomposer(basisCalculator, {dictionary.toAttributeSet({"A"})});
+
+    EXPECT_TRUE(decomposer.findViolations(dictionary.createFullSet()).empty());
+    EXPECT_EQ(decomposer.decompose(dictionary.createFullSet()).size(), 1U);
+}
+
+TEST(FourNFDecomposer, ViolationProjectedOntoSubRelation)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    DependencyBasisCalculator basisCalculator({}, {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount());
+    FourNFDecomposer decomposer(basisCalculator, {dictionary.toAttributeSet({"A"})});
+
+    EXPECT_EQ(decomposer.findViolations(dictionary.toAttributeSet({"A", "B", "C"})).size(), 1U);
+    EXPECT_TRUE(decomposer.findViolations(dictionary.toAttributeSet({"A", "C", "D"})).empty());
+}
+
+TEST(FourNFDecomposer, FunctionalViolationsLeftToBCNF)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    DependencyBasisCalculator basisCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, {{dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"D"})}}, dictionary.getAttributeCount());
+    FourNFDecomposer decomposer(basisCalculator, {dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"C"})});
+
+    const std::vector<MultivaluedDependency> violations = decomposer.findMultivaluedViolations(dictionary.createFullSet());
+
+    ASSERT_EQ(decomposer.findViolations(dictionary.createFullSet()).size(), 2U);
+    ASSERT_EQ(violations.size(), 1U);
+    EXPECT_EQ(violations[0].toString(dictionary), "C ->> (A, B)");
+}
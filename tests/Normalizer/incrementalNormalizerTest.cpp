@@ -0,0 +1,130 @@
+/*! \file incrementalNormalizerTest.cpp
+    \brief C++ file for creating tests for incrementally re-normalizing a decomposition.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/Closure/closureCache.h"
+#include "Dependencies/Keys/candidateKeyFinder.h"
+#include "Normalizer/Incremental/incrementalNormalizer.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::closure::ClosureCache;
+using normalizer::dependencies::closure::ClosureCalculator;
+using normalizer::incremental::IncrementalNormalizer;
+
+namespace
+{
+    std::vector<std::string> toSortedStrings(const AttributeDictionary &dictionary, const std::vector<AttributeSet> &candidateKeys)
+    {
+        std::vector<std::string> keyNames;
+
+        for (const AttributeSet &candidateKey : candidateKeys)
+        {
+            keyNames.push_back(dictionary.toString(candidateKey));
+        }
+
+        std::sort(keyNames.begin(), keyNames.end());
+
+        return keyNames;
+    }
+}
+
+TEST(CandidateKeyFinder, FindsEveryKey)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount()));
+    normalizer::dependencies::keys::CandidateKeyFinder keyFinder(closureCache);
+
+    const std::vector<AttributeSet> candidateKeys = keyFinder.findCandidateKeys();
+
+    ASSERT_EQ(candidateKeys.size(), 2U);
+    EXPECT_EQ(dictionary.toString(candidateKeys[0]), "(A, C)");
+    EXPECT_EQ(dictionary.toString(candidateKeys[1]), "(A, B)");
+}
+
+TEST(IncrementalNormalizer, AddOnlyProjectsAffectedTables)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount()));
+    IncrementalNormalizer incrementalNormalizer(dictionary, closureCache, {dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"C", "D"})});
+
+    const std::vector<FunctionalDependency> added = incrementalNormalizer.parseDependencies("C -> D");
+
+    ASSERT_EQ(added.size(), 1U);
+    EXPECT_TRUE(incrementalNormalizer.addDependency(added[0]));
+    EXPECT_FALSE(incrementalNormalizer.addDependency(added[0]));
+
+    ASSERT_EQ(incrementalNormalizer.getAffectedComponents().size(), 1U);
+    EXPECT_EQ(incrementalNormalizer.getAffectedComponents()[0], 1U);
+    ASSERT_EQ(incrementalNormalizer.getComponentDependencies()[1].size(), 1U);
+    EXPECT_EQ(incrementalNormalizer.getComponentDependencies()[1][0].toString(dictionary), "C -> D");
+    ASSERT_EQ(incrementalNormalizer.getCandidateKeys().size(), 1U);
+    EXPECT_EQ(dictionary.toString(incrementalNormalizer.getCandidateKeys()[0]), "(A, C)");
+}
+
+TEST(IncrementalNormalizer, RetractMatchesFreshClosures)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    const FunctionalDependency aToB(dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"}));
+    const FunctionalDependency bToC(dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"}));
+
+    ClosureCache closureCache(ClosureCalculator({aToB, bToC}, dictionary.getAttributeCount()));
+    IncrementalNormalizer incrementalNormalizer(dictionary, closureCache, {dictionary.toAttributeSet({"A", "C"})});
+
+    EXPECT_TRUE(incrementalNormalizer.isComponentInBCNF(0));
+    ASSERT_EQ(incrementalNormalizer.getComponentDependencies()[0].size(), 1U);
+    EXPECT_EQ(incrementalNormalizer.getComponentDependencies()[0][0].toString(dictionary), "A -> C");
+
+    EXPECT_TRUE(incrementalNormalizer.retractDependency(bToC));
+    EXPECT_FALSE(incrementalNormalizer.retractDependency(bToC));
+
+    EXPECT_TRUE(incrementalNormalizer.getComponentDependencies()[0].empty());
+    ASSERT_EQ(incrementalNormalizer.getCandidateKeys().size(), 1U);
+    EXPECT_EQ(dictionary.toString(incrementalNormalizer.getCandidateKeys()[0]), "(A, C)");
+}
+
+TEST(IncrementalNormalizer, UpdatedKeysMatchFreshSearch)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    const FunctionalDependency cToA(dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"A"}));
+    const FunctionalDependency dToA(dictionary.toAttributeSet({"D"}), dictionary.toAttributeSet({"A"}));
+
+    ClosureCache closureCache(ClosureCalculator({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}, cToA}, dictionary.getAttributeCount()));
+    IncrementalNormalizer incrementalNormalizer(dictionary, closureCache, {dictionary.toAttributeSet({"A", "B", "C", "D"})});
+
+    EXPECT_EQ(toSortedStrings(dictionary, incrementalNormalizer.getCandidateKeys()), (std::vector<std::string>{"(A, D)", "(B, D)", "(C, D)"}));
+
+    const auto expectFreshKeys = [&]()
+    {
+        ClosureCache freshCache(ClosureCalculator(incrementalNormalizer.getFunctionalDependencies(), dictionary.getAttributeCount()));
+        normalizer::dependencies::keys::CandidateKeyFinder keyFinder(freshCache);
+
+        EXPECT_EQ(toSortedStrings(dictionary, incrementalNormalizer.getCandidateKeys()), toSortedStrings(dictionary, keyFinder.findCandidateKeys()));
+    };
+
+    EXPECT_TRUE(incrementalNormalizer.retractDependency(cToA)); // (B, D) and (C, D) no longer reach A
+    EXPECT_EQ(toSortedStrings(dictionary, incrementalNormalizer.getCandidateKeys()), (std::vector<std::string>{"(A, D)"}));
+    expectFreshKeys();
+
+    EXPECT_TRUE(incrementalNormalizer.addDependency(dToA)); // (A, D) shrinks into D
+    EXPECT_EQ(toSortedStrings(dictionary, incrementalNormalizer.getCandidateKeys()), (std::vector<std::string>{"D"}));
+    expectFreshKeys();
+
+    EXPECT_TRUE(incrementalNormalizer.addDependency(cToA));
+    EXPECT_TRUE(incrementalNormalizer.retractDependency(dToA));
+    EXPECT_EQ(toSortedStrings(dictionary, incrementalNormalizer.getCandidateKeys()), (std::vector<std::string>{"(A, D)", "(B, D)", "(C, D)"}));
+    expectFreshKeys();
+}
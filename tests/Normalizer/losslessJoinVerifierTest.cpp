@@ -0,0 +1,125 @@
+/*! \file losslessJoinVerifierTest.cpp
+    \brief C++ file for creating tests for verifying that a decomposition is lossless.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Dependencies/AttributeSet/attributeSet.h"
+#include "Dependencies/AttributeSet/attributeDictionary.h"
+#include "Dependencies/FunctionalDependency/functionalDependency.h"
+#include "Dependencies/MultivaluedDependency/multivaluedDependency.h"
+#include "Dependencies/JoinDependency/joinDependency.h"
+#include "Normalizer/Verification/losslessJoinVerifier.h"
+#include "Dependencies/attributeDictionaryHelper.h"
+
+using normalizer::dependencies::attribute::AttributeDictionary;
+using normalizer::dependencies::attribute::AttributeSet;
+using normalizer::dependencies::functional::FunctionalDependency;
+using normalizer::dependencies::join::JoinDependency;
+using normalizer::dependencies::multivalued::MultivaluedDependency;
+using normalizer::verification::JoinResult;
+using normalizer::verification::LosslessJoinVerifier;
+
+TEST(LosslessJoinVerifier, SharedDeterminantIsLossless)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    LosslessJoinVerifier verifier({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, {}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"A", "C"})}), JoinResult::LOSSLESS);
+}
+
+TEST(LosslessJoinVerifier, SharedDependentIsLossy)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    LosslessJoinVerifier verifier({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, {}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})}), JoinResult::LOSSY);
+}
+
+TEST(LosslessJoinVerifier, TransitiveChainIsLossless)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C", "D"});
+    LosslessJoinVerifier verifier({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}, {dictionary.toAttributeSet({"B"}), dictionary.toAttributeSet({"C"})}, {dictionary.toAttributeSet({"C"}), dictionary.toAttributeSet({"D"})}}, {}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"C", "D"}), dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})}), JoinResult::LOSSLESS);
+}
+
+TEST(LosslessJoinVerifier, MultivaluedDependencyIsLossless)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    LosslessJoinVerifier verifier({}, {{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B"})}}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"A", "C"})}), JoinResult::LOSSLESS);
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"A", "B"}), dictionary.toAttributeSet({"B", "C"})}), JoinResult::LOSSY);
+}
+
+TEST(LosslessJoinVerifier, JoinDependencyIsLossless)
+{
+    const AttributeDictionary dictionary = createDictionary({"Sname", "Part_name", "Proj_name"});
+    const std::vector<AttributeSet> components = {dictionary.toAttributeSet({"Sname", "Part_name"}), dictionary.toAttributeSet({"Part_name", "Proj_name"}), dictionary.toAttributeSet({"Sname", "Proj_name"})};
+
+    LosslessJoinVerifier withoutJoin({}, {}, dictionary.getAttributeCount());
+    LosslessJoinVerifier withJoin({}, {}, dictionary.getAttributeCount(), {JoinDependency(components)});
+
+    EXPECT_EQ(withoutJoin.verify(components), JoinResult::LOSSY);
+    EXPECT_EQ(withJoin.verify(components), JoinResult::LOSSLESS);
+}
+
+TEST(LosslessJoinVerifier, MissingAttributeIsLossy)
+{
+    const AttributeDictionary dictionary = createDictionary({"A", "B", "C"});
+    LosslessJoinVerifier verifier({{dictionary.toAttributeSet({"A"}), dictionary.toAttributeSet({"B", "C"})}}, {}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify({dictionary.toAttributeSet({"A", "B"})}), JoinResult::LOSSY);
+    EXPECT_EQ(verifier.getUncoveredAttributes(), dictionary.toAttributeSet({"C"}));
+}
+
+TEST(LosslessJoinVerifier, WideSchemaChase)
+{
+    AttributeDictionary dictionary;
+    std::vector<FunctionalDependency> functionalDependencies;
+    std::vector<AttributeSet> components;
+
+    for (us attributeId = 0; attributeId < 128; ++attributeId)
+    {
+        dictionary.addAttribute("A" + std::to_string(static_cast<ui>(attributeId)));
+    }
+
+    for (us attributeId = 0; attributeId + 1 < 128; ++attributeId)
+    {
+        AttributeSet determinant = dictionary.createEmptySet();
+        determinant.addAttribute(attributeId);
+
+        AttributeSet dependent = dictionary.createEmptySet();
+        dependent.addAttribute(static_cast<us>(attributeId + 1));
+
+        functionalDependencies.push_back({determinant, dependent});
+        components.push_back(determinant | dependent);
+    }
+
+    LosslessJoinVerifier verifier(functionalDependencies, {}, dictionary.getAttributeCount());
+
+    EXPECT_EQ(verifier.verify(components), JoinResult::LOSSLESS);
+
+    components.erase(components.begin() + 64);
+
+    EXPECT_EQ(verifier.verify(components), JoinResult::LOSSY);
+}
+
+TEST(LosslessJoinVerifier, RowLimitIsInconclusive)
+{
+    const AttributeDictionary dictionary = createDictionary({"Sname", "Part_name", "Proj_name"});
+    const std::vector<AttributeSet> components = {dictionary.toAttributeSet({"Sname", "Part_name"}), dictionary.toAttributeSet({"Part_name", "Proj_name"}), dictionary.toAttributeSet({"Sname", "Proj_name"})};
+
+    LosslessJoinVerifier limited({}, {}, dictionary.getAttributeCount(), {JoinDependency(components)}, 3);
+    LosslessJoinVerifier unlimited({}, {}, dictionary.getAttributeCount(), {JoinDependency(components)});
+
+    EXPECT_EQ(limited.verify(components), JoinResult::INCONCLUSIVE); // The join adds rows the tableau has no room for
+    EXPECT_EQ(limited.getChaseRowCount(), 3U);
+    EXPECT_EQ(unlimited.verify(components), JoinResult::LOSSLESS);
+}
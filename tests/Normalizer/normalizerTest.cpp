@@ -0,0 +1,121 @@
+/*! \file normalizerTest.cpp
+    \brief C++ file for creating tests for normalizing a table to several forms in one run.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Normalizer/formConstants.h"
+#include "Normalizer/normalizer.h"
+#include "Interpreter/Parser/parser.h"
+
+using normalizer::NormalizationForm;
+using normalizer::Normalizer;
+using normalizer::interpreter::parser::Parser;
+
+namespace
+{
+    const std::string BCNF_SQL = "CREATE TABLE IF NOT EXISTS BCNF (\n    StudentID INT NOT NULL,\n    Course VARCHAR(255) NOT NULL,\n    Instructor VARCHAR(255) NOT NULL\n);";
+    const std::string BCNF_DEPENDENCIES = "StudentID -> Instructor\nCourse -> Instructor\nInstructor -> Course\nKey: (StudentID, Course)";
+    const std::string TONE_SQL = "CREATE TABLE IF NOT EXISTS TONE (\n    A INT NOT NULL,\n    B INT NOT NULL,\n    C INT NOT NULL,\n    D INT NOT NULL\n);";
+    const std::string SUPPLY_SQL = "CREATE TABLE IF NOT EXISTS SUPPLY (\n    Sname VARCHAR(255) NOT NULL,\n    Part_name VARCHAR(255) NOT NULL,\n    Proj_name VARCHAR(255) NOT NULL\n);";
+
+    Normalizer createNormalizer(const NormalizationForm normalizeTo, const std::string &sql = BCNF_SQL, const std::string &dependencies = BCNF_DEPENDENCIES)
+    {
+        Parser sqlParser(sql);
+
+        sqlParser.parse();
+
+        normalizer::table::Table table = sqlParser.getTable();
+
+        Parser dependencyParser(dependencies, table);
+
+        dependencyParser.parse();
+
+        for (const std::string &key : dependencyParser.getTable().getPrimaryKeys())
+        {
+            table.addPrimaryKey(key);
+        }
+
+        return {normalizeTo, false, table, dependencyParser.getDependencyManager()};
+    }
+}
+
+TEST(Normalizer, SeveralFormsMatchSeparateRuns)
+{
+    Normalizer normalizer = createNormalizer(NormalizationForm::FOUR);
+
+    std::map<NormalizationForm, std::vector<normalizer::table::Table>> decompositions = normalizer.normalize({NormalizationForm::FOUR, NormalizationForm::THREE, NormalizationForm::BCNF});
+
+    ASSERT_EQ(decompositions.size(), 3U);
+
+    for (const NormalizationForm form : {NormalizationForm::THREE, NormalizationForm::BCNF, NormalizationForm::FOUR})
+    {
+        Normalizer separateNormalizer = createNormalizer(form);
+
+        separateNormalizer.normalize();
+
+        EXPECT_EQ(normalizer.printTables(decompositions[form]), separateNormalizer.printTables(separateNormalizer.getNormalizedTables()));
+    }
+
+    EXPECT_EQ(normalizer.printTables(normalizer.getNormalizedTables()), normalizer.printTables(decompositions[NormalizationForm::FOUR])); // The highest form is kept
+}
+
+TEST(Normalizer, NormalizingAgainStartsFromTheInputTable)
+{
+    Normalizer normalizer = createNormalizer(NormalizationForm::BCNF);
+
+    normalizer.normalize();
+
+    const std::string firstRun = normalizer.printTables(normalizer.getNormalizedTables());
+
+    normalizer.normalize();
+
+    EXPECT_EQ(normalizer.printTables(normalizer.getNormalizedTables()), firstRun);
+    EXPECT_EQ(normalizer.normalize({NormalizationForm::BCNF})[NormalizationForm::BCNF].size(), normalizer.getNormalizedTables().size());
+}
+
+TEST(Normalizer, BCNFSplitsEachGroupOfEquivalentRowsOnce)
+{
+    const std::vector<std::pair<std::string, std::string>> expected = {{"Proj_name", "Part_name"}}; // The group stands in as Part_name, its first row
+
+    for (const std::string &dependencies : std::vector<std::string>{"Key: (Sname, Part_name)\nPart_name -> Proj_name\nProj_name -> Part_name", "Key: (Sname, Part_name)\nProj_name -> Part_name\nPart_name -> Proj_name"})
+    {
+        Normalizer normalizer = createNormalizer(NormalizationForm::BCNF, SUPPLY_SQL, dependencies);
+
+        EXPECT_EQ(normalizer.analyze().bcnfDependencies, expected);
+    }
+}
+
+TEST(Normalizer, TwoNFKeepsRowsDecidedByPrimeRowsOutsideTheKey)
+{
+    Normalizer normalizer = createNormalizer(NormalizationForm::TWO, TONE_SQL, "A -> C\nC -> (A, D)\nKEY: (A, B)"); // C is in the candidate key (C, B), but not in the declared one
+
+    normalizer.setVerifyDecomposition(true);
+    normalizer.normalize();
+
+    EXPECT_EQ(normalizer.getJoinResult(), normalizer::verification::JoinResult::LOSSLESS);
+    EXPECT_TRUE(normalizer.getLostDependencies().empty());
+
+    std::vector<std::string> tableNames;
+
+    for (const normalizer::table::Table &table : normalizer.getNormalizedTables())
+    {
+        tableNames.push_back(table.getTableName());
+    }
+
+    for (const normalizer::table::Table &table : normalizer.getNormalizedTables())
+    {
+        for (const normalizer::table::foreign::ForeignKey &foreignKey : table.getForeignKeys())
+        {
+            EXPECT_NE(std::find(tableNames.begin(), tableNames.end(), foreignKey.getReferencedTableName()), tableNames.end()) << foreignKey.getReferencedTableName();
+        }
+    }
+}
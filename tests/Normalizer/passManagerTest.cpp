@@ -0,0 +1,76 @@
+/*! \file passManagerTest.cpp
+    \brief C++ file for creating tests for running the normalization passes.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Normalizer/formConstants.h"
+#include "Normalizer/Pipeline/passManager.h"
+
+using normalizer::NormalizationForm;
+using normalizer::pipeline::Analysis;
+using normalizer::pipeline::PassManager;
+
+TEST(PassManager, SkipsSatisfiedPasses)
+{
+    PassManager passManager;
+    std::vector<NormalizationForm> ranPasses;
+
+    passManager.addPass({NormalizationForm::ONE, {}, {}, []() noexcept
+                         { return true; },
+                         [&ranPasses]()
+                         {
+                             ranPasses.push_back(NormalizationForm::ONE);
+                             return true;
+                         }});
+
+    passManager.addPass({NormalizationForm::TWO, {}, {}, {}, [&ranPasses]()
+                         {
+                             ranPasses.push_back(NormalizationForm::TWO);
+                             return true;
+                         }});
+
+    passManager.addPass({NormalizationForm::THREE, {}, {}, {}, [&ranPasses]()
+                         {
+                             ranPasses.push_back(NormalizationForm::THREE);
+                             return true;
+                         }});
+
+    passManager.run(NormalizationForm::TWO);
+
+    EXPECT_EQ(ranPasses, std::vector<NormalizationForm>{NormalizationForm::TWO}); // The pass after the target never runs
+    EXPECT_EQ(passManager.getSkippedPasses(), std::vector<NormalizationForm>{NormalizationForm::ONE});
+}
+
+TEST(PassManager, RecomputesOnlyInvalidatedAnalyses)
+{
+    PassManager passManager;
+    ui closureComputations = 0;
+    ui normalFormComputations = 0;
+
+    passManager.registerAnalysis(Analysis::CLOSURES, [&closureComputations]() noexcept
+                                 { ++closureComputations; },
+                                 false);
+    passManager.registerAnalysis(Analysis::NORMAL_FORMS, [&normalFormComputations]() noexcept
+                                 { ++normalFormComputations; },
+                                 false);
+
+    passManager.addPass({NormalizationForm::ONE, {Analysis::CLOSURES, Analysis::NORMAL_FORMS}, {Analysis::CLOSURES}, {}, []() noexcept
+                         { return true; }});
+    passManager.addPass({NormalizationForm::TWO, {Analysis::CLOSURES, Analysis::NORMAL_FORMS}, {Analysis::CLOSURES, Analysis::NORMAL_FORMS}, {}, []() noexcept
+                         { return true; }});
+    passManager.addPass({NormalizationForm::THREE, {Analysis::CLOSURES, Analysis::NORMAL_FORMS}, {}, {}, []() noexcept
+                         { return false; }}); // Changes nothing, so nothing is invalidated
+
+    passManager.run(NormalizationForm::THREE);
+
+    EXPECT_EQ(closureComputations, 1U);
+    EXPECT_EQ(normalFormComputations, 2U);
+    EXPECT_EQ(passManager.getComputeCount(Analysis::NORMAL_FORMS), 2U);
+    EXPECT_TRUE(passManager.isValid(Analysis::NORMAL_FORMS));
+    EXPECT_FALSE(passManager.isValid(Analysis::KEYS));
+}
@@ -0,0 +1,108 @@
+/*! \file tableMaterializerTest.cpp
+    \brief C++ file for creating tests for filling the normalized tables with the rows of the input table.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/csvReader.h"
+#include "Normalizer/Materialization/tableMaterializer.h"
+#include "Table/table.h"
+#include "Table/TableRow/RowDefinition/genericRowDefinition.h"
+#include "Table/ForeignKey/foreignKey.h"
+#include "Table/Instance/tableInstance.h"
+#include "Table/tableHelper.h"
+
+using normalizer::file::CsvReader;
+using normalizer::materialization::TableMaterializer;
+using normalizer::table::Table;
+using normalizer::table::foreign::ForeignKey;
+using normalizer::table::instance::TableInstance;
+
+TEST(TableMaterializer, WritesDistinctRowsParentsFirst)
+{
+    const TableInstance instance = CsvReader::parse("StudentID,Name,Course\n1,Ann,CS101\n1,Ann,MA101\n2,\"O'Neil, \"\"Bo\"\"\",CS101\n2,\"O'Neil, \"\"Bo\"\"\",CS101");
+
+    Table enrollment = createTable("Enrollment", {"StudentID", "Course"});
+
+    enrollment.addForeignKey(ForeignKey("StudentID", "Student", "StudentID"));
+
+    TableMaterializer materializer(instance, {enrollment, createTable("Student", {"StudentID", "Name"})});
+
+    materializer.materialize();
+
+    EXPECT_EQ(materializer.getSourceRows(0), (std::vector<ui>{0, 1, 2}));
+    EXPECT_EQ(materializer.getSourceRows(1), (std::vector<ui>{0, 2}));
+    EXPECT_EQ(materializer.getLoadOrder(), (std::vector<std::size_t>{1, 0})); // Students are inserted before the enrollments that reference them
+
+    std::ostringstream inserts;
+    materializer.writeInserts(inserts);
+
+    EXPECT_EQ(inserts.str(), "INSERT INTO Student (StudentID, Name) VALUES\n\t('1', 'Ann'),\n\t('2', 'O''Neil, \"Bo\"');\n\n"
+                             "INSERT INTO Enrollment (StudentID, Course) VALUES\n\t('1', 'CS101'),\n\t('1', 'MA101'),\n\t('2', 'CS101');\n\n");
+
+    std::ostringstream csv;
+    materializer.writeCsv(1, csv);
+
+    EXPECT_EQ(csv.str(), "StudentID,Name\n1,Ann\n2,\"O'Neil, \"\"Bo\"\"\"\n");
+    EXPECT_EQ(CsvReader::parse(csv.str()).getValue(1, 1), "O'Neil, \"Bo\""); // The CSV reads back to the same values
+
+    EXPECT_EQ(materializer.createLoadScript({"e.csv", "s.csv"}), "LOAD DATA LOCAL INFILE 's.csv' INTO TABLE Student FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '\"' ESCAPED BY '' LINES TERMINATED BY '\\n' IGNORE 1 LINES (StudentID, Name);\n"
+                                                                 "LOAD DATA LOCAL INFILE 'e.csv' INTO TABLE Enrollment FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '\"' ESCAPED BY '' LINES TERMINATED BY '\\n' IGNORE 1 LINES (StudentID, Course);\n");
+
+    EXPECT_THROW(TableMaterializer(instance, {createTable("Room", {"Room"})}), std::invalid_argument);
+}
+
+TEST(TableMaterializer, MatchesSetDeduplication)
+{
+    std::string contents = "A,B,C";
+    std::vector<std::vector<ui>> rows;
+    ui state = 7;
+
+    for (ui row = 0; row < 200000; ++row) // Enough rows for several blocks of hashing
+    {
+        std::vector<ui> values;
+
+        for (ui column = 0; column < 3; ++column)
+        {
+            state = state * 1103515245U + 12345U;
+            values.push_back((state >> 16) % (column == 2 ? 1000U : 40U));
+        }
+
+        contents += "\n" + std::to_string(values[0]) + "," + std::to_string(values[1]) + "," + std::to_string(values[2]);
+        rows.push_back(values);
+    }
+
+    const TableInstance instance = CsvReader::parse(contents);
+    TableMaterializer materializer(instance, {createTable("AB", {"A", "B"}), createTable("CA", {"C", "A"})});
+
+    materializer.materialize();
+
+    std::vector<ui> expectedAB;
+    std::vector<ui> expectedCA;
+    std::set<std::pair<ui, ui>> seenAB;
+    std::set<std::pair<ui, ui>> seenCA;
+
+    for (ui row = 0; row < rows.size(); ++row)
+    {
+        if (seenAB.insert({rows[row][0], rows[row][1]}).second)
+        {
+            expectedAB.push_back(row);
+        }
+
+        if (seenCA.insert({rows[row][2], rows[row][0]}).second)
+        {
+            expectedCA.push_back(row);
+        }
+    }
+
+    EXPECT_EQ(materializer.getSourceRows(0), expectedAB);
+    EXPECT_EQ(materializer.getSourceRows(1), expectedCA);
+}
@@ -0,0 +1,59 @@
+/*! \file parallelRunnerTest.cpp
+    \brief C++ file for creating tests for running a task over a range of indices across threads.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "Parallel/parallelRunner.h"
+
+using normalizer::parallel::ParallelRunner;
+
+TEST(ParallelRunner, RunsEveryIndexOnce)
+{
+    const std::size_t count = 10000;
+
+    std::vector<std::atomic<int>> visits(count);
+
+    ParallelRunner::run(count, 1, [&visits](const std::size_t begin, const std::size_t end) noexcept
+                        {
+                            for (std::size_t i = begin; i < end; ++i)
+                            {
+                                ++visits[i];
+                            } });
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(visits[i].load(), 1);
+    }
+}
+
+TEST(ParallelRunner, RethrowsTheErrorOfTheEarliestIndices)
+{
+    const std::size_t count = 10000;
+
+    std::atomic<std::size_t> visited = 0;
+
+    try
+    {
+        ParallelRunner::run(count, 1, [&visited](const std::size_t begin, const std::size_t end)
+                            {
+                                visited += end - begin;
+
+                                throw std::runtime_error(std::to_string(begin)); });
+
+        FAIL() << "The error of the task was not rethrown";
+    }
+    catch (const std::runtime_error &error)
+    {
+        EXPECT_EQ(std::string(error.what()), "0");
+    }
+
+    EXPECT_EQ(visited.load(), count); // Every thread finished before the error was rethrown
+}
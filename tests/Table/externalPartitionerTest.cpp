@@ -0,0 +1,107 @@
+/*! \file externalPartitionerTest.cpp
+    \brief C++ file for creating tests for splitting the rows of a CSV data file into partitions that each fit in memory.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Table/External/externalPartitioner.h"
+#include "Table/Instance/tableInstance.h"
+#include "Table/tableHelper.h"
+
+using normalizer::file::TemporaryDirectory;
+using normalizer::table::external::ExternalPartitioner;
+using normalizer::table::instance::TableInstance;
+
+namespace
+{
+    std::string createRows(const ui rowCount)
+    {
+        std::string contents = "Key,Note,Value\n";
+
+        for (ui row = 0; row < rowCount; ++row)
+        {
+            contents += std::to_string(row % 37) + ",\"note, " + std::to_string(row % 5) + "\"," + std::to_string(row) + "\n";
+        }
+
+        return contents;
+    }
+}
+
+TEST(ExternalPartitioner, SpillsRowsIntoPartitionsByKey)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+    const std::string csvPath = writeRows(directory, createRows(2000));
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 4096);
+
+    std::vector<ui> visits(2000, 0);
+    std::map<std::string, ul> keyPartitions;
+    ul partition = 0;
+
+    partitioner.forEachPartition({"Value", "Key"}, {1}, [&visits, &keyPartitions, &partition](const TableInstance &instance, const std::vector<ul> &rows)
+                                 {
+                                     ASSERT_EQ(instance.getRowCount(), rows.size());
+                                     ASSERT_EQ(instance.getColumnCount(), 2U);
+
+                                     for (ui row = 0; row < instance.getRowCount(); ++row)
+                                     {
+                                         EXPECT_TRUE(row == 0 || rows[row - 1] < rows[row]); // Each partition keeps the order of the file
+                                         EXPECT_EQ(instance.getValue(row, 0), std::to_string(rows[row]));
+                                         EXPECT_EQ(instance.getValue(row, 1), std::to_string(rows[row] % 37));
+
+                                         ++visits[rows[row]];
+
+                                         EXPECT_EQ(keyPartitions.emplace(instance.getValue(row, 1), partition).first->second, partition); // No key is split across partitions
+                                     }
+
+                                     ++partition; });
+
+    EXPECT_EQ(visits, std::vector<ui>(2000, 1));
+    EXPECT_EQ(keyPartitions.size(), 37U);
+    EXPECT_GT(partitioner.getPartitionCount(), 1U);
+    EXPECT_EQ(partitioner.getPartitionCount(), partition);
+    EXPECT_GT(partitioner.getSpilledBytes(), 0U);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(directory.getPath()), std::filesystem::directory_iterator()), 1); // Only the CSV file is left
+}
+
+TEST(ExternalPartitioner, ReadsSmallFilesAtOnce)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+    const std::string csvPath = writeRows(directory, createRows(50));
+
+    ExternalPartitioner partitioner(csvPath, directory.getPath(), 1U << 20);
+
+    ui rowCount = 0;
+
+    partitioner.forEachPartition({"Key"}, {0}, [&rowCount](const TableInstance &instance, const std::vector<ul> &rows)
+                                 {
+                                     EXPECT_EQ(instance.getRowCount(), rows.size());
+                                     rowCount += instance.getRowCount(); });
+
+    EXPECT_EQ(rowCount, 50U);
+    EXPECT_EQ(partitioner.getPartitionCount(), 1U);
+    EXPECT_EQ(partitioner.getSpilledBytes(), 0U);
+    EXPECT_THROW(partitioner.forEachPartition({"Room"}, {0}, [](const TableInstance &, const std::vector<ul> &) noexcept {}), std::invalid_argument);
+}
+
+TEST(ExternalPartitioner, ParsesMemoryLimits)
+{
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("4096"), 4096U);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("64K"), 64U << 10);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("2m"), 2U << 20);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("3G"), 3UL << 30);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit(""), 0U);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("G"), 0U);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("12KB"), 0U);
+    EXPECT_EQ(ExternalPartitioner::parseMemoryLimit("-5"), 0U);
+}
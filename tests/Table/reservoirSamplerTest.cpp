@@ -0,0 +1,99 @@
+/*! \file reservoirSamplerTest.cpp
+    \brief C++ file for creating tests for drawing a uniform sample of the rows of a CSV data file in one pass.
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "FileManager/temporaryDirectory.h"
+#include "Table/Sampling/reservoirSampler.h"
+#include "Table/Instance/tableInstance.h"
+#include "Table/tableHelper.h"
+
+using normalizer::file::TemporaryDirectory;
+using normalizer::table::instance::TableInstance;
+using normalizer::table::sampling::ReservoirSampler;
+
+namespace
+{
+    std::string createRows(const ui rowCount)
+    {
+        std::string contents = "Row,Parity\n";
+
+        for (ui row = 0; row < rowCount; ++row)
+        {
+            contents += std::to_string(row) + "," + (row % 2 == 0 ? "even" : "odd") + "\n";
+        }
+
+        return contents;
+    }
+}
+
+TEST(ReservoirSampler, KeepsEveryRowOfSmallFiles)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+
+    ReservoirSampler sampler(writeRows(directory, createRows(40)), 100);
+
+    const TableInstance sample = sampler.sample();
+
+    std::vector<ul> rows(40, 0);
+    std::iota(rows.begin(), rows.end(), 0);
+
+    ASSERT_EQ(sample.getColumnNames(), (std::vector<std::string>{"Row", "Parity"}));
+    ASSERT_EQ(sample.getRowCount(), 40U);
+    EXPECT_EQ(sampler.getRowCount(), 40U);
+    EXPECT_EQ(sampler.getRowNumbers(), rows);
+    EXPECT_EQ(sample.getValue(17, 0), "17");
+    EXPECT_EQ(sample.getValue(17, 1), "odd");
+}
+
+TEST(ReservoirSampler, SamplesRowsUniformlyInFileOrder)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+    const std::string csvPath = writeRows(directory, createRows(20000));
+
+    ReservoirSampler sampler(csvPath, 500);
+
+    const TableInstance sample = sampler.sample();
+    const std::vector<ul> rows = sampler.getRowNumbers();
+
+    ASSERT_EQ(sample.getRowCount(), 500U);
+    ASSERT_EQ(rows.size(), 500U);
+    EXPECT_EQ(sampler.getRowCount(), 20000U);
+
+    ul firstHalf = 0;
+
+    for (ui row = 0; row < sample.getRowCount(); ++row)
+    {
+        EXPECT_TRUE(row == 0 || rows[row - 1] < rows[row]);
+        EXPECT_EQ(sample.getValue(row, 0), std::to_string(rows[row]));
+
+        if (rows[row] < 10000)
+        {
+            ++firstHalf;
+        }
+    }
+
+    EXPECT_GT(firstHalf, 200U); // About half the rows of a uniform sample come from each half of the file
+    EXPECT_LT(firstHalf, 300U);
+
+    sampler.sample();
+
+    EXPECT_EQ(sampler.getRowNumbers(), rows); // The priorities only depend on the position of each row
+}
+
+TEST(ReservoirSampler, CountsTheRowsThatFitUnderALimit)
+{
+    const TemporaryDirectory directory(std::filesystem::temp_directory_path().string());
+    const std::string csvPath = writeRows(directory, "AA,BB\n10,20\n30,40\n50,60\n"); // Every line is 6 bytes with its line break
+
+    EXPECT_EQ(ReservoirSampler::countFittingRows(csvPath, 240), 10U);
+    EXPECT_EQ(ReservoirSampler::countFittingRows(csvPath, 1), 1U);
+}
@@ -0,0 +1,31 @@
+/*! \file tableHelper.cpp
+    \brief C++ file for creating the tables and CSV data files of tests.
+    \details Contains the function definitions for creating a table from the row names of a test and for writing the rows of a test to a CSV data file
+    \date 10/18/2026
+    \version 1.0
+    \author Matthew Moore
+*/
+
+#include "Table/tableHelper.h"
+
+normalizer::table::Table createTable(const std::string &name, const std::vector<std::string> &rowNames)
+{
+    normalizer::table::Table table(name);
+
+    for (const std::string &rowName : rowNames)
+    {
+        table.addTableRow({rowName, normalizer::table::row::GenericRowDefinition("VARCHAR")});
+    }
+
+    return table;
+}
+
+std::string writeRows(const normalizer::file::TemporaryDirectory &directory, const std::string &contents)
+{
+    const std::string csvPath = directory.createFilePath("rows.csv");
+    std::ofstream csvFile(csvPath);
+
+    csvFile << contents;
+
+    return csvPath;
+}